@@ -233,12 +233,188 @@ set(OSAL_CONFIG_RWLOCK                          TRUE
     CACHE BOOL "Controls the inclusion of readers-writer lock objects in the code"
 )
 
+#
+# OSAL_CONFIG_LOCKFREE_REFCOUNT
+# ----------------------------------
+#
+# Controls whether reference-counted object access avoids the global table lock.
+#
+# Most I/O calls (e.g. OS_read/OS_write on files and sockets) only need to
+# hold a reference on the object for the duration of the call.  If set TRUE
+# (default), this reference is obtained and released using atomic operations
+# directly on the object record, and the global table lock is only taken when
+# the object is in the process of being created or deleted.  This allows I/O
+# from several tasks to proceed concurrently without contending for the lock.
+#
+# This requires a compiler providing the GCC-style "__atomic" builtins with
+# lock-free support for 16 and 32 bit values.  If these are not available then
+# the global table lock is used regardless of this setting.
+#
+# If set FALSE, the global table lock is always used.
+#
+set(OSAL_CONFIG_LOCKFREE_REFCOUNT               TRUE
+    CACHE BOOL "Use atomic operations rather than the global lock for object refcounts"
+)
+
+#
+# OSAL_CONFIG_QUEUE_RINGBUFFER
+# ----------------------------------
+#
+# Controls whether message queues are held in process memory on POSIX.
+#
+# OSAL queues are never shared with other processes, so they do not need to
+# be backed by the system message queue facility.  If set TRUE (default), each
+# queue is a ring buffer allocated when the queue is created.  Messages are
+# added and removed using atomic operations, and a task only makes a system
+# call when it needs to wait for a message to arrive, or to wake such a task.
+# These queues are not subject to the system message queue limits (e.g.
+# /proc/sys/fs/mqueue/msg_max on Linux), so the depth is never truncated.
+#
+# This requires a compiler providing the GCC-style "__atomic" builtins.
+#
+# If set FALSE, queues use mq_open() unless OS_QUEUE_FLAG_LOCAL is passed to
+# OS_QueueCreate().  This option has no effect on other implementations.
+#
+set(OSAL_CONFIG_QUEUE_RINGBUFFER                TRUE
+    CACHE BOOL "Hold POSIX message queues in process memory rather than using mq_open"
+)
+
+#
+# OSAL_CONFIG_BINSEM_FUTEX
+# ----------------------------------
+#
+# Controls whether binary semaphores are implemented using futexes on Linux.
+#
+# POSIX does not provide binary semaphores, so by default these are simulated
+# with a mutex and a condition variable, and every give and take has to lock the
+# mutex.  If set TRUE (default), on Linux the state of each binary semaphore is
+# instead held in a single word which is updated using atomic operations.  A task
+# only makes a system call when it needs to wait for the semaphore, or to wake a
+# task that is waiting.
+#
+# This requires a compiler providing the GCC-style "__atomic" builtins.
+#
+# If set FALSE, or when not building for Linux, the mutex and condition variable
+# are used.  This option has no effect on other implementations.
+#
+set(OSAL_CONFIG_BINSEM_FUTEX                    TRUE
+    CACHE BOOL "Implement POSIX binary semaphores using futexes on Linux"
+)
+
+#
+# OSAL_CONFIG_COUNTSEM_FUTEX
+# ----------------------------------
+#
+# Controls whether counting semaphores are implemented using futexes on Linux.
+#
+# If set TRUE (default), on Linux the value of each counting semaphore is held in
+# a single word which is updated using atomic operations, in the same way as
+# OSAL_CONFIG_BINSEM_FUTEX.  This also allows several units to be given or taken
+# in one operation with OS_CountSemGiveN() and OS_CountSemTakeN().
+#
+# This requires a compiler providing the GCC-style "__atomic" builtins.
+#
+# If set FALSE, or when not building for Linux, POSIX semaphores are used and
+# the multi-unit calls return OS_ERR_NOT_IMPLEMENTED.  This option has no effect
+# on other implementations.
+#
+set(OSAL_CONFIG_COUNTSEM_FUTEX                  TRUE
+    CACHE BOOL "Implement POSIX counting semaphores using futexes on Linux"
+)
+
+#
+# OSAL_CONFIG_OBJECT_LOCK_STATS
+# ----------------------------------
+#
+# Controls whether contention statistics are collected for the object table locks.
+#
+# If set TRUE, each acquisition of a table lock is counted, along with the time
+# spent waiting for and holding the lock, as measured by the monotonic clock.
+# These are reported through OS_GetObjectTypeLockStats().  This adds two clock
+# reads to every lock/unlock cycle.
+#
+# If set FALSE (default), no statistics are collected and OS_GetObjectTypeLockStats()
+# returns OS_ERR_NOT_IMPLEMENTED.
+#
+set(OSAL_CONFIG_OBJECT_LOCK_STATS               FALSE
+    CACHE BOOL "Collect contention statistics for the object table locks"
+)
+
+#
+# OSAL_CONFIG_QUEUE_STATS
+# ----------------------------------
+#
+# Controls whether occupancy and latency statistics are collected for queues.
+#
+# If set TRUE, each queue counts the messages put and received, the number of
+# times it was found full or a call timed out, and tracks its depth and high-water
+# mark.  Where the implementation can carry a timestamp with each message (currently
+# POSIX queues held in process memory), the time from put to receipt is also recorded
+# in a histogram.  These are reported through OS_QueueGetStats().  This adds a few
+# atomic updates to every put and get, and two clock reads per message if the
+# latency is measured.
+#
+# If set FALSE (default), no statistics are collected and OS_QueueGetStats()
+# returns OS_ERR_NOT_IMPLEMENTED.
+#
+set(OSAL_CONFIG_QUEUE_STATS                     FALSE
+    CACHE BOOL "Collect occupancy and latency statistics for queues"
+)
+
+#
+# OSAL_CONFIG_MUTEX_STATS
+# ----------------------------------
+#
+# Controls whether contention and hold time statistics are collected for mutexes.
+#
+# If set TRUE, each mutex counts the times it was taken, and the takes which found
+# it held by another task.  The time spent waiting and the time it was held, as
+# measured by the monotonic clock, are also recorded, along with the task which
+# held it the longest.  These are reported through OS_MutSemGetStats().  This adds
+# two clock reads to every take/give cycle, and a third if the take had to wait.
+#
+# If set FALSE (default), no statistics are collected and OS_MutSemGetStats()
+# returns OS_ERR_NOT_IMPLEMENTED.
+#
+set(OSAL_CONFIG_MUTEX_STATS                     FALSE
+    CACHE BOOL "Collect contention and hold time statistics for mutexes"
+)
+
+#
+# OSAL_CONFIG_CACHE_ALIGNED_OBJECTS
+# ----------------------------------
+#
+# Controls whether each record in the common object table occupies its own cache line(s).
+#
+# The common record of each object holds its ID and reference count, which are
+# updated by every I/O call on that object.  The records are small, so normally
+# several of them share a cache line, and calls on different objects from tasks
+# on different processors contend for the same line even though the objects
+# themselves are unrelated ("false sharing").
+#
+# If set TRUE, each record is padded to a multiple of OSAL_CONFIG_CACHE_LINE_SIZE
+# and the table is aligned to a cache line boundary.  This increases the memory
+# used by the table by about that factor, but may improve I/O throughput when
+# several processors are in use.
+#
+# If set FALSE (default), the records are packed as tightly as possible.
+#
+set(OSAL_CONFIG_CACHE_ALIGNED_OBJECTS           FALSE
+    CACHE BOOL "Align each object table record to the processor cache line size"
+)
+
 #############################################
 # Resource Limits for the OS API
 #############################################
 
 # Note that CMake does not have a cache type for integers;
 # although they are defined as strings the values should be integer numbers.
+#
+# The object type limits below are the defaults for each type.  A BSP may change
+# any of them at startup, before OS_API_Init(), via OS_BSP_SetResourceTypeLimit().
+# The object tables are allocated by OS_API_Init() to the configured sizes.  The
+# limits for queues and open files are also upper bounds, because OS_FdSet
+# remains sized by these values.
 
 # The maximum number of concurrently-running tasks to support
 set(OSAL_CONFIG_MAX_TASKS               64
@@ -390,3 +566,11 @@ set(OSAL_CONFIG_QUEUE_MAX_DEPTH         50
 set(OSAL_CONFIG_ADD_TASK_FLAGS              0
     CACHE STRING "Flags added to all tasks"
 )
+
+# The size of a processor cache line, in bytes.
+#
+# This is only used if OSAL_CONFIG_CACHE_ALIGNED_OBJECTS is enabled, and must be
+# a power of two.  If unsure, 64 is correct for most current processors.
+set(OSAL_CONFIG_CACHE_LINE_SIZE             64
+    CACHE STRING "Size of a processor cache line in bytes"
+)
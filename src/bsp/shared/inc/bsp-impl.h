@@ -103,6 +103,12 @@ typedef struct
      * feature.
      */
     uint32 ResourceConfig[OS_OBJECT_TYPE_USER];
+
+    /*
+     * Maximum number of objects of each resource type, to override the
+     * compile-time limits at startup (0=use default).
+     */
+    uint32 ResourceLimit[OS_OBJECT_TYPE_USER];
 } OS_BSP_GlobalData_t;
 
 /*
@@ -23,6 +23,8 @@
  *   Simple integer key/value table lookup to allow BSP-specific flags/options
  *   to be set for various resource types.  Meanings are all platform-defined.
  *
+ *   Also holds the startup limits on the number of objects of each resource type.
+ *
  */
 
 #include "osapi-idmap.h"
@@ -61,3 +63,37 @@ uint32 OS_BSP_GetResourceTypeConfig(uint32 ResourceType)
 
     return ConfigOptionValue;
 }
+
+/* ---------------------------------------------------------
+    OS_BSP_SetResourceTypeLimit()
+
+    Helper function to set the startup object limit for a resource type.
+   --------------------------------------------------------- */
+void OS_BSP_SetResourceTypeLimit(uint32 ResourceType, uint32 MaxCount)
+{
+    if (ResourceType < OS_OBJECT_TYPE_USER)
+    {
+        OS_BSP_Global.ResourceLimit[ResourceType] = MaxCount;
+    }
+}
+
+/* ---------------------------------------------------------
+    OS_BSP_GetResourceTypeLimit()
+
+    Helper function to get the startup object limit for a resource type.
+   --------------------------------------------------------- */
+uint32 OS_BSP_GetResourceTypeLimit(uint32 ResourceType)
+{
+    uint32 MaxCount;
+
+    if (ResourceType < OS_OBJECT_TYPE_USER)
+    {
+        MaxCount = OS_BSP_Global.ResourceLimit[ResourceType];
+    }
+    else
+    {
+        MaxCount = 0;
+    }
+
+    return MaxCount;
+}
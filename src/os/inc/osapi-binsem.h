@@ -70,6 +70,36 @@ typedef struct
  */
 int32 OS_BinSemCreate(osal_id_t *sem_id, const char *sem_name, uint32 sem_initial_value, uint32 options);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates several binary semaphores at once
+ *
+ * Creates a binary semaphore for each name in sem_names, all with the same
+ * initial value and options.  The IDs are reserved in groups, each under a
+ * single lock of the object table, rather than one at a time.
+ *
+ * This is all-or-nothing: if any of the semaphores cannot be created, then
+ * those which were created are deleted again, and every entry in sem_ids is
+ * set to #OS_OBJECT_ID_UNDEFINED.
+ *
+ * @param[out]  sem_ids will be set to the non-zero IDs of the newly-created resources @nonnull
+ * @param[in]   sem_names the names of the new resources to create, must all be unique @nonnull
+ * @param[in]   count the number of entries in sem_ids and sem_names @nonzero
+ * @param[in]   sem_initial_value the initial value of the binary semaphores
+ * @param[in]   options Reserved for future use, should be passed as 0.
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if sem_ids, sem_names, or any of the names are NULL
+ * @retval #OS_ERR_INVALID_SIZE if count is zero
+ * @retval #OS_ERR_NAME_TOO_LONG any name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if there are not enough free semaphore ids
+ * @retval #OS_ERR_NAME_TAKEN if any name is already the name of a binary semaphore
+ * @retval #OS_SEM_FAILURE if the OS call failed @covtest
+ */
+int32 OS_BinSemCreateBatch(osal_id_t *sem_ids, const char *const *sem_names, uint32 count, uint32 sem_initial_value,
+                           uint32 options);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Unblock all tasks pending on the specified semaphore
@@ -160,6 +190,29 @@ int32 OS_BinSemTimedWait(osal_id_t sem_id, uint32 msecs);
  */
 int32 OS_BinSemDelete(osal_id_t sem_id);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Deletes several binary semaphores at once
+ *
+ * Deletes each binary semaphore in sem_ids, as OS_BinSemDelete() would.  The
+ * semaphores are locked and released in groups, each under a single lock of the
+ * object table, which makes this suitable for releasing resources at shutdown.
+ *
+ * An ID which is not valid does not stop the remaining semaphores from being
+ * deleted, but the first error encountered is returned.
+ *
+ * @param[in] sem_ids The object IDs to delete @nonnull
+ * @param[in] count   The number of entries in sem_ids @nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if sem_ids is NULL
+ * @retval #OS_ERR_INVALID_SIZE if count is zero
+ * @retval #OS_ERR_INVALID_ID if any id passed in is not a valid binary semaphore
+ * @retval #OS_SEM_FAILURE if an unspecified failure occurs @covtest
+ */
+int32 OS_BinSemDeleteBatch(const osal_id_t *sem_ids, uint32 count);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Find an existing semaphore ID by name
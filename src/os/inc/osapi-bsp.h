@@ -56,6 +56,29 @@ void OS_BSP_SetResourceTypeConfig(uint32 ResourceType, uint32 ConfigOptionValue)
  ------------------------------------------------------------------*/
 uint32 OS_BSP_GetResourceTypeConfig(uint32 ResourceType);
 
+/*----------------------------------------------------------------
+
+    Purpose: Sets the maximum number of objects of the given resource type
+             that OSAL will allow to exist at once.  This must be called prior
+             to OS_API_Init() to take effect.  A value of 0 selects the default,
+             which is the compile-time OS_MAX_* limit for that type.
+
+             The object tables are allocated by OS_API_Init() to hold the
+             configured number of objects of each type, so the memory used
+             by OSAL follows these limits.  Queues and file descriptors are
+             also members of the OS_FdSet, which is sized at compile time, so
+             their limit cannot be raised above the compile-time value, and a
+             higher value is treated as the compile-time value.
+ ------------------------------------------------------------------*/
+void OS_BSP_SetResourceTypeLimit(uint32 ResourceType, uint32 MaxCount);
+
+/*----------------------------------------------------------------
+
+    Purpose: Gets the maximum number of objects of the given resource type
+             as set by OS_BSP_SetResourceTypeLimit(), or 0 if not set.
+ ------------------------------------------------------------------*/
+uint32 OS_BSP_GetResourceTypeLimit(uint32 ResourceType);
+
 /*----------------------------------------------------------------
 
     Purpose: Obtain the number of boot arguments passed from the bootloader
@@ -130,6 +130,69 @@ int32 OS_CountSemTake(osal_id_t sem_id);
  */
 int32 OS_CountSemTimedWait(osal_id_t sem_id, uint32 msecs);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Increment the semaphore value by several units at once
+ *
+ * This is equivalent to calling OS_CountSemGive() count times, but the units are
+ * added as a single operation.  Any tasks which may then complete a take are
+ * woken together.
+ *
+ * @param[in] sem_id The object ID to operate on
+ * @param[in] count  The number of units to give, must be nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a counting semaphore
+ * @retval #OS_INVALID_SEM_VALUE if count is zero, or the value would exceed the limit of the implementation
+ * @retval #OS_ERR_NOT_IMPLEMENTED @copybrief OS_ERR_NOT_IMPLEMENTED
+ * @retval #OS_SEM_FAILURE if an unspecified implementation error occurs @covtest
+ */
+int32 OS_CountSemGiveN(osal_id_t sem_id, uint32 count);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Decrement the semaphore value by several units at once
+ *
+ * If the semaphore value is less than count, the calling thread shall
+ * not return from the call until the value reaches count, and then all
+ * the units are taken together.  No units are taken until they are all
+ * available, so two tasks each taking several units cannot deadlock by
+ * holding a part of what they need.
+ *
+ * @param[in] sem_id The object ID to operate on
+ * @param[in] count  The number of units to take, must be nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID the Id passed in is not a valid counting semaphore
+ * @retval #OS_INVALID_SEM_VALUE if count is zero
+ * @retval #OS_ERR_NOT_IMPLEMENTED @copybrief OS_ERR_NOT_IMPLEMENTED
+ * @retval #OS_SEM_FAILURE if an unspecified implementation error occurs @covtest
+ */
+int32 OS_CountSemTakeN(osal_id_t sem_id, uint32 count);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Decrement the semaphore value by several units at once, with timeout
+ *
+ * As OS_CountSemTakeN(), but the wait shall be terminated when the specified
+ * timeout, msecs, expires.  No units are taken in that case.
+ *
+ * @param[in] sem_id The object ID to operate on
+ * @param[in] count  The number of units to take, must be nonzero
+ * @param[in] msecs  The maximum amount of time to block, in milliseconds
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_SEM_TIMEOUT if the units were not all available in time
+ * @retval #OS_ERR_INVALID_ID if the ID passed in is not a valid semaphore ID
+ * @retval #OS_INVALID_SEM_VALUE if count is zero
+ * @retval #OS_ERR_NOT_IMPLEMENTED @copybrief OS_ERR_NOT_IMPLEMENTED
+ * @retval #OS_SEM_FAILURE if an unspecified implementation error occurs @covtest
+ */
+int32 OS_CountSemTimedWaitN(osal_id_t sem_id, uint32 count, uint32 msecs);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Deletes the specified counting Semaphore.
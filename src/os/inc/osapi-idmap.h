@@ -27,6 +27,7 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-clock.h"
 
 /* Defines constants for making object ID's unique */
 #define OS_OBJECT_INDEX_MASK 0xFFFF /**< @brief Object index mask */
@@ -53,6 +54,17 @@
 #define OS_OBJECT_TYPE_USER        0x10 /**< @brief Object user type */
 /**@}*/
 
+/** @brief Contention statistics for the table lock of an object type */
+typedef struct
+{
+    uint32    acquisitions;           /**< @brief Number of times the table lock was acquired */
+    uint32    contended_acquisitions; /**< @brief Number of acquisitions where the lock was already held */
+    OS_time_t total_wait_time;        /**< @brief Total time spent waiting to acquire the lock */
+    OS_time_t max_wait_time;          /**< @brief Longest single wait to acquire the lock */
+    OS_time_t total_hold_time;        /**< @brief Total time the lock was held */
+    OS_time_t max_hold_time;          /**< @brief Longest single period the lock was held */
+} OS_lock_stats_t;
+
 /** @defgroup OSAPIObjUtil OSAL Object ID Utility APIs
  * @{
  */
@@ -251,6 +263,11 @@ int32 OS_ObjectIdToArrayIndex(osal_objtype_t idtype, osal_id_t object_id, osal_i
  * Loops through all defined OSAL objects of all types and calls callback_ptr on each one
  * If creator_id is nonzero then only objects with matching creator id are processed.
  *
+ * The matching IDs are collected in small batches while holding the table lock
+ * for each type, and the callback is invoked with no lock held.  The callback may
+ * therefore call other OSAL functions, including deleting the object, but an object
+ * created or deleted during the iteration may or may not be seen.
+ *
  * @param[in]  creator_id   Filter objects to those created by a specific task
  *                          This may be passed as OS_OBJECT_CREATOR_ANY to return all objects
  * @param[in]  callback_ptr Function to invoke for each matching object ID
@@ -265,6 +282,8 @@ void OS_ForEachObject(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void
  * Loops through all defined OSAL objects of a specific type and calls callback_ptr on each one
  * If creator_id is nonzero then only objects with matching creator id are processed.
  *
+ * As with OS_ForEachObject(), the callback is invoked with no lock held.
+ *
  * @param[in]  objtype      The type of objects to iterate
  * @param[in]  creator_id   Filter objects to those created by a specific task
  *                          This may be passed as OS_OBJECT_CREATOR_ANY to return all objects
@@ -274,6 +293,68 @@ void OS_ForEachObject(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void
 void OS_ForEachObjectOfType(osal_objtype_t objtype, osal_id_t creator_id, OS_ArgCallback_t callback_ptr,
                             void *callback_arg);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief call the supplied callback function for all valid object IDs, without locking
+ *
+ * Equivalent to OS_ForEachObject(), except the object tables are read without taking
+ * any lock, so this never delays (or is delayed by) other tasks creating, deleting or
+ * using objects.  This is intended for periodic monitoring, such as housekeeping
+ * telemetry, where an occasional missed or stale entry is acceptable.
+ *
+ * An object being created or deleted concurrently may or may not be seen, and
+ * an ID passed to the callback may no longer be valid by the time it is used.
+ *
+ * @note This requires the atomic object access enabled by OSAL_CONFIG_LOCKFREE_REFCOUNT.
+ * If that is not available, this behaves the same as OS_ForEachObject().
+ *
+ * @param[in]  creator_id   Filter objects to those created by a specific task
+ *                          This may be passed as OS_OBJECT_CREATOR_ANY to return all objects
+ * @param[in]  callback_ptr Function to invoke for each matching object ID
+ * @param[in]  callback_arg Opaque Argument to pass to callback function (may be NULL)
+ */
+void OS_ForEachObjectNonBlocking(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void *callback_arg);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief call the supplied callback function for valid object IDs of a specific type, without locking
+ *
+ * Equivalent to OS_ForEachObjectOfType(), except the object table is read without
+ * taking any lock.  See OS_ForEachObjectNonBlocking() for details.
+ *
+ * @param[in]  objtype      The type of objects to iterate
+ * @param[in]  creator_id   Filter objects to those created by a specific task
+ *                          This may be passed as OS_OBJECT_CREATOR_ANY to return all objects
+ * @param[in]  callback_ptr Function to invoke for each matching object ID
+ * @param[in]  callback_arg Opaque Argument to pass to callback function (may be NULL)
+ */
+void OS_ForEachObjectOfTypeNonBlocking(osal_objtype_t objtype, osal_id_t creator_id, OS_ArgCallback_t callback_ptr,
+                                       void *callback_arg);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain contention statistics for the table lock of an object type
+ *
+ * OSAL serializes the creation, deletion and most other operations on objects
+ * of the same type through a lock on the table for that type.  This returns
+ * the number of times the lock has been acquired, how many of those found it
+ * already held, and the time spent waiting for and holding the lock.  Times are
+ * measured using the monotonic clock.
+ *
+ * These statistics are only collected if OSAL is built with the
+ * OSAL_CONFIG_OBJECT_LOCK_STATS option enabled.
+ *
+ * @param[in]  objtype  The object type to query, see @ref OSObjectTypes
+ * @param[out] stats    Buffer to store the statistics @nonnull
+ *
+ * @returns Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the stats pointer is NULL
+ * @retval #OS_ERR_INVALID_ID if the object type is not valid
+ * @retval #OS_ERR_NOT_IMPLEMENTED if lock statistics are not enabled in this build
+ */
+int32 OS_GetObjectTypeLockStats(osal_objtype_t objtype, OS_lock_stats_t *stats);
+
 /**@}*/
 
 #endif /* OSAPI_IDMAP_H */
@@ -27,14 +27,93 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-clock.h"
+
+/**
+ * @brief Requests OS_MutSemCreate() to spin for a while before blocking
+ *
+ * When supplied in the "options" argument to OS_MutSemCreate(), a task which
+ * finds the mutex held first spins, retrying for a bounded time before it
+ * blocks.  This avoids the cost of sleeping and being woken when the mutex only
+ * guards short critical sections, and is usually released within that time.
+ * A task which does block still gets the normal priority inheritance.
+ *
+ * The time to spin may be given with #OS_MUTEX_SPIN_USEC, otherwise it is
+ * #OS_MUTEX_DEFAULT_SPIN_USEC.  The number of takes which had to spin or block
+ * are reported by OS_MutSemGetInfo(), to help tune this.
+ *
+ * @note This currently only has an effect on POSIX, and not on a system with
+ * a single processor, where spinning could never succeed.  It is ignored by
+ * other implementations.
+ */
+#define OS_MUTEX_FLAG_ADAPTIVE 0x00000001
+
+/**
+ * @brief The time a mutex created with #OS_MUTEX_FLAG_ADAPTIVE spins, if not specified
+ */
+#define OS_MUTEX_DEFAULT_SPIN_USEC 20
+
+/**
+ * @brief Gives the time in microseconds (up to 65535) that a mutex created with
+ * #OS_MUTEX_FLAG_ADAPTIVE spins before blocking
+ *
+ * The result is combined with the flag in the "options" argument to OS_MutSemCreate(),
+ * e.g. (OS_MUTEX_FLAG_ADAPTIVE | OS_MUTEX_SPIN_USEC(5)).
+ */
+#define OS_MUTEX_SPIN_USEC(usec) (((uint32)(usec)&0xFFFF) << 16)
+
+/**
+ * @brief Requests OS_MutSemCreate() to use the priority ceiling protocol
+ *
+ * When supplied in the "options" argument to OS_MutSemCreate(), a task which
+ * takes the mutex immediately runs at the ceiling priority, given with
+ * #OS_MUTEX_CEILING, until it gives the mutex back.  The ceiling should be the
+ * highest priority of any task which takes the mutex.  A task holding the mutex
+ * then cannot be preempted by another task which might take it, so a task waiting
+ * for the mutex is blocked by at most one critical section, rather than by a chain
+ * of priority boosts as with the default priority inheritance.
+ *
+ * A task with a higher priority than the ceiling may not take the mutex, and
+ * OS_MutSemTake() fails with #OS_SEM_FAILURE.  On POSIX this includes the thread
+ * which called OS_API_Init(), as it runs above all task priorities.
+ *
+ * @note This currently only has an effect on POSIX, where the ceiling is mapped
+ * to a local priority in the same way as task priorities, and on RTEMS.  On POSIX
+ * it also requires that task priorities are in effect, i.e. that the process has
+ * permission to use the realtime scheduler, otherwise priority inheritance is used.
+ * It is ignored by other implementations.
+ */
+#define OS_MUTEX_FLAG_PRIO_CEILING 0x00000002
+
+/**
+ * @brief Gives the ceiling priority of a mutex created with #OS_MUTEX_FLAG_PRIO_CEILING
+ *
+ * The result is combined with the flag in the "options" argument to OS_MutSemCreate(),
+ * e.g. (OS_MUTEX_FLAG_PRIO_CEILING | OS_MUTEX_CEILING(10)).  The priority is an
+ * #osal_priority_t, with zero being the highest, as for OS_TaskCreate().
+ */
+#define OS_MUTEX_CEILING(prio) (((uint32)(prio)&0xFF) << 8)
 
 /** @brief OSAL mutex properties */
 typedef struct
 {
     char      name[OS_MAX_API_NAME];
     osal_id_t creator;
+    uint32    spin_count;  /**< Takes which found the mutex held and acquired it while spinning */
+    uint32    block_count; /**< Takes which found the mutex held and had to block */
 } OS_mut_sem_prop_t;
 
+/** @brief Contention and hold time statistics for a mutex */
+typedef struct
+{
+    uint32    take_count;      /**< @brief Number of times the mutex was taken */
+    uint32    contended_count; /**< @brief Number of takes which found the mutex held by another task */
+    OS_time_t total_wait_time; /**< @brief Total time spent waiting by the contended takes */
+    OS_time_t max_wait_time;   /**< @brief Longest time a take waited for the mutex */
+    OS_time_t max_hold_time;   /**< @brief Longest time from a take of the mutex to the matching give */
+    osal_id_t max_hold_task;   /**< @brief The task which held the mutex for max_hold_time */
+} OS_mut_sem_stats_t;
+
 /** @defgroup OSAPIMutex OSAL Mutex APIs
  * @{
  */
@@ -47,7 +126,8 @@ typedef struct
  *
  * @param[out]  sem_id will be set to the non-zero ID of the newly-created resource @nonnull
  * @param[in]   sem_name the name of the new resource to create @nonnull
- * @param[in]   options reserved for future use.  Should be passed as 0.
+ * @param[in]   options 0, or #OS_MUTEX_FLAG_ADAPTIVE optionally with #OS_MUTEX_SPIN_USEC,
+ *                      and/or #OS_MUTEX_FLAG_PRIO_CEILING with #OS_MUTEX_CEILING
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -135,7 +215,8 @@ int32 OS_MutSemGetIdByName(osal_id_t *sem_id, const char *sem_name);
  *
  * This function will pass back a pointer to structure that contains
  * all of the relevant info( name and creator) about the specified mutex
- * semaphore.
+ * semaphore.  For a mutex created with #OS_MUTEX_FLAG_ADAPTIVE, this also
+ * counts the takes which had to spin or block.
  *
  * @param[in]  sem_id The object ID to operate on
  * @param[out] mut_prop The property object buffer to fill @nonnull
@@ -146,6 +227,48 @@ int32 OS_MutSemGetIdByName(osal_id_t *sem_id, const char *sem_name);
  * @retval #OS_INVALID_POINTER if the mut_prop pointer is null
  */
 int32 OS_MutSemGetInfo(osal_id_t sem_id, OS_mut_sem_prop_t *mut_prop);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain contention and hold time statistics for a mutex
+ *
+ * This returns the number of times the mutex was taken, how many of those takes
+ * found it held by another task, the total and longest time spent waiting, and
+ * the longest time it was held along with the task which held it.  Times are
+ * measured using the monotonic clock.
+ *
+ * The statistics are updated by the task holding the mutex, and read without
+ * taking it, so the values may be slightly inconsistent with each other while
+ * the mutex is in use.
+ *
+ * These statistics are only collected if OSAL is built with the
+ * OSAL_CONFIG_MUTEX_STATS option enabled.
+ *
+ * @param[in]  sem_id The object ID to operate on
+ * @param[out] stats  Buffer to store the statistics @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if stats is NULL
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid mutex
+ * @retval #OS_ERR_NOT_IMPLEMENTED if mutex statistics are not enabled in this build
+ */
+int32 OS_MutSemGetStats(osal_id_t sem_id, OS_mut_sem_stats_t *stats);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reset the statistics for a mutex
+ *
+ * All counts and times are cleared.
+ *
+ * @param[in] sem_id The object ID to operate on
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid mutex
+ * @retval #OS_ERR_NOT_IMPLEMENTED if mutex statistics are not enabled in this build
+ */
+int32 OS_MutSemResetStats(osal_id_t sem_id);
 /**@}*/
 
 #endif /* OSAPI_MUTEX_H */
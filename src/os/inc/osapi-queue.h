@@ -27,6 +27,91 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-clock.h"
+
+/**
+ * @brief Requests OS_QueueCreate() to hold the queue in process memory
+ *
+ * When supplied in the "flags" argument to OS_QueueCreate(), this indicates
+ * that the queue will only be used within this process, so it need not be
+ * backed by an operating system message queue.  Such a queue is not subject
+ * to system-wide limits on queue depth, and messages can usually be passed
+ * without a system call.
+ *
+ * @note This currently only has an effect on POSIX, and only when the
+ * OSAL_CONFIG_QUEUE_RINGBUFFER option is disabled; otherwise all queues are
+ * already held in process memory.  It is ignored by other implementations.
+ */
+#define OS_QUEUE_FLAG_LOCAL 0x00000001
+
+/**
+ * @brief Indicates to OS_QueueCreate() that the queue has a single producer and consumer
+ *
+ * When supplied in the "flags" argument to OS_QueueCreate(), this indicates
+ * that at most one task will put messages on the queue, and at most one task
+ * will get messages from it, at any given time.  This permits a wait-free
+ * implementation in which a put or get is only a few atomic operations, and a
+ * system call is only made to wake a task which is actually waiting.
+ *
+ * The message priority may be ignored for such a queue, in which case all
+ * messages are received in the order they were put.
+ *
+ * @note This currently only has an effect on POSIX, where it also implies
+ * #OS_QUEUE_FLAG_LOCAL.  It is ignored by other implementations.
+ */
+#define OS_QUEUE_FLAG_SPSC 0x00000002
+
+/**
+ * @brief Indicates to OS_QueueCreate() that every message is delivered to each subscriber
+ *
+ * When supplied in the "flags" argument to OS_QueueCreate(), this creates a
+ * broadcast queue.  Messages are not received from a broadcast queue itself,
+ * but through subscriber queues created with OS_QueueSubscribe().  Each
+ * message put is copied once into the broadcast queue, and each subscriber
+ * then receives it from there in turn, at its own pace.
+ *
+ * The queue depth limits how far any subscriber may fall behind the producer.
+ * A message put while there are no subscribers is discarded.  The message
+ * priority is ignored, and all messages are received in the order they were put.
+ *
+ * @note This is currently only implemented on POSIX, where it also implies
+ * #OS_QUEUE_FLAG_LOCAL.  On other implementations OS_QueueSubscribe() is
+ * not implemented.
+ */
+#define OS_QUEUE_FLAG_BROADCAST 0x00000004
+
+/**
+ * @brief Indicates to OS_QueueSubscribe() that the oldest messages are dropped if the subscriber falls behind
+ *
+ * By default, a producer putting a message on a broadcast queue is held up (as
+ * if the queue were full) by any subscriber which has not yet received the
+ * oldest message still held.  When supplied in the "flags" argument to
+ * OS_QueueSubscribe(), this indicates that the subscriber should instead lose
+ * its oldest unreceived message, so that it never holds up the producer.
+ */
+#define OS_QUEUE_FLAG_DROP_OLDEST 0x00000008
+
+/**
+ * @brief The number of message priority levels
+ *
+ * Messages of a higher priority are received before any of a lower priority,
+ * and messages of the same priority are received in the order they were put.
+ */
+#define OS_QUEUE_PRIORITY_LEVELS 8
+
+/** @brief Position of the message priority in the flags of OS_QueuePut() and similar calls */
+#define OS_QUEUE_PRIORITY_SHIFT 24
+
+/**
+ * @brief Selects the priority of a message, for the flags of OS_QueuePut() and similar calls
+ *
+ * Priority 0 is the default, and (#OS_QUEUE_PRIORITY_LEVELS - 1) is the most urgent.
+ *
+ * @note VxWorks and RTEMS only distinguish normal and urgent messages.  On these
+ * systems any nonzero priority puts the message at the front of the queue, and
+ * the priority is not reported on receipt.
+ */
+#define OS_QUEUE_PRIORITY(prio) ((uint32)(prio) << OS_QUEUE_PRIORITY_SHIFT)
 
 /** @brief OSAL queue properties */
 typedef struct
@@ -35,6 +120,29 @@ typedef struct
     osal_id_t creator;
 } OS_queue_prop_t;
 
+/**
+ * @brief The number of buckets in the queue latency histogram
+ *
+ * Bucket 0 counts latencies of less than 1 microsecond, and bucket N counts
+ * latencies from 2^(N-1) up to 2^N microseconds.  The last bucket also counts
+ * anything longer.
+ */
+#define OS_QUEUE_LATENCY_BUCKETS 24
+
+/** @brief Occupancy and latency statistics for a queue */
+typedef struct
+{
+    uint32    depth;           /**< @brief Number of messages currently in the queue */
+    uint32    high_water_mark; /**< @brief Largest number of messages held at once */
+    uint32    put_count;       /**< @brief Number of messages put on the queue */
+    uint32    get_count;       /**< @brief Number of messages received from the queue */
+    uint32    full_count;      /**< @brief Number of times a put failed because the queue was full */
+    uint32    timeout_count;   /**< @brief Number of puts or gets which timed out */
+    uint32    drop_count;      /**< @brief Number of messages a broadcast subscriber lost by falling behind */
+    OS_time_t max_latency;     /**< @brief Longest time from put to receipt of a message */
+    uint32    latency_histogram[OS_QUEUE_LATENCY_BUCKETS]; /**< @brief Count of messages by time from put to receipt */
+} OS_queue_stats_t;
+
 /** @defgroup OSAPIMsgQueue OSAL Message Queue APIs
  * @{
  */
@@ -52,7 +160,7 @@ typedef struct
  * @param[in]   queue_name the name of the new resource to create @nonnull
  * @param[in]   queue_depth the maximum depth of the queue
  * @param[in]   data_size the size of each entry in the queue @nonzero
- * @param[in]   flags options for the queue (reserved for future use, pass as 0)
+ * @param[in]   flags options for the queue, such as #OS_QUEUE_FLAG_LOCAL (pass as 0 for defaults)
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -67,6 +175,109 @@ typedef struct
 int32 OS_QueueCreate(osal_id_t *queue_id, const char *queue_name, osal_blockcount_t queue_depth, size_t data_size,
                      uint32 flags);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Create a message queue which packs messages by their actual size
+ *
+ * This creates a queue as OS_QueueCreate() does, except that the memory held
+ * by the queue is bounded by a total number of bytes rather than a number of
+ * messages.  Each message only takes as much of this budget as its own size,
+ * plus a small header, so a queue which usually carries small messages but
+ * must occasionally carry a large one does not need to reserve the largest
+ * size for every message.
+ *
+ * The number of messages held at once is limited only by the byte budget.
+ * Messages are always received in the order they were put; the message
+ * priority is ignored, and is reported as 0 on receipt.  Messages cannot be
+ * built or read in place, so OS_QueueReserve() and OS_QueueGetRef() are not
+ * implemented for such a queue.
+ *
+ * @note Implementations that cannot pack messages instead create a queue of
+ * fixed size entries, as many as fit within the byte budget, so the memory
+ * used is still bounded by the budget.
+ *
+ * @param[out]  queue_id will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]   queue_name the name of the new resource to create @nonnull
+ * @param[in]   byte_budget the total number of bytes which may be used to hold messages
+ * @param[in]   max_size the size of the largest message which may be put on the queue @nonzero
+ * @param[in]   flags options for the queue, such as #OS_QUEUE_FLAG_LOCAL (pass as 0 for defaults)
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if there are already the max queues created
+ * @retval #OS_ERR_NAME_TAKEN if the name is already being used on another queue
+ * @retval #OS_ERR_INVALID_SIZE if max_size is 0
+ * @retval #OS_QUEUE_INVALID_SIZE if the byte budget cannot hold a message of max_size
+ * @retval #OS_ERROR if the OS create call fails
+ */
+int32 OS_QueueCreatePacked(osal_id_t *queue_id, const char *queue_name, size_t byte_budget, size_t max_size,
+                           uint32 flags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Create several message queues at once
+ *
+ * Creates a queue for each name in queue_names, all with the same depth, entry
+ * size and flags.  The IDs are reserved in groups, each under a single lock of
+ * the object table, rather than one at a time.
+ *
+ * This is all-or-nothing: if any of the queues cannot be created, then those
+ * which were created are deleted again, and every entry in queue_ids is set to
+ * #OS_OBJECT_ID_UNDEFINED.
+ *
+ * @param[out]  queue_ids will be set to the non-zero IDs of the newly-created resources @nonnull
+ * @param[in]   queue_names the names of the new resources to create, must all be unique @nonnull
+ * @param[in]   count the number of entries in queue_ids and queue_names @nonzero
+ * @param[in]   queue_depth the maximum depth of each queue
+ * @param[in]   data_size the size of each entry in the queues @nonzero
+ * @param[in]   flags options for the queues, such as #OS_QUEUE_FLAG_LOCAL (pass as 0 for defaults)
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if a pointer passed in, or any of the names, is NULL
+ * @retval #OS_ERR_NAME_TOO_LONG any name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if there are not enough free queue ids
+ * @retval #OS_ERR_NAME_TAKEN if any name is already being used on another queue
+ * @retval #OS_ERR_INVALID_SIZE if data_size or count is 0
+ * @retval #OS_QUEUE_INVALID_SIZE if the queue depth exceeds the limit
+ * @retval #OS_ERROR if the OS create call fails
+ */
+int32 OS_QueueCreateBatch(osal_id_t *queue_ids, const char *const *queue_names, uint32 count,
+                          osal_blockcount_t queue_depth, size_t data_size, uint32 flags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Create a subscriber to a broadcast queue
+ *
+ * Creates a new queue, which receives every message put on the given broadcast
+ * queue (created with #OS_QUEUE_FLAG_BROADCAST) from now on.  Messages are
+ * received from the subscriber queue with OS_QueueGet() and similar calls, and
+ * it may be waited on with OS_SelectMultiple(), but nothing can be put on it.
+ * It has the same maximum message size as the broadcast queue.
+ *
+ * The subscriber is removed by deleting it with OS_QueueDelete().  The broadcast
+ * queue cannot be deleted while it has any subscribers.
+ *
+ * @param[out]  queue_id will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]   queue_name the name of the new resource to create @nonnull
+ * @param[in]   broadcast_id the broadcast queue to subscribe to
+ * @param[in]   flags options for the subscriber, such as #OS_QUEUE_FLAG_DROP_OLDEST (pass as 0 for defaults)
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_INVALID_ID if broadcast_id does not exist, or is being deleted
+ * @retval #OS_ERR_NO_FREE_IDS if there are already the max queues created
+ * @retval #OS_ERR_NAME_TAKEN if the name is already being used on another queue
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if broadcast_id is not a broadcast queue
+ * @retval #OS_ERR_NOT_IMPLEMENTED if broadcast queues are not supported by the implementation
+ * @retval #OS_ERROR if the OS call returns an unexpected error
+ */
+int32 OS_QueueSubscribe(osal_id_t *queue_id, const char *queue_name, osal_id_t broadcast_id, uint32 flags);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Deletes the specified message queue.
@@ -77,15 +288,45 @@ int32 OS_QueueCreate(osal_id_t *queue_id, const char *queue_name, osal_blockcoun
  * @note If There are messages on the queue, they will be lost and any subsequent
  * calls to QueueGet or QueuePut to this queue will result in errors
  *
+ * @note Where the implementation supports it, any task blocked in a get or put on the
+ * queue is woken and returns #OS_ERR_INVALID_ID, and any task waiting on it in
+ * OS_SelectMultiple() sees the queue as ready.  This call returns once they have done so,
+ * and once any other call in progress on the queue has returned.
+ *
  * @param[in] queue_id The object ID to delete
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
  * @retval #OS_ERR_INVALID_ID if the id passed in does not exist
+ * @retval #OS_ERR_OBJECT_IN_USE if the queue is a broadcast queue which still has subscribers
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if entries of the queue are still reserved or referenced
  * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
  */
 int32 OS_QueueDelete(osal_id_t queue_id);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Deletes several message queues at once
+ *
+ * Deletes each queue in queue_ids, as OS_QueueDelete() would.  The queues are
+ * locked and released in groups, each under a single lock of the object table,
+ * which makes this suitable for releasing resources at shutdown.
+ *
+ * An ID which is not valid does not stop the remaining queues from being
+ * deleted, but the first error encountered is returned.
+ *
+ * @param[in] queue_ids The object IDs to delete @nonnull
+ * @param[in] count     The number of entries in queue_ids @nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if queue_ids is NULL
+ * @retval #OS_ERR_INVALID_SIZE if count is zero
+ * @retval #OS_ERR_INVALID_ID if any id passed in does not exist
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueDeleteBatch(const osal_id_t *queue_ids, uint32 count);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Receive a message on a message queue
@@ -106,10 +347,38 @@ int32 OS_QueueDelete(osal_id_t queue_id);
  * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
  * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
  * @retval #OS_QUEUE_INVALID_SIZE if the size copied from the queue was not correct
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the queue is a broadcast queue, received through its subscribers
  * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
  */
 int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copied, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Receive a message on a message queue, along with its priority
+ *
+ * This API is identical to OS_QueueGet() except that the priority the message
+ * was put with is also output.  Messages are always received in priority order,
+ * whichever call is used.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  data The buffer to store the received message @nonnull
+ * @param[in]   size The size of the data buffer @nonzero
+ * @param[out]  size_copied Set to the actual size of the message @nonnull
+ * @param[out]  priority Set to the priority of the message, see #OS_QUEUE_PRIORITY @nonnull
+ * @param[in]   timeout The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_QUEUE_INVALID_SIZE if the size copied from the queue was not correct
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueGetWithPriority(osal_id_t queue_id, void *data, size_t size, size_t *size_copied, uint32 *priority,
+                              int32 timeout);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Put a message on a message queue.
@@ -117,18 +386,244 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
  * @param[in]  queue_id The object ID to operate on
  * @param[in]  data The buffer containing the message to put @nonnull
  * @param[in]  size The size of the data buffer @nonzero
- * @param[in]  flags Currently reserved/unused, should be passed as 0
+ * @param[in]  flags The message priority, as #OS_QUEUE_PRIORITY (pass as 0 for defaults)
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
  * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
  * @retval #OS_INVALID_POINTER if the data pointer is NULL
+ * @retval #OS_ERR_INVALID_ARGUMENT if the message priority is not valid
  * @retval #OS_QUEUE_INVALID_SIZE if the data message is too large for the queue
  * @retval #OS_QUEUE_FULL if the queue cannot accept another message
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the queue is a subscriber to a broadcast queue
  * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
  */
 int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flags);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Put a message on a message queue, waiting for space if it is full
+ *
+ * This API is identical to OS_QueuePut() except that if the queue is full, the
+ * calling task will block until another task receives a message from the queue
+ * or the timeout expires.  This allows a producer to be throttled to the rate
+ * of the consumer, rather than having to retry or discard the message.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data The buffer containing the message to put @nonnull
+ * @param[in]  size The size of the data buffer @nonzero
+ * @param[in]  flags The message priority, as #OS_QUEUE_PRIORITY (pass as 0 for defaults)
+ * @param[in]  timeout The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @sa OS_QueuePutAbs()
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the data pointer is NULL
+ * @retval #OS_ERR_INVALID_ARGUMENT if the message priority is not valid
+ * @retval #OS_QUEUE_INVALID_SIZE if the data message is too large for the queue
+ * @retval #OS_QUEUE_FULL if the queue is full and the timeout was OS_CHECK
+ * @retval #OS_QUEUE_TIMEOUT if the queue remained full until the timeout expired
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueuePutTimed(osal_id_t queue_id, const void *data, size_t size, uint32 flags, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Put a message on a message queue, waiting for space until an absolute time
+ *
+ * This API is identical to OS_QueuePutTimed() except for the timeout parameter.  In
+ * this call, timeout is expressed as an absolute value of the OS clock, in the same
+ * time domain as obtained via OS_GetLocalTime().  This allows a deadline to be kept
+ * across several calls.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data The buffer containing the message to put @nonnull
+ * @param[in]  size The size of the data buffer @nonzero
+ * @param[in]  flags The message priority, as #OS_QUEUE_PRIORITY (pass as 0 for defaults)
+ * @param[in]  abs_timeout The absolute time that the call may block until
+ *
+ * @sa OS_QueuePutTimed()
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the data pointer is NULL
+ * @retval #OS_ERR_INVALID_ARGUMENT if the message priority is not valid
+ * @retval #OS_QUEUE_INVALID_SIZE if the data message is too large for the queue
+ * @retval #OS_QUEUE_FULL if the queue is full and abs_timeout has already passed
+ * @retval #OS_QUEUE_TIMEOUT if the queue remained full until abs_timeout
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueuePutAbs(osal_id_t queue_id, const void *data, size_t size, uint32 flags, OS_time_t abs_timeout);
+
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Receive several messages on a message queue
+ *
+ * Messages are stored in an array of max_count buffers of "size" bytes each,
+ * starting at "data", and the size of each message is stored in the
+ * corresponding entry of "sizes".
+ *
+ * If no message is pending, the calling task will block until one arrives or
+ * the timeout expires, as in OS_QueueGet().  After the first message, any
+ * further messages which are already pending are received, up to max_count,
+ * without waiting.  This allows a burst of messages to be drained in one call.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  data The array of buffers to store the received messages @nonnull
+ * @param[in]   size The size of each buffer in the array @nonzero
+ * @param[out]  sizes Set to the actual size of each message received @nonnull
+ * @param[in]   max_count The number of buffers in the array @nonzero
+ * @param[out]  count_copied Set to the number of messages received @nonnull
+ * @param[in]   timeout The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if at least one message was received
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_INVALID_SIZE if size or max_count is 0
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_QUEUE_INVALID_SIZE if the buffer size is less than the size of the queue entries
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueGetMultiple(osal_id_t queue_id, void *data, size_t size, size_t *sizes, uint32 max_count,
+                          uint32 *count_copied, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Put several messages on a message queue
+ *
+ * Messages are taken in order from an array of "count" buffers of "size" bytes
+ * each, starting at "data".  The length of each message is given by the
+ * corresponding entry of "sizes", and must not exceed "size".
+ *
+ * If the queue becomes full, the remaining messages are not put, and the
+ * number of messages which were put is output in count_put.  Any tasks waiting
+ * on the queue are woken once for the whole group, where supported.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data The array of buffers containing the messages to put @nonnull
+ * @param[in]  size The size of each buffer in the array @nonzero
+ * @param[in]  sizes The length of each message @nonnull
+ * @param[in]  count The number of messages to put @nonzero
+ * @param[in]  flags The message priority, as #OS_QUEUE_PRIORITY (pass as 0 for defaults)
+ * @param[out] count_put Set to the number of messages put @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if all messages were put
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_INVALID_ARGUMENT if the message priority is not valid
+ * @retval #OS_ERR_INVALID_SIZE if size, count or the length of any message is 0
+ * @retval #OS_QUEUE_INVALID_SIZE if any message is too large for the queue or its buffer
+ * @retval #OS_QUEUE_FULL if the queue could not accept all of the messages
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueuePutMultiple(osal_id_t queue_id, const void *data, size_t size, const size_t *sizes, uint32 count,
+                          uint32 flags, uint32 *count_put);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reserve space for a message directly in the queue storage
+ *
+ * Outputs a pointer to the data area of the next free entry in the queue, in which
+ * the caller may build a message of up to "size" bytes.  The message is not visible
+ * to receivers until it is passed to OS_QueueCommit(), which must be done for every
+ * successful reservation.  A reserved entry counts towards the depth of the queue,
+ * and the queue cannot be deleted while any entry is reserved.
+ *
+ * This avoids copying the message, but is only available where the queue storage is
+ * accessible to the application, such as queues created with #OS_QUEUE_FLAG_LOCAL.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  data_ptr Set to the location of the message data @nonnull
+ * @param[in]   size The size of the message to be built @nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the data_ptr pointer is NULL
+ * @retval #OS_QUEUE_INVALID_SIZE if the message is too large for the queue
+ * @retval #OS_QUEUE_FULL if the queue cannot accept another message
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the queue storage is not accessible
+ */
+int32 OS_QueueReserve(osal_id_t queue_id, void **data_ptr, size_t size);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Put a message previously built in place on a message queue
+ *
+ * Completes a reservation made by OS_QueueReserve(), after which the message
+ * may be received and the caller must no longer access it.  Each reservation
+ * can only be committed once.
+ *
+ * Messages built in place are always of the default priority, as the entry is
+ * reserved before the priority would be known.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data_ptr The location of the message data, as output by OS_QueueReserve() @nonnull
+ * @param[in]  size The actual size of the message @nonzero
+ * @param[in]  flags Currently reserved, the message priority must be 0
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_ERR_INVALID_ARGUMENT if the message priority is not 0
+ * @retval #OS_INVALID_POINTER if the data_ptr is NULL or not an outstanding reservation on this queue
+ * @retval #OS_QUEUE_INVALID_SIZE if the message is too large for the queue
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the queue storage is not accessible
+ */
+int32 OS_QueueCommit(osal_id_t queue_id, void *data_ptr, size_t size, uint32 flags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Receive a message on a message queue without copying it
+ *
+ * As OS_QueueGet(), but rather than copying the message into a buffer, this
+ * outputs a pointer to the message data in the queue storage.  The entry is
+ * not reused until it is passed to OS_QueueRelease(), which must be done for
+ * every message received in this way.  The queue cannot be deleted until then.
+ *
+ * This is only available where the queue storage is accessible to the
+ * application, such as queues created with #OS_QUEUE_FLAG_LOCAL.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  data_ptr Set to the location of the message data @nonnull
+ * @param[out]  size_copied Set to the actual size of the message @nonnull
+ * @param[in]   timeout The maximum amount of time to block, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the queue storage is not accessible
+ */
+int32 OS_QueueGetRef(osal_id_t queue_id, const void **data_ptr, size_t *size_copied, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Release a message received by OS_QueueGetRef()
+ *
+ * Returns the entry holding the message to the queue, after which the
+ * caller must no longer access it.  Each message can only be released once.
+ *
+ * @param[in]  queue_id The object ID to operate on
+ * @param[in]  data_ptr The location of the message data, as output by OS_QueueGetRef() @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the queue id passed in is not a valid queue
+ * @retval #OS_INVALID_POINTER if the data_ptr is NULL or not an unreleased entry received from this queue
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the queue storage is not accessible
+ */
+int32 OS_QueueRelease(osal_id_t queue_id, const void *data_ptr);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Find an existing queue ID by name
@@ -163,6 +658,49 @@ int32 OS_QueueGetIdByName(osal_id_t *queue_id, const char *queue_name);
  * @retval #OS_ERR_INVALID_ID if the ID given is not  a valid queue
  */
 int32 OS_QueueGetInfo(osal_id_t queue_id, OS_queue_prop_t *queue_prop);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain occupancy and latency statistics for a queue
+ *
+ * This returns the number of messages put on and received from the queue,
+ * the current depth and high-water mark, and how often the queue was found
+ * full or a call timed out.  These are updated without locking, so the values
+ * may be slightly inconsistent with each other while messages are in transit.
+ *
+ * Where the implementation can carry a timestamp with each message, the time
+ * from put to receipt is also measured using the monotonic clock.  Otherwise,
+ * the latency histogram is left empty.
+ *
+ * These statistics are only collected if OSAL is built with the
+ * OSAL_CONFIG_QUEUE_STATS option enabled.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  stats Buffer to store the statistics @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if stats is NULL
+ * @retval #OS_ERR_INVALID_ID if the ID given is not a valid queue
+ * @retval #OS_ERR_NOT_IMPLEMENTED if queue statistics are not enabled in this build
+ */
+int32 OS_QueueGetStats(osal_id_t queue_id, OS_queue_stats_t *stats);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reset the statistics for a queue
+ *
+ * All counts and the latency histogram are cleared.  The depth is unaffected,
+ * and the high-water mark restarts from the current depth.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the ID given is not a valid queue
+ * @retval #OS_ERR_NOT_IMPLEMENTED if queue statistics are not enabled in this build
+ */
+int32 OS_QueueResetStats(osal_id_t queue_id);
 /**@}*/
 
 #endif /* OSAPI_QUEUE_H */
@@ -37,13 +37,14 @@
  *
  * Note: Math is to determine uint8 array size needed to represent
  *       single bit OS_MAX_NUM_OPEN_FILES objects, + 7 rounds up
- *       and 8 is the size of uint8.
+ *       and 8 is the size of uint8.  The same applies to OS_MAX_QUEUES.
  *
  * @sa OS_SelectFdZero(), OS_SelectFdAdd(), OS_SelectFdClear(), OS_SelectFdIsSet()
  */
 typedef struct
 {
     uint8 object_ids[(OS_MAX_NUM_OPEN_FILES + 7) / 8];
+    uint8 queue_ids[(OS_MAX_QUEUES + 7) / 8];
 } OS_FdSet;
 
 /**
@@ -81,6 +82,12 @@ typedef enum
  * file handle(s) to wait for.  On exit, these are set to the actual
  * file handle(s) that have activity.
  *
+ * The sets may also contain queue IDs.  A queue is readable when it holds
+ * at least one message, and writable when it has room for at least one more.
+ * Because another task may get from or put to the queue after this call
+ * returns, the application should still use a non-blocking OS_QueueGet()
+ * or OS_QueuePut() to service it.
+ *
  * If the timeout occurs this returns an error code and all output sets
  * should be empty.
  *
@@ -104,7 +111,7 @@ typedef enum
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS If any handle in the ReadSet or WriteSet is readable or writable, respectively
  * @retval #OS_ERROR_TIMEOUT If no handles in the ReadSet or WriteSet became readable or writable within the timeout
- * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if a specified handle does not support select
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if a specified handle or queue does not support select
  * @retval #OS_ERR_INVALID_ID if no valid handles were contained in the ReadSet/WriteSet
  */
 int32 OS_SelectMultipleAbs(OS_FdSet *ReadSet, OS_FdSet *WriteSet, OS_time_t abs_timeout);
@@ -124,6 +131,12 @@ int32 OS_SelectMultipleAbs(OS_FdSet *ReadSet, OS_FdSet *WriteSet, OS_time_t abs_
  * file handle(s) to wait for.  On exit, these are set to the actual
  * file handle(s) that have activity.
  *
+ * The sets may also contain queue IDs.  A queue is readable when it holds
+ * at least one message, and writable when it has room for at least one more.
+ * Because another task may get from or put to the queue after this call
+ * returns, the application should still use a non-blocking OS_QueueGet()
+ * or OS_QueuePut() to service it.
+ *
  * If the timeout occurs this returns an error code and all output sets
  * should be empty.
  *
@@ -146,7 +159,7 @@ int32 OS_SelectMultipleAbs(OS_FdSet *ReadSet, OS_FdSet *WriteSet, OS_time_t abs_
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS If any handle in the ReadSet or WriteSet is readable or writable, respectively
  * @retval #OS_ERROR_TIMEOUT If no handles in the ReadSet or WriteSet became readable or writable within the timeout
- * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if a specified handle does not support select
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if a specified handle or queue does not support select
  * @retval #OS_ERR_INVALID_ID if no valid handles were contained in the ReadSet/WriteSet
  */
 int32 OS_SelectMultiple(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
@@ -250,13 +263,15 @@ int32 OS_SelectFdZero(OS_FdSet *Set);
  *
  * After this call the set will contain the given OSAL ID
  *
+ * The ID may refer to either a stream (file or socket) or a queue.
+ *
  * @param[in,out] Set Pointer to OS_FdSet object to operate on @nonnull
- * @param[in] objid The handle ID to add to the set
+ * @param[in] objid The handle or queue ID to add to the set
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief #OS_SUCCESS
  * @retval #OS_INVALID_POINTER if argument is NULL
- * @retval #OS_ERR_INVALID_ID if the objid is not a valid handle
+ * @retval #OS_ERR_INVALID_ID if the objid is not a valid handle or queue
  */
 int32 OS_SelectFdAdd(OS_FdSet *Set, osal_id_t objid);
 
@@ -267,12 +282,12 @@ int32 OS_SelectFdAdd(OS_FdSet *Set, osal_id_t objid);
  * After this call the set will no longer contain the given OSAL ID
  *
  * @param[in,out] Set Pointer to OS_FdSet object to operate on @nonnull
- * @param[in] objid The handle ID to remove from the set
+ * @param[in] objid The handle or queue ID to remove from the set
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief #OS_SUCCESS
  * @retval #OS_INVALID_POINTER if argument is NULL
- * @retval #OS_ERR_INVALID_ID if the objid is not a valid handle
+ * @retval #OS_ERR_INVALID_ID if the objid is not a valid handle or queue
  */
 int32 OS_SelectFdClear(OS_FdSet *Set, osal_id_t objid);
 
@@ -281,7 +296,7 @@ int32 OS_SelectFdClear(OS_FdSet *Set, osal_id_t objid);
  * @brief Check if an FdSet structure contains a given ID
  *
  * @param[in] Set Pointer to OS_FdSet object to operate on @nonnull
- * @param[in] objid The handle ID to check for in the set
+ * @param[in] objid The handle or queue ID to check for in the set
  *
  * @return Boolean set status
  * @retval true  FdSet structure contains ID
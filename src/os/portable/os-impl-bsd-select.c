@@ -43,12 +43,26 @@
 #include "os-impl-select.h"
 #include "os-shared-clock.h"
 #include "os-shared-select.h"
+#include "os-shared-queue.h"
 #include "os-shared-idmap.h"
 
 /****************************************************************************************
                                      DEFINES
  ***************************************************************************************/
 
+/*
+ * Tracks the queues in an OS_SelectMultiple() call
+ */
+typedef struct
+{
+    uint32            flags[OS_MAX_QUEUES]; /**< States waited for, updated to the states detected */
+    int               fd[OS_MAX_QUEUES];    /**< Descriptor which is waited on for each queue */
+    OS_object_token_t token[OS_MAX_QUEUES]; /**< Token for each queue, held until the wait is done */
+    osal_index_t      limit;                /**< Number of queue table entries, as set at startup */
+    bool              waiting;              /**< Whether any queue descriptor was added to the fd_sets */
+    bool              ready;                /**< Whether any queue is already in a state waited for */
+} OS_QueueSelectSet_t;
+
 /***************************************************************************************
                                  FUNCTION PROTOTYPES
  **************************************************************************************/
@@ -87,7 +101,7 @@ static int32 OS_FdSet_ConvertIn_Impl(int *os_maxfd, fd_set *os_set, const OS_FdS
         while (objids != 0)
         {
             id = OSAL_INDEX_C((offset * 8) + bit);
-            if ((objids & 0x01) != 0 && id < OS_MAX_NUM_OPEN_FILES)
+            if ((objids & 0x01) != 0 && id < OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_STREAM))
             {
                 osfd = OS_impl_filehandle_table[id].fd;
                 if (osfd >= 0)
@@ -143,7 +157,7 @@ static void OS_FdSet_ConvertOut_Impl(fd_set *OS_set, OS_FdSet *OSAL_set)
         while (objids != 0)
         {
             id = OSAL_INDEX_C((offset * 8) + bit);
-            if ((objids & 0x01) != 0 && id < OS_MAX_NUM_OPEN_FILES)
+            if ((objids & 0x01) != 0 && id < OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_STREAM))
             {
                 osfd = OS_impl_filehandle_table[id].fd;
                 if (osfd < 0 || !FD_ISSET(osfd, OS_set))
@@ -157,6 +171,230 @@ static void OS_FdSet_ConvertOut_Impl(fd_set *OS_set, OS_FdSet *OSAL_set)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Gets a token for the queue at the given index.  As for other
+ *          operations on the queue, the token holds a reference to it if
+ *          the implementation requires one, so that the queue cannot be
+ *          deleted until OS_QueueSet_End_Impl() releases it.
+ *-----------------------------------------------------------------*/
+static int32 OS_QueueSet_GetToken_Impl(OS_object_token_t *token, osal_index_t id)
+{
+    int32 status;
+
+    status = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_QUEUE, OS_global_queue_table[id].active_id,
+                                token);
+    if (status == OS_SUCCESS && !OS_OBJECT_TABLE_GET(OS_queue_table, *token)->referenced)
+    {
+        OS_ObjectIdRelease(token);
+    }
+
+    return status;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Registers each queue in the OSAL sets as waiting, and adds the
+ *          descriptor to wait on for each queue to the POSIX fd_sets.
+ *
+ *          Any queues which were registered before an error must still
+ *          be passed to OS_QueueSet_End_Impl().
+ *-----------------------------------------------------------------*/
+static int32 OS_QueueSet_Begin_Impl(int *os_maxfd, fd_set *rd_set, fd_set *wr_set, OS_QueueSelectSet_t *queues,
+                                    const OS_FdSet *ReadSet, const OS_FdSet *WriteSet)
+{
+    osal_index_t id;
+    uint32       ready_flags;
+    uint32       fd_flags;
+    int32        status;
+
+    memset(queues, 0, sizeof(*queues));
+
+    /* Only the entries which may be in use are checked, the sets are sized for the build limit */
+    queues->limit = OSAL_INDEX_C(OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_QUEUE));
+    if (queues->limit > OS_MAX_QUEUES)
+    {
+        queues->limit = OSAL_INDEX_C(OS_MAX_QUEUES);
+    }
+
+    for (id = 0; id < queues->limit; ++id)
+    {
+        if (ReadSet != NULL && ((ReadSet->queue_ids[id >> 3] >> (id & 0x7)) & 0x1) != 0)
+        {
+            queues->flags[id] |= OS_STREAM_STATE_READABLE;
+        }
+        if (WriteSet != NULL && ((WriteSet->queue_ids[id >> 3] >> (id & 0x7)) & 0x1) != 0)
+        {
+            queues->flags[id] |= OS_STREAM_STATE_WRITABLE;
+        }
+        if (queues->flags[id] == 0 || !OS_ObjectIdDefined(OS_global_queue_table[id].active_id) ||
+            OS_QueueSet_GetToken_Impl(&queues->token[id], id) != OS_SUCCESS)
+        {
+            queues->flags[id] = 0;
+            continue;
+        }
+
+        ready_flags    = queues->flags[id];
+        queues->fd[id] = -1;
+        fd_flags       = 0;
+        status         = OS_QueueSelectBegin_Impl(&queues->token[id], &ready_flags, &queues->fd[id], &fd_flags);
+        if (status != OS_SUCCESS)
+        {
+            OS_ObjectIdRelease(&queues->token[id]);
+            queues->flags[id] = 0;
+            return status;
+        }
+
+        if (ready_flags != 0)
+        {
+            queues->ready = true;
+        }
+
+        if (queues->fd[id] >= FD_SETSIZE)
+        {
+            /* out of range of select() implementation */
+            return OS_ERR_OPERATION_NOT_SUPPORTED;
+        }
+
+        if (queues->fd[id] >= 0 && fd_flags != 0)
+        {
+            if (fd_flags & OS_STREAM_STATE_READABLE)
+            {
+                FD_SET(queues->fd[id], rd_set);
+            }
+            if (fd_flags & OS_STREAM_STATE_WRITABLE)
+            {
+                FD_SET(queues->fd[id], wr_set);
+            }
+            if (queues->fd[id] > *os_maxfd)
+            {
+                *os_maxfd = queues->fd[id];
+            }
+            queues->waiting = true;
+        }
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Unregisters each queue registered by OS_QueueSet_Begin_Impl(),
+ *          updates the flags to the states actually detected, and removes
+ *          the queue descriptors from the POSIX fd_sets so only the streams
+ *          remain.  The references to the queues are released.
+ *-----------------------------------------------------------------*/
+static void OS_QueueSet_End_Impl(fd_set *rd_set, fd_set *wr_set, OS_QueueSelectSet_t *queues)
+{
+    osal_index_t id;
+
+    queues->ready = false;
+    for (id = 0; id < queues->limit; ++id)
+    {
+        if (queues->flags[id] == 0)
+        {
+            continue;
+        }
+
+        OS_QueueSelectEnd_Impl(&queues->token[id], &queues->flags[id]);
+        OS_ObjectIdRelease(&queues->token[id]);
+
+        if (queues->flags[id] != 0)
+        {
+            queues->ready = true;
+        }
+
+        if (queues->fd[id] >= 0 && queues->fd[id] < FD_SETSIZE)
+        {
+            FD_CLR(queues->fd[id], rd_set);
+            FD_CLR(queues->fd[id], wr_set);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Un-sets the bits in an OSAL set for all queues from the given
+ *          index onwards, none of which can exist
+ *-----------------------------------------------------------------*/
+static void OS_QueueSet_ClearFrom_Impl(OS_FdSet *OSAL_set, osal_index_t limit)
+{
+    size_t offset;
+
+    offset = limit >> 3;
+    if ((limit & 0x7) != 0)
+    {
+        OSAL_set->queue_ids[offset] &= (1 << (limit & 0x7)) - 1;
+        ++offset;
+    }
+    if (offset < sizeof(OSAL_set->queue_ids))
+    {
+        memset(&OSAL_set->queue_ids[offset], 0, sizeof(OSAL_set->queue_ids) - offset);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Un-sets the bits in the OSAL sets for queues which are not
+ *          in the state waited for
+ *-----------------------------------------------------------------*/
+static void OS_QueueSet_ConvertOut_Impl(const OS_QueueSelectSet_t *queues, OS_FdSet *ReadSet, OS_FdSet *WriteSet)
+{
+    osal_index_t id;
+
+    for (id = 0; id < queues->limit; ++id)
+    {
+        if (ReadSet != NULL && (queues->flags[id] & OS_STREAM_STATE_READABLE) == 0)
+        {
+            ReadSet->queue_ids[id >> 3] &= ~(1 << (id & 0x7));
+        }
+        if (WriteSet != NULL && (queues->flags[id] & OS_STREAM_STATE_WRITABLE) == 0)
+        {
+            WriteSet->queue_ids[id >> 3] &= ~(1 << (id & 0x7));
+        }
+    }
+
+    if (ReadSet != NULL)
+    {
+        OS_QueueSet_ClearFrom_Impl(ReadSet, queues->limit);
+    }
+    if (WriteSet != NULL)
+    {
+        OS_QueueSet_ClearFrom_Impl(WriteSet, queues->limit);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Checks if any descriptor up to maxfd is set in either fd_set
+ *-----------------------------------------------------------------*/
+static bool OS_FdSet_IsAnySet_Impl(int maxfd, fd_set *rd_set, fd_set *wr_set)
+{
+    int osfd;
+
+    for (osfd = 0; osfd <= maxfd; ++osfd)
+    {
+        if (FD_ISSET(osfd, rd_set) || FD_ISSET(osfd, wr_set))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -310,43 +548,78 @@ int32 OS_SelectSingle_Impl(const OS_object_token_t *token, uint32 *SelectFlags,
  *-----------------------------------------------------------------*/
 int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, OS_time_t abs_timeout)
 {
-    fd_set wr_set;
-    fd_set rd_set;
-    int    maxfd;
-    int32  return_code;
-
-    FD_ZERO(&rd_set);
-    FD_ZERO(&wr_set);
-    maxfd = -1;
-    if (ReadSet != NULL)
+    fd_set              wr_set;
+    fd_set              rd_set;
+    int                 maxfd;
+    int32               return_code;
+    bool                spurious;
+    OS_QueueSelectSet_t queues;
+
+    do
     {
-        return_code = OS_FdSet_ConvertIn_Impl(&maxfd, &rd_set, ReadSet);
-        if (return_code != OS_SUCCESS)
+        FD_ZERO(&rd_set);
+        FD_ZERO(&wr_set);
+        maxfd = -1;
+        if (ReadSet != NULL)
         {
-            return return_code;
+            return_code = OS_FdSet_ConvertIn_Impl(&maxfd, &rd_set, ReadSet);
+            if (return_code != OS_SUCCESS)
+            {
+                return return_code;
+            }
         }
-    }
-    if (WriteSet != NULL)
-    {
-        return_code = OS_FdSet_ConvertIn_Impl(&maxfd, &wr_set, WriteSet);
+        if (WriteSet != NULL)
+        {
+            return_code = OS_FdSet_ConvertIn_Impl(&maxfd, &wr_set, WriteSet);
+            if (return_code != OS_SUCCESS)
+            {
+                return return_code;
+            }
+        }
+
+        return_code = OS_QueueSet_Begin_Impl(&maxfd, &rd_set, &wr_set, &queues, ReadSet, WriteSet);
+        if (return_code == OS_SUCCESS)
+        {
+            if (maxfd >= 0)
+            {
+                /* If a queue is already ready then only poll the other handles */
+                return_code = OS_DoSelect(maxfd, &rd_set, &wr_set, queues.ready ? OS_TIME_ZERO : abs_timeout);
+            }
+            else if (!queues.ready)
+            {
+                /*
+                 * This return code will be used if the set(s) were
+                 * both empty/NULL or otherwise did not contain valid filehandles.
+                 */
+                return_code = OS_ERR_INVALID_ID;
+            }
+            else
+            {
+                /* Only queues were given, and at least one is ready */
+            }
+        }
+
         if (return_code != OS_SUCCESS)
         {
-            return return_code;
+            FD_ZERO(&rd_set);
+            FD_ZERO(&wr_set);
+        }
+
+        OS_QueueSet_End_Impl(&rd_set, &wr_set, &queues);
+
+        if (queues.ready && return_code == OS_ERROR_TIMEOUT)
+        {
+            return_code = OS_SUCCESS;
         }
-    }
 
-    if (maxfd >= 0)
-    {
-        return_code = OS_DoSelect(maxfd, &rd_set, &wr_set, abs_timeout);
-    }
-    else
-    {
         /*
-         * This return code will be used if the set(s) were
-         * both empty/NULL or otherwise did not contain valid filehandles.
+         * A queue descriptor may be woken for a state that another task
+         * consumed before it was checked, so wait again in that case.
          */
-        return_code = OS_ERR_INVALID_ID;
-    }
+        spurious = (return_code == OS_SUCCESS && queues.waiting && !queues.ready &&
+                    !OS_FdSet_IsAnySet_Impl(maxfd, &rd_set, &wr_set));
+
+    } while (spurious);
 
     if (return_code == OS_SUCCESS)
     {
@@ -358,6 +631,7 @@ int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, OS_time_t ab
         {
             OS_FdSet_ConvertOut_Impl(&wr_set, WriteSet);
         }
+        OS_QueueSet_ConvertOut_Impl(&queues, ReadSet, WriteSet);
     }
 
     return return_code;
@@ -0,0 +1,53 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Purpose: All functions return OS_ERR_OPERATION_NOT_SUPPORTED.
+ * This is used where message queues are not file descriptors and
+ * cannot otherwise be waited on with select().
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <osapi.h>
+#include "os-shared-queue.h"
+
+/*----------------------------------------------------------------
+ * Implementation for no queue select
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+int32 OS_QueueSelectBegin_Impl(const OS_object_token_t *token, uint32 *SelectFlags, int *os_fd, uint32 *fd_flags)
+{
+    return OS_ERR_OPERATION_NOT_SUPPORTED;
+}
+
+/*----------------------------------------------------------------
+ * Implementation for no queue select
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+void OS_QueueSelectEnd_Impl(const OS_object_token_t *token, uint32 *SelectFlags)
+{
+    /* never called, as OS_QueueSelectBegin_Impl() does not succeed */
+    *SelectFlags = 0;
+}
@@ -27,9 +27,23 @@
 #define OS_IMPL_BINSEM_H
 
 #include "osconfig.h"
+#include "common_types.h"
 #include <pthread.h>
 #include <signal.h>
 
+#if defined(OSAL_CONFIG_BINSEM_FUTEX) && defined(__linux__)
+
+/*
+ * Binary Semaphores, held in a futex word.  The low bits hold the value
+ * and whether there may be waiters, the upper bits count the flushes.
+ */
+typedef struct
+{
+    uint32 state;
+} OS_impl_binsem_internal_record_t;
+
+#else
+
 /* Binary Semaphores */
 typedef struct
 {
@@ -39,7 +53,9 @@ typedef struct
     volatile sig_atomic_t current_value;
 } OS_impl_binsem_internal_record_t;
 
+#endif
+
 /* Tables where the OS object information is stored */
-extern OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+extern OS_impl_binsem_internal_record_t *OS_impl_bin_sem_table;
 
 #endif /* OS_IMPL_BINSEM_H */
@@ -37,6 +37,6 @@ typedef struct
 } OS_impl_condvar_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_condvar_internal_record_t OS_impl_condvar_table[OS_MAX_CONDVARS];
+extern OS_impl_condvar_internal_record_t *OS_impl_condvar_table;
 
 #endif /* OS_IMPL_CONDVAR_H */
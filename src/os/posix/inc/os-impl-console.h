@@ -37,6 +37,6 @@ typedef struct
     sem_t data_sem;
 } OS_impl_console_internal_record_t;
 
-extern OS_impl_console_internal_record_t OS_impl_console_table[OS_MAX_CONSOLES];
+extern OS_impl_console_internal_record_t *OS_impl_console_table;
 
 #endif /* OS_IMPL_CONSOLE_H */
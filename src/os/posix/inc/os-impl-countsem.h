@@ -27,6 +27,24 @@
 #define OS_IMPL_COUNTSEM_H
 
 #include "osconfig.h"
+#include "common_types.h"
+
+#if defined(OSAL_CONFIG_COUNTSEM_FUTEX) && defined(__linux__)
+
+/*
+ * Counting Semaphores, with the value held in a futex word.  The other
+ * members count the tasks which may be waiting, so a give only needs to
+ * make a system call when there is a task to wake.
+ */
+typedef struct
+{
+    uint32 value;
+    uint32 waiters;
+    uint32 multi_waiters;
+} OS_impl_countsem_internal_record_t;
+
+#else
+
 #include <semaphore.h>
 
 typedef struct
@@ -34,7 +52,9 @@ typedef struct
     sem_t id;
 } OS_impl_countsem_internal_record_t;
 
+#endif
+
 /* Tables where the OS object information is stored */
-extern OS_impl_countsem_internal_record_t OS_impl_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
+extern OS_impl_countsem_internal_record_t *OS_impl_count_sem_table;
 
 #endif /* OS_IMPL_COUNTSEM_H */
@@ -0,0 +1,48 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * \ingroup  posix
+ *
+ */
+
+#ifndef OS_IMPL_FUTEX_H
+#define OS_IMPL_FUTEX_H
+
+#include "osconfig.h"
+#include "common_types.h"
+#include <time.h>
+
+/*---------------------------------------------------------------------------------------
+ * Waits on a futex word while it holds the expected value, until the absolute
+ * time given by the realtime clock (if not NULL).  The calling task may be
+ * deleted while waiting.
+ *
+ * Returns 0 if woken, or an errno value, e.g. EAGAIN if the word did not hold the
+ * expected value, or ETIMEDOUT if the time was reached.
+ ----------------------------------------------------------------------------------------*/
+int OS_Posix_FutexWait(uint32 *word, uint32 expected, const struct timespec *timeout);
+
+/*---------------------------------------------------------------------------------------
+ * Wakes up to the given number of tasks waiting on a futex word
+ ----------------------------------------------------------------------------------------*/
+void OS_Posix_FutexWake(uint32 *word, int count);
+
+#endif /* OS_IMPL_FUTEX_H */
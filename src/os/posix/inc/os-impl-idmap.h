@@ -33,7 +33,10 @@
 typedef struct
 {
     pthread_mutex_t mutex;
-    pthread_cond_t  cond;
+    pthread_cond_t  cond;            /* for general table state changes */
+    pthread_cond_t  handoff_cond;    /* for release of the last reference to a RESERVED object */
+    uint32          waiters;         /* number of tasks waiting on cond */
+    uint32          handoff_waiters; /* number of tasks waiting on handoff_cond */
 } OS_impl_objtype_lock_t;
 
 /* Tables where the lock state information is stored */
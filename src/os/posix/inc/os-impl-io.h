@@ -44,6 +44,6 @@ typedef struct
  *
  * This is shared by all OSAL entities that perform low-level I/O.
  */
-extern OS_impl_file_internal_record_t OS_impl_filehandle_table[OS_MAX_NUM_OPEN_FILES];
+extern OS_impl_file_internal_record_t *OS_impl_filehandle_table;
 
 #endif /* OS_IMPL_IO_H */
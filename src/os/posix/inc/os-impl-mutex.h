@@ -27,15 +27,19 @@
 #define OS_IMPL_MUTEX_H
 
 #include "osconfig.h"
+#include "common_types.h"
 #include <pthread.h>
 
 /* Mutexes */
 typedef struct
 {
     pthread_mutex_t id;
+    uint32          spin_nsec; /* Time to spin before blocking, 0 if not adaptive */
+    uint32          spin_count;
+    uint32          block_count;
 } OS_impl_mutex_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
+extern OS_impl_mutex_internal_record_t *OS_impl_mutex_table;
 
 #endif /* OS_IMPL_MUTEX_H */
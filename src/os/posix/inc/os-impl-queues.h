@@ -27,15 +27,180 @@
 #define OS_IMPL_QUEUES_H
 
 #include "osconfig.h"
+#include "common_types.h"
+#include "osapi-queue.h"
+#include "os-shared-queue.h"
+#include "os-shared-idmap.h"
 #include <mqueue.h>
+#include <pthread.h>
+
+/*
+ * Header preceding each message in an in-process ring buffer slot.
+ * The message data immediately follows this header.
+ */
+typedef struct
+{
+    uint32 seq;  /**< sequence number, indicates whether the slot is free or filled */
+    uint32 size; /**< size of the message held in the slot */
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_time_t stamp; /**< monotonic time at which the message was put */
+#endif
+} OS_impl_queue_slot_t;
+
+/*
+ * Tasks waiting for a ring buffer to change state (not empty or not full)
+ */
+typedef struct
+{
+    uint32         waiters;   /**< number of tasks waiting on cond, or in OS_SelectMultiple() */
+    uint32         selectors; /**< number of tasks waiting in OS_SelectMultiple(), which are woken via their pipes */
+    pthread_cond_t cond;
+} OS_impl_queue_waitq_t;
+
+/*
+ * One lane of an in-process ring buffer, holding the messages of one priority.
+ *
+ * Producers and consumers claim slots by advancing the enqueue/dequeue position
+ * using atomic operations.  The positions are kept on separate cache lines so that
+ * producers and consumers do not contend for the same line.
+ */
+typedef struct
+{
+    uint32 enqueue_pos;
+    uint8  pad1[OS_CACHE_LINE_SIZE - sizeof(uint32)];
+    uint32 dequeue_pos;
+    uint8  pad2[OS_CACHE_LINE_SIZE - sizeof(uint32)];
+    uint8 *slots;
+} OS_impl_queue_lane_t;
+
+/*
+ * Byte ring of a packed queue, in which each message takes only the space of its
+ * own size.  Each message is preceded by a slot header holding its size, and the
+ * header and data together are padded to the alignment of the header.  A message
+ * never wraps around the end of the ring; any space too small to hold it is
+ * skipped instead.  Only accessed with the ring buffer locked.
+ */
+typedef struct
+{
+    size_t capacity; /**< size of the byte ring, a multiple of the header size */
+    size_t head;     /**< offset of the oldest message */
+    size_t tail;     /**< offset at which the next message is put */
+    size_t used;     /**< bytes in use, including any space skipped at the end */
+    uint8 *bytes;
+} OS_impl_queue_packed_t;
+
+/*
+ * Read position of a subscriber to a broadcast queue
+ */
+typedef struct OS_impl_queue_reader OS_impl_queue_reader_t;
+
+/*
+ * Registration of a task waiting on a ring buffer in OS_SelectMultiple()
+ */
+typedef struct OS_impl_queue_selector OS_impl_queue_selector_t;
+
+/*
+ * Storage of a broadcast queue.  Each message is written once, to the slot at
+ * the write position, and each subscriber reads it from there at its own read
+ * position.  A slot is only overwritten once every subscriber has read it or
+ * dropped it.  Only accessed with the ring buffer locked.
+ */
+typedef struct
+{
+    uint32                  write_pos; /**< position at which the next message is written */
+    OS_impl_queue_reader_t *readers;   /**< list of subscribers */
+    uint8 *                 slots;
+} OS_impl_queue_bcast_t;
+
+/*
+ * In-process ring buffer used instead of a POSIX message queue.
+ *
+ * Each priority has its own lane, allocated when a message of that priority is
+ * first put.  The depth limit applies to all lanes together.  The mutex and
+ * condition variables are only used when a task must wait for the queue to
+ * become non-empty or non-full.
+ *
+ * A queue with a single producer and consumer only uses the lane for the default
+ * priority, and neither the count nor compare-and-swap is needed to claim a slot.
+ *
+ * A packed queue has no lanes; its messages are held in a byte ring instead,
+ * which is only accessed with the mutex held.  The same applies to the slots
+ * of a broadcast queue.
+ *
+ * Tasks using the queue, including in OS_SelectMultiple(), hold a reference
+ * to it, so it is only deleted once they are done.  A task waiting on the
+ * queue gives up as soon as it is about to be deleted.
+ */
+typedef struct
+{
+    uint32                    count; /**< number of slots in use in all lanes, at most depth */
+    uint8                     pad[OS_CACHE_LINE_SIZE - sizeof(uint32)];
+    uint32                    lanes_used; /**< bit mask of the lanes which have been allocated */
+    uint32                    mask;       /**< number of slots per lane minus one (a power of two) */
+    uint32                    depth;      /**< maximum number of messages held at once */
+    size_t                    stride;     /**< size of each slot, or of the largest packed message, with the header */
+    bool                      spsc;       /**< set if there is a single producer and consumer */
+    uint32                    deleting;   /**< nonzero while the queue is about to be deleted, so tasks give up */
+    uint32                    handed_out; /**< slots reserved or referenced, not yet committed or released */
+    pthread_mutex_t           lock;
+    OS_impl_queue_waitq_t     not_empty;
+    OS_impl_queue_waitq_t     not_full;
+    OS_impl_queue_lane_t *    lanes[OS_QUEUE_PRIORITY_LEVELS];
+    OS_impl_queue_packed_t *  packed;    /**< set if messages are packed by size, NULL if held in lanes */
+    OS_impl_queue_bcast_t *   bcast;     /**< set if messages are broadcast to subscribers, NULL if held in lanes */
+    OS_impl_queue_selector_t *selectors; /**< tasks waiting in OS_SelectMultiple(), NULL if none */
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_queue_internal_record_t *queue; /**< shared layer record, for the latency statistics */
+#endif
+} OS_impl_queue_ring_t;
+
+struct OS_impl_queue_reader
+{
+    OS_impl_queue_reader_t *next;
+    OS_impl_queue_ring_t *  source;      /**< ring buffer of the broadcast queue */
+    uint32                  read_pos;    /**< position of the next message to receive */
+    bool                    drop_oldest; /**< set if messages are dropped rather than holding up the producer */
+    uint32                  deleting;    /**< nonzero while the subscriber is about to be deleted, as for the queue */
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_queue_internal_record_t *queue; /**< shared layer record of the subscriber, for the statistics */
+#endif
+};
+
+/*
+ * Each task waiting in OS_SelectMultiple() waits on its own pipe, to which producers
+ * and consumers write a byte to wake it.  As a task discards the wakeups in its own
+ * pipe once it has checked the queues, it cannot consume those meant for another task.
+ */
+struct OS_impl_queue_selector
+{
+    OS_impl_queue_selector_t *next;      /**< next task waiting on the same ring buffer */
+    OS_impl_queue_selector_t *task_next; /**< next ring buffer waited on by the same task */
+    OS_impl_queue_ring_t *    ring;
+    OS_impl_queue_reader_t *  reader;    /**< subscriber waited on, NULL if waiting on the queue itself */
+    OS_object_token_t         token;     /**< reference held by the task, released if it is canceled */
+    uint32                    flags;     /**< states waited for, OS_STREAM_STATE_READABLE and/or WRITABLE */
+    int                       wake_fd;   /**< write end of the pipe of the task */
+};
+
+/*
+ * State of a task which has waited in OS_SelectMultiple(), created on first use and
+ * released when the task exits
+ */
+typedef struct
+{
+    int                       pipe[2];
+    OS_impl_queue_selector_t *selectors; /**< ring buffers the task is waiting on */
+} OS_impl_queue_select_task_t;
 
 /* queues */
 typedef struct
 {
-    mqd_t id;
+    mqd_t                   id;
+    OS_impl_queue_ring_t *  ring;   /**< set if the queue is held in process memory, NULL if using mq_open */
+    OS_impl_queue_reader_t *reader; /**< set if the queue is a subscriber to a broadcast queue */
 } OS_impl_queue_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
+extern OS_impl_queue_internal_record_t *OS_impl_queue_table;
 
 #endif /* OS_IMPL_QUEUES_H */
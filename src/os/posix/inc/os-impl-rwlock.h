@@ -36,6 +36,6 @@ typedef struct
 } OS_impl_rwlock_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_rwlock_internal_record_t OS_impl_rwlock_table[OS_MAX_RWLOCKS];
+extern OS_impl_rwlock_internal_record_t *OS_impl_rwlock_table;
 
 #endif /* OS_IMPL_RWLOCK_H */
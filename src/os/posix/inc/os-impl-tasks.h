@@ -38,9 +38,11 @@ typedef struct
 } OS_impl_task_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
+extern OS_impl_task_internal_record_t *OS_impl_task_table;
 
 int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, osal_stackptr_t stackptr,
                                        size_t stacksz, PthreadFuncPtr_t entry, void *entry_arg);
 
+int OS_PriorityRemap(osal_priority_t InputPri);
+
 #endif /* OS_IMPL_TASKS_H */
@@ -73,6 +73,7 @@ typedef struct
     osal_blockcount_t      TruncateQueueDepth;
     uint32                 ClockAccuracyNsec;
     pthread_key_t          ThreadKey;
+    pthread_key_t          QueueSelectKey;
     sigset_t               MaximumSigMask;
     sigset_t               NormalSigMask;
     size_t                 PageSize;
@@ -102,6 +103,7 @@ int32 OS_Posix_TimeBaseAPI_Impl_Init(void);
 int32 OS_Posix_StreamAPI_Impl_Init(void);
 int32 OS_Posix_DirAPI_Impl_Init(void);
 int32 OS_Posix_FileSysAPI_Impl_Init(void);
+int32 OS_Posix_ConsoleAPI_Impl_Init(void);
 
 int32 OS_Posix_TableMutex_Init(osal_objtype_t idtype);
 
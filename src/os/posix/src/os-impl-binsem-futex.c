@@ -0,0 +1,294 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: This file contains the binary semaphore implementation for POSIX
+ *    systems running Linux, using futexes.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-shared-idmap.h"
+#include "os-shared-binsem.h"
+#include "os-impl-binsem.h"
+#include "os-impl-futex.h"
+
+/*
+ * Values held in the low bits of the state word
+ */
+#define OS_POSIX_BINSEM_EMPTY   0x0 /**< Not available, and no task is waiting */
+#define OS_POSIX_BINSEM_FULL    0x1 /**< Available to be taken */
+#define OS_POSIX_BINSEM_WAITERS 0x2 /**< Not available, and tasks may be waiting */
+
+#define OS_POSIX_BINSEM_VALUE_MASK 0x3
+
+/*
+ * Each flush adds this to the state word, so the upper bits count the flushes
+ */
+#define OS_POSIX_BINSEM_FLUSH_INCR 0x4
+
+/* Tables where the OS object information is stored */
+OS_impl_binsem_internal_record_t *OS_impl_bin_sem_table;
+
+/****************************************************************************************
+                               BINARY SEMAPHORE API
+ ***************************************************************************************/
+
+/*
+ * The whole state of each binary semaphore is held in a single word, which is
+ * updated using atomic operations.  Giving the semaphore when no task is waiting,
+ * or taking it when it is available, does not make any system call.  A task which
+ * needs to wait sets the state to OS_POSIX_BINSEM_WAITERS before sleeping on the
+ * word with FUTEX_WAIT, so the next give knows it must wake a task.
+ *
+ * As a task which has been woken cannot know whether others are still waiting, it
+ * leaves the state as OS_POSIX_BINSEM_WAITERS when it takes the semaphore.  At worst
+ * this costs one unnecessary wakeup on a later give.
+ *
+ * A flush changes the upper bits of the word, so it also interrupts any task which
+ * is just about to wait.  A waiting task which sees the count of flushes change
+ * returns without taking the semaphore.
+ */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_BinSemAPI_Impl_Init
+
+   Purpose: Initialize the Binary Semaphore data structures
+
+ ----------------------------------------------------------------------------------------*/
+int32 OS_Posix_BinSemAPI_Impl_Init(void)
+{
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_BINSEM, OS_impl_bin_sem_table);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemCreate_Impl(const OS_object_token_t *token, uint32 initial_value, uint32 options)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /*
+     * As with the other implementations, an initial value greater than 1
+     * silently gives a semaphore which is available.
+     */
+    if (initial_value > 0)
+    {
+        sem->state = OS_POSIX_BINSEM_FULL;
+    }
+    else
+    {
+        sem->state = OS_POSIX_BINSEM_EMPTY;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemDelete_Impl(const OS_object_token_t *token)
+{
+    /* There are no resources to release */
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGive_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+    uint32                            state;
+
+    sem   = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+    state = __atomic_load_n(&sem->state, __ATOMIC_RELAXED);
+
+    do
+    {
+        /* Binary semaphores are always set as "1" when given */
+        if ((state & OS_POSIX_BINSEM_VALUE_MASK) == OS_POSIX_BINSEM_FULL)
+        {
+            return OS_SUCCESS;
+        }
+    } while (!__atomic_compare_exchange_n(&sem->state, &state,
+                                          (state & ~OS_POSIX_BINSEM_VALUE_MASK) | OS_POSIX_BINSEM_FULL, true,
+                                          __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    /* unblock one thread that may be waiting on this sem */
+    if ((state & OS_POSIX_BINSEM_VALUE_MASK) == OS_POSIX_BINSEM_WAITERS)
+    {
+        OS_Posix_FutexWake(&sem->state, 1);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemFlush_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+    uint32                            state;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* increment the flush counter.  Any other threads that are
+     * currently pending in SemTake() will see the counter change and
+     * return _without_ modifying the semaphore value.
+     */
+    state = __atomic_fetch_add(&sem->state, OS_POSIX_BINSEM_FLUSH_INCR, __ATOMIC_ACQ_REL);
+
+    /* unblock all threads that may be waiting on this sem */
+    if ((state & OS_POSIX_BINSEM_VALUE_MASK) == OS_POSIX_BINSEM_WAITERS)
+    {
+        OS_Posix_FutexWake(&sem->state, INT_MAX);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericBinSemTake_Impl
+
+   Purpose: Helper function that takes a binary semaphore with a "timespec" timeout
+            If the semaphore is not available this will block until either it
+            is given (via SemGive) or the semaphore gets flushed.
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericBinSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
+{
+    OS_impl_binsem_internal_record_t *sem;
+    uint32                            state;
+    uint32                            flush_count;
+    uint32                            taken_value;
+    int                               ret;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /*
+     * first take a local snapshot of the flush request counter,
+     * if it changes, we know that someone else called SemFlush.
+     */
+    state       = __atomic_load_n(&sem->state, __ATOMIC_ACQUIRE);
+    flush_count = state & ~OS_POSIX_BINSEM_VALUE_MASK;
+    taken_value = OS_POSIX_BINSEM_EMPTY;
+
+    while ((state & ~OS_POSIX_BINSEM_VALUE_MASK) == flush_count)
+    {
+        if ((state & OS_POSIX_BINSEM_VALUE_MASK) == OS_POSIX_BINSEM_FULL)
+        {
+            if (__atomic_compare_exchange_n(&sem->state, &state, flush_count | taken_value, true, __ATOMIC_ACQUIRE,
+                                            __ATOMIC_ACQUIRE))
+            {
+                return OS_SUCCESS;
+            }
+        }
+        else if ((state & OS_POSIX_BINSEM_VALUE_MASK) == OS_POSIX_BINSEM_WAITERS ||
+                 __atomic_compare_exchange_n(&sem->state, &state, flush_count | OS_POSIX_BINSEM_WAITERS, true,
+                                             __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        {
+            /* Must pend until something changes */
+            ret = OS_Posix_FutexWait(&sem->state, flush_count | OS_POSIX_BINSEM_WAITERS, timeout);
+            if (ret == ETIMEDOUT)
+            {
+                return OS_SEM_TIMEOUT;
+            }
+            if (ret != 0 && ret != EAGAIN && ret != EINTR)
+            {
+                OS_DEBUG("futex wait failed: %s\n", strerror(ret));
+                return OS_SEM_FAILURE;
+            }
+
+            /* Other tasks may still be waiting, so the state must continue to say so */
+            taken_value = OS_POSIX_BINSEM_WAITERS;
+            state       = __atomic_load_n(&sem->state, __ATOMIC_ACQUIRE);
+        }
+    }
+
+    /* The semaphore was flushed, so return without taking it */
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemTake_Impl(const OS_object_token_t *token)
+{
+    return (OS_GenericBinSemTake_Impl(token, NULL));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+{
+    struct timespec ts;
+
+    /*
+     ** Compute an absolute time for the delay
+     */
+    OS_Posix_CompAbsDelayTime(msecs, &ts);
+
+    return (OS_GenericBinSemTake_Impl(token, &ts));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGetInfo_Impl(const OS_object_token_t *token, OS_bin_sem_prop_t *sem_prop)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* put the info into the structure */
+    sem_prop->value = ((__atomic_load_n(&sem->state, __ATOMIC_RELAXED) & OS_POSIX_BINSEM_VALUE_MASK) ==
+                       OS_POSIX_BINSEM_FULL);
+    return OS_SUCCESS;
+}
@@ -50,7 +50,7 @@
 #define OS_POSIX_BINSEM_MAX_WAIT_SECONDS 2
 
 /* Tables where the OS object information is stored */
-OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+OS_impl_binsem_internal_record_t *OS_impl_bin_sem_table;
 
 /*---------------------------------------------------------------------------------------
  * Helper function for acquiring the mutex when beginning a binary sem operation
@@ -105,8 +105,7 @@ void OS_Posix_BinSemReleaseMutex(void *mut)
  ----------------------------------------------------------------------------------------*/
 int32 OS_Posix_BinSemAPI_Impl_Init(void)
 {
-    memset(OS_impl_bin_sem_table, 0, sizeof(OS_impl_bin_sem_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_BINSEM, OS_impl_bin_sem_table);
 }
 
 /*----------------------------------------------------------------
@@ -76,6 +76,9 @@ int32 OS_API_Impl_Init(osal_objtype_t idtype)
         case OS_OBJECT_TYPE_OS_MUTEX:
             return_code = OS_Posix_MutexAPI_Impl_Init();
             break;
+        case OS_OBJECT_TYPE_OS_RWLOCK:
+            return_code = OS_Posix_RwLockAPI_Impl_Init();
+            break;
         case OS_OBJECT_TYPE_OS_MODULE:
             return_code = OS_Posix_ModuleAPI_Impl_Init();
             break;
@@ -91,6 +94,9 @@ int32 OS_API_Impl_Init(osal_objtype_t idtype)
         case OS_OBJECT_TYPE_OS_FILESYS:
             return_code = OS_Posix_FileSysAPI_Impl_Init();
             break;
+        case OS_OBJECT_TYPE_OS_CONSOLE:
+            return_code = OS_Posix_ConsoleAPI_Impl_Init();
+            break;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return_code = OS_Posix_CondVarAPI_Impl_Init();
             break;
@@ -33,7 +33,7 @@
 #include "os-impl-condvar.h"
 
 /* Tables where the OS object information is stored */
-OS_impl_condvar_internal_record_t OS_impl_condvar_table[OS_MAX_CONDVARS];
+OS_impl_condvar_internal_record_t *OS_impl_condvar_table;
 
 /*---------------------------------------------------------------------------------------
  * Helper function for releasing the mutex in case the thread
@@ -55,8 +55,7 @@ static void OS_Posix_CondVarReleaseMutex(void *mut)
  *-----------------------------------------------------------------*/
 int32 OS_Posix_CondVarAPI_Impl_Init(void)
 {
-    memset(OS_impl_condvar_table, 0, sizeof(OS_impl_condvar_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_CONDVAR, OS_impl_condvar_table);
 }
 
 /*----------------------------------------------------------------
@@ -46,12 +46,22 @@
 #define OS_CONSOLE_TASK_PRIORITY OS_UTILITYTASK_PRIORITY
 
 /* Tables where the OS object information is stored */
-OS_impl_console_internal_record_t OS_impl_console_table[OS_MAX_CONSOLES];
+OS_impl_console_internal_record_t *OS_impl_console_table;
 
 /********************************************************************/
 /*                 CONSOLE OUTPUT                                   */
 /********************************************************************/
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_ConsoleAPI_Impl_Init(void)
+{
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_CONSOLE, OS_impl_console_table);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
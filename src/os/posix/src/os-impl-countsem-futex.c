@@ -0,0 +1,334 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: This file contains the counting semaphore implementation for POSIX
+ *    systems running Linux, using futexes.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-impl-countsem.h"
+#include "os-impl-futex.h"
+#include "os-shared-countsem.h"
+#include "os-shared-idmap.h"
+
+/*
+ * Added SEM_VALUE_MAX Define
+ */
+#ifndef SEM_VALUE_MAX
+#define SEM_VALUE_MAX (UINT32_MAX / 2)
+#endif
+
+/*
+ * Identifies a waiting task, so it can be removed from the
+ * count of waiters if it is deleted while waiting
+ */
+typedef struct
+{
+    OS_impl_countsem_internal_record_t *sem;
+    uint32                              count;
+} OS_Posix_CountSemWaiter_t;
+
+/* Tables where the OS object information is stored */
+OS_impl_countsem_internal_record_t *OS_impl_count_sem_table;
+
+/****************************************************************************************
+                               COUNTING SEMAPHORE API
+ ***************************************************************************************/
+
+/*
+ * The value of each counting semaphore is held in a single word, which is updated
+ * using atomic operations.  As with the POSIX semaphore facility:
+ *  - give may be done from a signal / ISR context
+ *  - give should not cause an unexpected task switch nor should it ever block
+ *
+ * A task which needs to wait adds itself to the count of waiters and then sleeps on
+ * the value with FUTEX_WAIT, so a give only makes a system call if a task may be
+ * waiting.  Both sides use sequentially consistent operations, so either the give
+ * sees the waiter, or the waiter sees the new value and does not sleep.
+ *
+ * Several units may be given or taken at once.  A take does not decrement the value
+ * until all the units it needs are available, so tasks which each need several
+ * units cannot deadlock by holding a part of what they need.  If a task needing
+ * several units is waiting, the give wakes every waiting task, as the units just
+ * given might not be enough for the first task woken, but may be enough for another.
+ * Otherwise it wakes only as many tasks as units were given.
+ */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_CountSemAPI_Impl_Init
+
+   Purpose: Initialize the Counting Semaphore data structures
+
+---------------------------------------------------------------------------------------*/
+int32 OS_Posix_CountSemAPI_Impl_Init(void)
+{
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_COUNTSEM, OS_impl_count_sem_table);
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_CountSemRemoveWaiter
+
+   Purpose: Removes a task from the count of waiters, when it stops waiting
+            or is deleted while waiting
+
+---------------------------------------------------------------------------------------*/
+static void OS_Posix_CountSemRemoveWaiter(void *arg)
+{
+    OS_Posix_CountSemWaiter_t *waiter = arg;
+
+    if (waiter->count > 1)
+    {
+        __atomic_fetch_sub(&waiter->sem->multi_waiters, 1, __ATOMIC_SEQ_CST);
+    }
+    __atomic_fetch_sub(&waiter->sem->waiters, 1, __ATOMIC_SEQ_CST);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemCreate_Impl(const OS_object_token_t *token, uint32 sem_initial_value, uint32 options)
+{
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    if (sem_initial_value > SEM_VALUE_MAX)
+    {
+        return OS_INVALID_SEM_VALUE;
+    }
+
+    impl->value         = sem_initial_value;
+    impl->waiters       = 0;
+    impl->multi_waiters = 0;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemDelete_Impl(const OS_object_token_t *token)
+{
+    /* There are no resources to release */
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemGiveN_Impl(const OS_object_token_t *token, uint32 count)
+{
+    OS_impl_countsem_internal_record_t *impl;
+    uint32                              value;
+
+    impl  = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+    value = __atomic_load_n(&impl->value, __ATOMIC_RELAXED);
+
+    do
+    {
+        if (count > SEM_VALUE_MAX || value > (SEM_VALUE_MAX - count))
+        {
+            return OS_INVALID_SEM_VALUE;
+        }
+    } while (!__atomic_compare_exchange_n(&impl->value, &value, value + count, true, __ATOMIC_SEQ_CST,
+                                          __ATOMIC_RELAXED));
+
+    /* unblock the threads that may be waiting on this sem */
+    if (__atomic_load_n(&impl->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        if (__atomic_load_n(&impl->multi_waiters, __ATOMIC_SEQ_CST) != 0)
+        {
+            OS_Posix_FutexWake(&impl->value, INT_MAX);
+        }
+        else
+        {
+            OS_Posix_FutexWake(&impl->value, (int)count);
+        }
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemGive_Impl(const OS_object_token_t *token)
+{
+    /* As with sem_post(), exceeding the maximum value is an unspecified failure */
+    if (OS_CountSemGiveN_Impl(token, 1) != OS_SUCCESS)
+    {
+        return OS_SEM_FAILURE;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericCountSemTake_Impl
+
+   Purpose: Helper function that takes units from a counting semaphore with a "timespec"
+            timeout.  If there are not enough units available this will block until
+            they have all been given.
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericCountSemTake_Impl(const OS_object_token_t *token, uint32 count,
+                                         const struct timespec *timeout)
+{
+    OS_Posix_CountSemWaiter_t waiter;
+    uint32                    value;
+    int                       ret;
+
+    waiter.sem   = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+    waiter.count = count;
+    value        = __atomic_load_n(&waiter.sem->value, __ATOMIC_RELAXED);
+
+    while (true)
+    {
+        if (value >= count)
+        {
+            if (__atomic_compare_exchange_n(&waiter.sem->value, &value, value - count, true, __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED))
+            {
+                return OS_SUCCESS;
+            }
+        }
+        else
+        {
+            /* Must pend until more units are given */
+            if (count > 1)
+            {
+                __atomic_fetch_add(&waiter.sem->multi_waiters, 1, __ATOMIC_SEQ_CST);
+            }
+            __atomic_fetch_add(&waiter.sem->waiters, 1, __ATOMIC_SEQ_CST);
+
+            /* check again, as a give may have happened before this task was counted */
+            value = __atomic_load_n(&waiter.sem->value, __ATOMIC_SEQ_CST);
+            ret   = 0;
+            if (value < count)
+            {
+                pthread_cleanup_push(OS_Posix_CountSemRemoveWaiter, &waiter);
+                ret = OS_Posix_FutexWait(&waiter.sem->value, value, timeout);
+                pthread_cleanup_pop(1);
+            }
+            else
+            {
+                OS_Posix_CountSemRemoveWaiter(&waiter);
+            }
+
+            if (ret == ETIMEDOUT)
+            {
+                return OS_SEM_TIMEOUT;
+            }
+            if (ret != 0 && ret != EAGAIN && ret != EINTR)
+            {
+                OS_DEBUG("futex wait failed: %s\n", strerror(ret));
+                return OS_SEM_FAILURE;
+            }
+
+            value = __atomic_load_n(&waiter.sem->value, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTake_Impl(const OS_object_token_t *token)
+{
+    return (OS_GenericCountSemTake_Impl(token, 1, NULL));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTakeN_Impl(const OS_object_token_t *token, uint32 count)
+{
+    return (OS_GenericCountSemTake_Impl(token, count, NULL));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+{
+    return (OS_CountSemTimedWaitN_Impl(token, 1, msecs));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTimedWaitN_Impl(const OS_object_token_t *token, uint32 count, uint32 msecs)
+{
+    struct timespec ts;
+
+    /*
+     ** Compute an absolute time for the delay
+     */
+    OS_Posix_CompAbsDelayTime(msecs, &ts);
+
+    return (OS_GenericCountSemTake_Impl(token, count, &ts));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemGetInfo_Impl(const OS_object_token_t *token, OS_count_sem_prop_t *count_prop)
+{
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    /* put the info into the structure */
+    count_prop->value = __atomic_load_n(&impl->value, __ATOMIC_RELAXED);
+    return OS_SUCCESS;
+}
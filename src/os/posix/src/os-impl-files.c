@@ -36,6 +36,7 @@
 #include "os-posix.h"
 #include "os-impl-files.h"
 #include "os-shared-file.h"
+#include "os-shared-idmap.h"
 
 /****************************************************************************************
                                      GLOBALS
@@ -46,7 +47,7 @@
  *
  * This is shared by all OSAL entities that perform low-level I/O.
  */
-OS_impl_file_internal_record_t OS_impl_filehandle_table[OS_MAX_NUM_OPEN_FILES];
+OS_impl_file_internal_record_t *OS_impl_filehandle_table;
 
 /*
  * These two constants (EUID and EGID) are local cache of the
@@ -84,12 +85,19 @@ const int OS_IMPL_REGULAR_FILE_FLAGS = O_NONBLOCK;
 int32 OS_Posix_StreamAPI_Impl_Init(void)
 {
     osal_index_t local_id;
+    int32        return_code;
+
+    return_code = OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_STREAM, OS_impl_filehandle_table);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
 
     /*
      * init all filehandles to -1, which is always invalid.
      * this isn't strictly necessary but helps when debugging.
      */
-    for (local_id = 0; local_id < OS_MAX_NUM_OPEN_FILES; ++local_id)
+    for (local_id = 0; local_id < OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_STREAM); ++local_id)
     {
         OS_impl_filehandle_table[local_id].fd = -1;
     }
@@ -0,0 +1,73 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: This file contains helper functions for the semaphores which are
+ *    implemented using futexes on Linux.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#define _GNU_SOURCE /* for syscall() */
+#include "os-posix.h"
+#include "os-impl-futex.h"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int OS_Posix_FutexWait(uint32 *word, uint32 expected, const struct timespec *timeout)
+{
+    int  old_type;
+    int  ret;
+    long status;
+
+    /*
+     * FUTEX_WAIT is not a cancellation point, so the task could not be deleted while
+     * waiting.  No resource is held at this point, so cancellation is made asynchronous
+     * just for the system call, as the C library does for its own cancellation points.
+     */
+    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, &old_type);
+    status = syscall(SYS_futex, word, FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME, expected, timeout, NULL,
+                     FUTEX_BITSET_MATCH_ANY);
+    ret    = (status == 0) ? 0 : errno;
+    pthread_setcanceltype(old_type, &old_type);
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexWake(uint32 *word, int count)
+{
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
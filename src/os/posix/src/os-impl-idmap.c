@@ -65,13 +65,73 @@ OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] =
     [OS_OBJECT_TYPE_OS_CONDVAR]  = &OS_condvar_lock,
 };
 
+/*
+ * State of a task waiting on one of the table condition variables
+ */
+typedef struct
+{
+    pthread_mutex_t *mutex;
+    uint32 *         waiters;
+} OS_Posix_TableWaiter_t;
+
 /*---------------------------------------------------------------------------------------
  * Helper function for releasing the mutex in case the thread
  * executing pthread_condwait() is canceled.
  ----------------------------------------------------------------------------------------*/
-void OS_Posix_ReleaseTableMutex(void *mut)
+void OS_Posix_ReleaseTableMutex(void *arg)
 {
-    pthread_mutex_unlock(mut);
+    OS_Posix_TableWaiter_t *waiter = arg;
+
+    --(*waiter->waiters);
+    pthread_mutex_unlock(waiter->mutex);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function to wait on a table condition variable for up to the given
+ * timeout in milliseconds, or indefinitely if the timeout is negative.  The waiter
+ * count is maintained so that the condition is only signaled if there is actually
+ * a task waiting on it.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_TableWait(OS_impl_objtype_lock_t *impl, pthread_cond_t *cond, uint32 *waiters, int32 timeout)
+{
+    OS_Posix_TableWaiter_t waiter;
+    struct timespec        ts;
+
+    waiter.mutex   = &impl->mutex;
+    waiter.waiters = waiters;
+
+    /*
+     * because pthread_cond_timedwait() is also a cancellation point,
+     * this pushes a cleanup handler to ensure that if canceled during this call,
+     * the mutex will be released.
+     */
+    pthread_cleanup_push(OS_Posix_ReleaseTableMutex, &waiter);
+
+    ++(*waiters);
+
+    if (timeout < 0)
+    {
+        pthread_cond_wait(cond, &impl->mutex);
+    }
+    else
+    {
+        /* the condition variables use the monotonic clock, see OS_Posix_TableMutex_Init() */
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+
+        ts.tv_sec += timeout / 1000;
+        ts.tv_nsec += (timeout % 1000) * 1000000;
+        if (ts.tv_nsec >= 1000000000)
+        {
+            ts.tv_nsec -= 1000000000;
+            ++ts.tv_sec;
+        }
+
+        pthread_cond_timedwait(cond, &impl->mutex, &ts);
+    }
+
+    --(*waiters);
+
+    pthread_cleanup_pop(false);
 }
 
 /*----------------------------------------------------------------
@@ -113,11 +173,14 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
     if (impl != NULL)
     {
         /* Notify any waiting threads that the state _may_ have changed */
-        ret = pthread_cond_broadcast(&impl->cond);
-        if (ret != 0)
+        if (impl->waiters > 0)
         {
-            OS_DEBUG("pthread_cond_broadcast(&impl->cond): %s", strerror(ret));
-            /* unexpected but keep going (not critical) */
+            ret = pthread_cond_broadcast(&impl->cond);
+            if (ret != 0)
+            {
+                OS_DEBUG("pthread_cond_broadcast(&impl->cond): %s", strerror(ret));
+                /* unexpected but keep going (not critical) */
+            }
         }
 
         ret = pthread_mutex_unlock(&impl->mutex);
@@ -134,41 +197,55 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
  *           See prototype for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, int32 timeout)
 {
     OS_impl_objtype_lock_t *impl;
-    struct timespec         ts;
 
     impl = OS_impl_objtype_lock_table[objtype];
 
-    /*
-     * because pthread_cond_timedwait() is also a cancellation point,
-     * this pushes a cleanup handler to ensure that if canceled during this call,
-     * the mutex will be released.
-     */
-    pthread_cleanup_push(OS_Posix_ReleaseTableMutex, &impl->mutex);
+    OS_Posix_TableWait(impl, &impl->cond, &impl->waiters, timeout);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_WaitForHandoff_Impl(osal_objtype_t objtype, int32 timeout)
+{
+    OS_impl_objtype_lock_t *impl;
 
-    clock_gettime(CLOCK_REALTIME, &ts);
+    impl = OS_impl_objtype_lock_table[objtype];
+
+    OS_Posix_TableWait(impl, &impl->handoff_cond, &impl->handoff_waiters, timeout);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_SignalHandoff_Impl(osal_objtype_t objtype)
+{
+    OS_impl_objtype_lock_t *impl;
+    int                     ret;
 
-    if (attempts <= 10)
+    impl = OS_impl_objtype_lock_table[objtype];
+
+    /*
+     * Several tasks may be waiting for different objects of this type, so all
+     * must be woken, but tasks waiting for other state changes are not.
+     */
+    if (impl != NULL && impl->handoff_waiters > 0)
     {
-        /* Wait an increasing amount of time, starting at 10ms */
-        ts.tv_nsec += attempts * attempts * 10000000;
-        if (ts.tv_nsec >= 1000000000)
+        ret = pthread_cond_broadcast(&impl->handoff_cond);
+        if (ret != 0)
         {
-            ts.tv_nsec -= 1000000000;
-            ++ts.tv_sec;
+            OS_DEBUG("pthread_cond_broadcast(&impl->handoff_cond): %s", strerror(ret));
         }
     }
-    else
-    {
-        /* wait 1 second (max for polling) */
-        ++ts.tv_sec;
-    }
-
-    pthread_cond_timedwait(&impl->cond, &impl->mutex, &ts);
-
-    pthread_cleanup_pop(false);
 }
 
 /*---------------------------------------------------------------------------------------
@@ -183,6 +260,7 @@ int32 OS_Posix_TableMutex_Init(osal_objtype_t idtype)
     int                     ret;
     int32                   return_code = OS_SUCCESS;
     pthread_mutexattr_t     mutex_attr;
+    pthread_condattr_t      cond_attr;
     OS_impl_objtype_lock_t *impl;
 
     impl = OS_impl_objtype_lock_table[idtype];
@@ -235,15 +313,48 @@ int32 OS_Posix_TableMutex_Init(osal_objtype_t idtype)
             break;
         }
 
-        /* create a condition variable with default attributes.
-         * This will be broadcast every time the object table changes */
-        ret = pthread_cond_init(&impl->cond, NULL);
+        /*
+         * The condition variables are timed against the monotonic clock, so
+         * that waits are not affected by changes to the system time
+         */
+        ret = pthread_condattr_init(&cond_attr);
+        if (ret != 0)
+        {
+            OS_DEBUG("Error: pthread_condattr_init failed: %s\n", strerror(ret));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        ret = pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+        if (ret != 0)
+        {
+            OS_DEBUG("Error: pthread_condattr_setclock failed: %s\n", strerror(ret));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        /* create a condition variable.
+         * This will be broadcast when the object table changes, if any task is waiting */
+        ret = pthread_cond_init(&impl->cond, &cond_attr);
+        if (ret != 0)
+        {
+            OS_DEBUG("Error: pthread_cond_init failed: %s\n", strerror(ret));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        /* create a condition variable.
+         * This will be broadcast when an object pending an exclusive lock is released */
+        ret = pthread_cond_init(&impl->handoff_cond, &cond_attr);
         if (ret != 0)
         {
             OS_DEBUG("Error: pthread_cond_init failed: %s\n", strerror(ret));
             return_code = OS_ERROR;
             break;
         }
+
+        impl->waiters         = 0;
+        impl->handoff_waiters = 0;
     } while (0);
 
     return return_code;
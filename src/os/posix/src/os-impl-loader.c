@@ -31,8 +31,9 @@
 #include <string.h>
 #include "os-impl-loader.h"
 #include "os-shared-module.h"
+#include "os-shared-idmap.h"
 
-OS_impl_module_internal_record_t OS_impl_module_table[OS_MAX_MODULES];
+OS_impl_module_internal_record_t *OS_impl_module_table;
 
 /*----------------------------------------------------------------
  *
@@ -41,6 +42,5 @@ OS_impl_module_internal_record_t OS_impl_module_table[OS_MAX_MODULES];
  *-----------------------------------------------------------------*/
 int32 OS_Posix_ModuleAPI_Impl_Init(void)
 {
-    memset(OS_impl_module_table, 0, sizeof(OS_impl_module_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_MODULE, OS_impl_module_table);
 }
@@ -31,9 +31,73 @@
 #include "os-shared-mutex.h"
 #include "os-shared-idmap.h"
 #include "os-impl-mutex.h"
+#include "os-impl-tasks.h"
+
+/*
+ * The number of times to relax the processor between attempts to lock
+ * an adaptive mutex, so the spinning task does not keep taking the
+ * cache line away from the holder
+ */
+#define OS_POSIX_MUTEX_SPIN_BATCH 32
+
+/*
+ * Hint to the processor that the task is spinning
+ */
+#if defined(__i386__) || defined(__x86_64__)
+#define OS_POSIX_MUTEX_CPU_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define OS_POSIX_MUTEX_CPU_RELAX() __asm__ __volatile__("yield" ::: "memory")
+#else
+#define OS_POSIX_MUTEX_CPU_RELAX() __asm__ __volatile__("" ::: "memory")
+#endif
 
 /* Tables where the OS object information is stored */
-OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
+OS_impl_mutex_internal_record_t *OS_impl_mutex_table;
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for locking an adaptive mutex, which retries for up to the
+ * spin time before blocking.  Returns 0 or an errno value, as pthread_mutex_lock().
+ ----------------------------------------------------------------------------------------*/
+static int OS_Posix_MutexAdaptiveLock(OS_impl_mutex_internal_record_t *impl)
+{
+    struct timespec start;
+    struct timespec now;
+    int             status;
+    uint32          i;
+
+    status = pthread_mutex_trylock(&impl->id);
+    if (status != EBUSY)
+    {
+        return status;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    do
+    {
+        for (i = 0; i < OS_POSIX_MUTEX_SPIN_BATCH; ++i)
+        {
+            OS_POSIX_MUTEX_CPU_RELAX();
+        }
+
+        status = pthread_mutex_trylock(&impl->id);
+        if (status != EBUSY)
+        {
+            if (status == 0)
+            {
+                __atomic_add_fetch(&impl->spin_count, 1, __ATOMIC_RELAXED);
+            }
+            return status;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while ((now.tv_sec - start.tv_sec) * 1000000000L + (now.tv_nsec - start.tv_nsec) < (long)impl->spin_nsec);
+
+    /* Still held by another task, so block with priority inheritance */
+    __atomic_add_fetch(&impl->block_count, 1, __ATOMIC_RELAXED);
+
+    return pthread_mutex_lock(&impl->id);
+}
 
 /****************************************************************************************
                                   MUTEX API
@@ -46,8 +110,7 @@ OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
  *-----------------------------------------------------------------*/
 int32 OS_Posix_MutexAPI_Impl_Init(void)
 {
-    memset(OS_impl_mutex_table, 0, sizeof(OS_impl_mutex_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_MUTEX, OS_impl_mutex_table);
 }
 
 /*----------------------------------------------------------------
@@ -64,6 +127,22 @@ int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
 
+    impl->spin_count  = 0;
+    impl->block_count = 0;
+    impl->spin_nsec   = 0;
+
+    /*
+    ** Spinning is pointless unless the holder can run at the same time
+    */
+    if ((options & OS_MUTEX_FLAG_ADAPTIVE) != 0 && sysconf(_SC_NPROCESSORS_ONLN) > 1)
+    {
+        impl->spin_nsec = (options >> 16) * 1000;
+        if (impl->spin_nsec == 0)
+        {
+            impl->spin_nsec = OS_MUTEX_DEFAULT_SPIN_USEC * 1000;
+        }
+    }
+
     /*
     ** initialize the attribute with default values
     */
@@ -76,9 +155,23 @@ int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
     }
 
     /*
-    ** Allow the mutex to use priority inheritance
+    ** Use the priority ceiling protocol if requested, which can only be
+    ** enforced if task priorities are in effect.  Otherwise allow the mutex
+    ** to use priority inheritance.
     */
-    return_code = pthread_mutexattr_setprotocol(&mutex_attr, PTHREAD_PRIO_INHERIT);
+    if ((options & OS_MUTEX_FLAG_PRIO_CEILING) != 0 && POSIX_GlobalVars.EnableTaskPriorities)
+    {
+        return_code = pthread_mutexattr_setprotocol(&mutex_attr, PTHREAD_PRIO_PROTECT);
+        if (return_code == 0)
+        {
+            return_code =
+                pthread_mutexattr_setprioceiling(&mutex_attr, OS_PriorityRemap((osal_priority_t)(options >> 8)));
+        }
+    }
+    else
+    {
+        return_code = pthread_mutexattr_setprotocol(&mutex_attr, PTHREAD_PRIO_INHERIT);
+    }
     if (return_code != 0)
     {
         OS_DEBUG("Error: Mutex could not be created. pthread_mutexattr_setprotocol failed ID = %lu: %s\n",
@@ -176,7 +269,14 @@ int32 OS_MutSemTake_Impl(const OS_object_token_t *token)
     /*
     ** Lock the mutex
     */
-    status = pthread_mutex_lock(&(impl->id));
+    if (impl->spin_nsec != 0)
+    {
+        status = OS_Posix_MutexAdaptiveLock(impl);
+    }
+    else
+    {
+        status = pthread_mutex_lock(&(impl->id));
+    }
     if (status != 0)
     {
         return OS_SEM_FAILURE;
@@ -193,5 +293,12 @@ int32 OS_MutSemTake_Impl(const OS_object_token_t *token)
  *-----------------------------------------------------------------*/
 int32 OS_MutSemGetInfo_Impl(const OS_object_token_t *token, OS_mut_sem_prop_t *mut_prop)
 {
+    OS_impl_mutex_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
+
+    mut_prop->spin_count  = __atomic_load_n(&impl->spin_count, __ATOMIC_RELAXED);
+    mut_prop->block_count = __atomic_load_n(&impl->block_count, __ATOMIC_RELAXED);
+
     return OS_SUCCESS;
 }
@@ -32,10 +32,2001 @@
 
 #include "os-impl-queues.h"
 #include "os-shared-queue.h"
+#include "os-shared-select.h"
 #include "os-shared-idmap.h"
+#include "os-shared-clock.h"
 
 /* Tables where the OS object information is stored */
-OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
+OS_impl_queue_internal_record_t *OS_impl_queue_table;
+
+/****************************************************************************************
+                                IN-PROCESS RING BUFFER
+ ***************************************************************************************/
+
+/*
+ * The ring buffer holds a lane for each message priority, each of which is a bounded
+ * multi-producer/multi-consumer queue in which each slot carries a sequence number.
+ * A producer may fill the slot at enqueue position "pos" once its sequence number
+ * equals "pos", and publishes it by setting the sequence number to "pos + 1".  A
+ * consumer may empty the slot at dequeue position "pos" once its sequence number
+ * equals "pos + 1", and frees it by advancing the sequence number by the number of
+ * slots.  Positions are claimed with a compare-and-swap, so no lock is needed unless
+ * a consumer has to wait for data or a producer has to wait for space.
+ *
+ * Every lane has enough slots for the whole depth of the queue, and the number of
+ * slots in use across all lanes is bounded by a separate count.  Consumers always
+ * take from the highest priority lane which has a message available.
+ *
+ * With a single producer and a single consumer, each position is only advanced by
+ * its owner, so it is simply stored rather than claimed with a compare-and-swap.
+ * The producer bounds the depth by comparing its position to the dequeue position,
+ * rather than by the count.  The sequence numbers still indicate whether a slot is
+ * free or filled, so slots may be committed or released out of order.  All
+ * messages go in the lane of the default priority, so they are kept in order.
+ *
+ * A packed queue instead holds its messages back to back in a single byte ring,
+ * each taking only the space of its own size.  As the space a message needs is
+ * not known until it is put, this is simply protected by the mutex rather than
+ * claimed atomically.  The same wait queues and wakeups are used as for lanes.
+ *
+ * A broadcast queue likewise holds its messages in slots protected by the mutex.
+ * Each message is written once, and each subscriber has its own read position in
+ * the same slots.  A subscriber which falls a whole queue depth behind either holds
+ * up the producer, or has its read position advanced past the oldest message.
+ */
+
+/*
+ * Size value in the header of a packed message, indicating that the space
+ * from here to the end of the byte ring was skipped
+ */
+#define OS_POSIX_QUEUE_PACKED_SKIP 0xFFFFFFFF
+
+/*
+ * Claims a slot for a producer or a consumer without waiting
+ */
+typedef int32 (*OS_Posix_QueueRingClaimFunc_t)(OS_impl_queue_ring_t *ring, uint32 priority,
+                                               OS_impl_queue_slot_t **slot_out);
+
+/*
+ * Checks whether a task waiting in OS_Posix_QueueLockedWait() may proceed
+ */
+typedef bool (*OS_Posix_QueueReadyFunc_t)(OS_impl_queue_ring_t *ring, const void *arg);
+
+/*
+ * State of a task waiting in OS_Posix_QueueRingWait() or OS_Posix_QueueLockedWait()
+ */
+typedef struct
+{
+    const OS_object_token_t *token; /**< reference to the queue held by the waiting task */
+    OS_impl_queue_ring_t *   ring;
+    OS_impl_queue_waitq_t *  waitq;
+} OS_Posix_QueueRingWaitState_t;
+
+/*---------------------------------------------------------------------------------------
+ * Checks whether the ring buffer, or the subscriber to it through which a task
+ * is waiting (if not NULL), is being deleted.  Must be called with the ring
+ * buffer locked.
+ ----------------------------------------------------------------------------------------*/
+static inline bool OS_Posix_QueueRingDeleted(OS_impl_queue_ring_t *ring, OS_impl_queue_reader_t *reader)
+{
+    return ring->deleting != 0 || (reader != NULL && reader->deleting != 0);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for leaving the wait in OS_Posix_QueueRingWait()
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingEndWait(OS_Posix_QueueRingWaitState_t *state)
+{
+    __atomic_sub_fetch(&state->waitq->waiters, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&state->ring->lock);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Cleanup handler invoked if the thread executing pthread_cond_wait() is canceled.
+ * Besides leaving the wait, this releases the reference to the queue held by the
+ * task, as it never returns to the shared layer to do so.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingCancelWait(void *arg)
+{
+    OS_Posix_QueueRingWaitState_t *state = arg;
+    OS_object_token_t              token;
+
+    OS_Posix_QueueRingEndWait(state);
+
+    token = *state->token;
+    OS_ObjectIdRelease(&token);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Gets the slot header for a given enqueue/dequeue position in a lane
+ ----------------------------------------------------------------------------------------*/
+static inline OS_impl_queue_slot_t *OS_Posix_QueueRingSlot(OS_impl_queue_ring_t *ring, OS_impl_queue_lane_t *lane,
+                                                           uint32 pos)
+{
+    return (OS_impl_queue_slot_t *)(void *)&lane->slots[(pos & ring->mask) * ring->stride];
+}
+
+/*---------------------------------------------------------------------------------------
+ * Finds the priority of the lane holding the given slot, or returns
+ * OS_QUEUE_PRIORITY_LEVELS if the address is not within any lane
+ ----------------------------------------------------------------------------------------*/
+static uint32 OS_Posix_QueueRingSlotPriority(OS_impl_queue_ring_t *ring, const void *addr)
+{
+    OS_impl_queue_lane_t *lane;
+    uint32                priority;
+
+    for (priority = 0; priority < OS_QUEUE_PRIORITY_LEVELS; ++priority)
+    {
+        lane = __atomic_load_n(&ring->lanes[priority], __ATOMIC_ACQUIRE);
+        if (lane != NULL && (const uint8 *)addr >= lane->slots &&
+            (const uint8 *)addr < &lane->slots[(ring->mask + 1) * ring->stride])
+        {
+            break;
+        }
+    }
+
+    return priority;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Allocates the lane for the given priority, which must not already exist
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingLaneCreate(OS_impl_queue_ring_t *ring, uint32 priority)
+{
+    OS_impl_queue_lane_t *lane;
+    OS_impl_queue_slot_t *slot;
+    uint32                i;
+
+    lane = malloc(sizeof(*lane) + ((ring->mask + 1) * ring->stride));
+    if (lane == NULL)
+    {
+        OS_DEBUG("Unable to allocate %lu slots of %lu bytes\n", (unsigned long)(ring->mask + 1),
+                 (unsigned long)ring->stride);
+        return OS_ERROR;
+    }
+
+    memset(lane, 0, sizeof(*lane));
+    lane->slots = (uint8 *)(lane + 1);
+
+    for (i = 0; i <= ring->mask; ++i)
+    {
+        slot       = OS_Posix_QueueRingSlot(ring, lane, i);
+        slot->seq  = i;
+        slot->size = 0;
+    }
+
+    /* The lane must be complete before consumers see it in lanes_used */
+    __atomic_store_n(&ring->lanes[priority], lane, __ATOMIC_RELEASE);
+    __atomic_or_fetch(&ring->lanes_used, 1U << priority, __ATOMIC_RELEASE);
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Ensures the lane for the given priority exists, allocating it on first use
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingLaneCheck(OS_impl_queue_ring_t *ring, uint32 priority)
+{
+    int32 return_code;
+
+    if ((__atomic_load_n(&ring->lanes_used, __ATOMIC_ACQUIRE) & (1U << priority)) != 0)
+    {
+        return OS_SUCCESS;
+    }
+
+    /* The mutex ensures only one producer allocates the lane */
+    pthread_mutex_lock(&ring->lock);
+    if ((ring->lanes_used & (1U << priority)) != 0)
+    {
+        return_code = OS_SUCCESS;
+    }
+    else
+    {
+        return_code = OS_Posix_QueueRingLaneCreate(ring, priority);
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Gets the space taken in a packed ring buffer by a message of the given size
+ ----------------------------------------------------------------------------------------*/
+static inline size_t OS_Posix_QueuePackedEntrySize(size_t size)
+{
+    size += sizeof(OS_impl_queue_slot_t);
+    return (size + sizeof(OS_impl_queue_slot_t) - 1) & ~(sizeof(OS_impl_queue_slot_t) - 1);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Allocates the byte ring of a packed queue, within the given budget
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueuePackedCreate(OS_impl_queue_ring_t *ring, size_t max_bytes)
+{
+    OS_impl_queue_packed_t *packed;
+    size_t                  capacity;
+
+    /* Rounded down so that the memory held for messages never exceeds the budget */
+    capacity = max_bytes & ~(sizeof(OS_impl_queue_slot_t) - 1);
+    if (capacity < ring->stride)
+    {
+        OS_DEBUG("OS_QueueCreate Error. Budget of %lu bytes cannot hold a message with its header\n",
+                 (unsigned long)max_bytes);
+        return OS_QUEUE_INVALID_SIZE;
+    }
+
+    packed = malloc(sizeof(*packed) + capacity);
+    if (packed == NULL)
+    {
+        OS_DEBUG("Unable to allocate %lu bytes\n", (unsigned long)capacity);
+        return OS_ERROR;
+    }
+
+    memset(packed, 0, sizeof(*packed));
+    packed->capacity = capacity;
+    packed->bytes    = (uint8 *)(packed + 1);
+
+    ring->packed = packed;
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Allocates the slots of a broadcast queue
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueBcastCreate(OS_impl_queue_ring_t *ring)
+{
+    OS_impl_queue_bcast_t *bcast;
+    size_t                 slots_size;
+
+    slots_size = (ring->mask + 1) * ring->stride;
+
+    bcast = malloc(sizeof(*bcast) + slots_size);
+    if (bcast == NULL)
+    {
+        OS_DEBUG("Unable to allocate %lu bytes\n", (unsigned long)slots_size);
+        return OS_ERROR;
+    }
+
+    memset(bcast, 0, sizeof(*bcast));
+    bcast->slots = (uint8 *)(bcast + 1);
+
+    ring->bcast = bcast;
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Allocates and initializes a ring buffer for the given queue
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingCreate(OS_impl_queue_internal_record_t *impl, OS_queue_internal_record_t *queue,
+                                      uint32 flags)
+{
+    OS_impl_queue_ring_t *ring;
+    size_t                stride;
+    uint32                num_slots;
+    int32                 return_code;
+    int                   ret;
+
+    if (queue->max_depth == 0)
+    {
+        OS_DEBUG("OS_QueueCreate Error. Queue depth must be nonzero\n");
+        return OS_ERROR;
+    }
+
+    /*
+     * The number of slots is rounded up to a power of two, but only max_depth will be used.
+     * There are at least two, as with only one the sequence number of a slot would be the
+     * same whether it was freed or still held by a consumer.
+     */
+    num_slots = 2;
+    while (num_slots < queue->max_depth)
+    {
+        num_slots <<= 1;
+    }
+
+    /* Each slot is kept aligned to the header, which is followed by the data */
+    stride = sizeof(OS_impl_queue_slot_t) + queue->max_size;
+    stride = (stride + sizeof(OS_impl_queue_slot_t) - 1) & ~(sizeof(OS_impl_queue_slot_t) - 1);
+
+    ring = malloc(sizeof(*ring));
+    if (ring == NULL)
+    {
+        OS_DEBUG("OS_QueueCreate Error. Unable to allocate ring buffer\n");
+        return OS_ERROR;
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    ring->mask   = num_slots - 1;
+    ring->depth  = queue->max_depth;
+    ring->stride = stride;
+    ring->spsc   = ((flags & OS_QUEUE_FLAG_SPSC) != 0);
+
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    ring->queue = queue;
+#endif
+
+    if (queue->max_bytes != 0)
+    {
+        return_code = OS_Posix_QueuePackedCreate(ring, queue->max_bytes);
+    }
+    else if ((flags & OS_QUEUE_FLAG_BROADCAST) != 0)
+    {
+        return_code = OS_Posix_QueueBcastCreate(ring);
+    }
+    else
+    {
+        /* The lane for the default priority is always allocated up front */
+        return_code = OS_Posix_QueueRingLaneCreate(ring, 0);
+    }
+    if (return_code != OS_SUCCESS)
+    {
+        free(ring);
+        return return_code;
+    }
+
+    ret = pthread_mutex_init(&ring->lock, NULL);
+    if (ret != 0)
+    {
+        OS_DEBUG("Error: pthread_mutex_init failed: %s\n", strerror(ret));
+        free(ring->lanes[0]);
+        free(ring->packed);
+        free(ring->bcast);
+        free(ring);
+        return OS_ERROR;
+    }
+
+    ret = pthread_cond_init(&ring->not_empty.cond, NULL);
+    if (ret != 0)
+    {
+        OS_DEBUG("Error: pthread_cond_init failed: %s\n", strerror(ret));
+        pthread_mutex_destroy(&ring->lock);
+        free(ring->lanes[0]);
+        free(ring->packed);
+        free(ring->bcast);
+        free(ring);
+        return OS_ERROR;
+    }
+
+    ret = pthread_cond_init(&ring->not_full.cond, NULL);
+    if (ret != 0)
+    {
+        OS_DEBUG("Error: pthread_cond_init failed: %s\n", strerror(ret));
+        pthread_cond_destroy(&ring->not_empty.cond);
+        pthread_mutex_destroy(&ring->lock);
+        free(ring->lanes[0]);
+        free(ring->packed);
+        free(ring->bcast);
+        free(ring);
+        return OS_ERROR;
+    }
+
+    impl->ring = ring;
+
+    /* Operations on the queue use the ring buffer, so it must not be freed meanwhile */
+    queue->referenced = true;
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Gets the lane to use for a message put with the given flags
+ ----------------------------------------------------------------------------------------*/
+static inline uint32 OS_Posix_QueueRingPriority(OS_impl_queue_ring_t *ring, uint32 flags)
+{
+    /* A single producer queue only uses the default lane, so messages stay in order */
+    if (ring->spsc)
+    {
+        return 0;
+    }
+
+    return OS_QUEUE_FLAGS_PRIORITY(flags);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Claims the next free slot for the producer of a single producer queue, without waiting
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingClaimPutSingle(OS_impl_queue_ring_t *ring, OS_impl_queue_slot_t **slot_out)
+{
+    OS_impl_queue_lane_t *lane;
+    OS_impl_queue_slot_t *slot;
+    uint32                pos;
+
+    lane = ring->lanes[0];
+    pos  = __atomic_load_n(&lane->enqueue_pos, __ATOMIC_RELAXED);
+    slot = OS_Posix_QueueRingSlot(ring, lane, pos);
+
+    /* The consumer of the previous lap may still be using the slot, even within the depth */
+    if ((pos - __atomic_load_n(&lane->dequeue_pos, __ATOMIC_RELAXED)) >= ring->depth ||
+        __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != pos)
+    {
+        return OS_QUEUE_FULL;
+    }
+
+    __atomic_store_n(&lane->enqueue_pos, pos + 1, __ATOMIC_RELAXED);
+
+    *slot_out = slot;
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Claims the next free slot in the lane of the given priority for a producer, without
+ * waiting.  The lane must exist, see OS_Posix_QueueRingLaneCheck().
+ * The slot must subsequently be passed to OS_Posix_QueueRingPublish().
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingClaimPut(OS_impl_queue_ring_t *ring, uint32 priority, OS_impl_queue_slot_t **slot_out)
+{
+    OS_impl_queue_lane_t *lane;
+    OS_impl_queue_slot_t *slot;
+    uint32                count;
+    uint32                pos;
+    int32                 diff;
+
+    if (ring->spsc)
+    {
+        return OS_Posix_QueueRingClaimPutSingle(ring, slot_out);
+    }
+
+    /*
+     * First reserve room within the depth of the queue.  The count is only
+     * reduced once a slot is freed, so this ensures the lane has a slot
+     * for this message unless a consumer is still emptying it.
+     */
+    count = __atomic_load_n(&ring->count, __ATOMIC_RELAXED);
+    do
+    {
+        if (count >= ring->depth)
+        {
+            return OS_QUEUE_FULL;
+        }
+    } while (!__atomic_compare_exchange_n(&ring->count, &count, count + 1, true, __ATOMIC_ACQUIRE,
+                                          __ATOMIC_RELAXED));
+
+    lane = ring->lanes[priority];
+
+    while (true)
+    {
+        pos  = __atomic_load_n(&lane->enqueue_pos, __ATOMIC_RELAXED);
+        slot = OS_Posix_QueueRingSlot(ring, lane, pos);
+        diff = (int32)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - pos);
+
+        if (diff < 0)
+        {
+            /* the consumer of the previous lap has not yet freed this slot */
+            __atomic_sub_fetch(&ring->count, 1, __ATOMIC_RELAXED);
+            return OS_QUEUE_FULL;
+        }
+
+        if (diff == 0 && __atomic_compare_exchange_n(&lane->enqueue_pos, &pos, pos + 1, false, __ATOMIC_RELAXED,
+                                                     __ATOMIC_RELAXED))
+        {
+            break;
+        }
+
+        /* another producer claimed this position first, so try again */
+    }
+
+    *slot_out = slot;
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Makes a filled slot available to consumers.
+ * This must be followed by OS_Posix_QueueRingWake() to wake any waiting consumer.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingPublish(OS_impl_queue_ring_t *ring, OS_impl_queue_slot_t *slot)
+{
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_GetMonotonicTime_Impl(&slot->stamp);
+#endif
+
+    /* The claimed slot holds the sequence number of its position, "pos" */
+    __atomic_store_n(&slot->seq, slot->seq + 1, __ATOMIC_RELEASE);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Wakes the tasks waiting on the ring buffer in OS_SelectMultiple() for the given state,
+ * by writing to the pipe of each.  Must be called with the ring buffer locked.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingWakeSelectors(OS_impl_queue_ring_t *ring, uint32 state)
+{
+    static const uint8        wakeup = 1;
+    OS_impl_queue_selector_t *selector;
+    int                       cancel_state;
+
+    /* The lock is held, so the task must not be canceled in write() */
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel_state);
+
+    for (selector = ring->selectors; selector != NULL; selector = selector->next)
+    {
+        if ((selector->flags & state) != 0 && write(selector->wake_fd, &wakeup, sizeof(wakeup)) < 0)
+        {
+            /* the pipe is already full, so the task will be woken anyway */
+        }
+    }
+
+    pthread_setcancelstate(cancel_state, NULL);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Wakes tasks waiting on the ring buffer, if any, after "count" slots were published
+ * (for not_empty) or freed (for not_full).  Must be called with the ring buffer locked.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingWakeLocked(OS_impl_queue_ring_t *ring, OS_impl_queue_waitq_t *waitq, uint32 count)
+{
+    if (waitq->waiters == 0)
+    {
+        return;
+    }
+
+    if (count > 1)
+    {
+        pthread_cond_broadcast(&waitq->cond);
+    }
+    else
+    {
+        pthread_cond_signal(&waitq->cond);
+    }
+    if (waitq->selectors != 0)
+    {
+        OS_Posix_QueueRingWakeSelectors(ring, (waitq == &ring->not_empty) ? OS_STREAM_STATE_READABLE
+                                                                          : OS_STREAM_STATE_WRITABLE);
+    }
+}
+
+/*---------------------------------------------------------------------------------------
+ * Wakes tasks waiting on the ring buffer, if any, after "count" slots were
+ * published (for not_empty) or freed (for not_full)
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingWake(OS_impl_queue_ring_t *ring, OS_impl_queue_waitq_t *waitq, uint32 count)
+{
+    /*
+     * Pairs with the increment of waiters in OS_Posix_QueueRingWait(): either
+     * the waiter sees the new state of the slot before it waits, or this sees the waiter.
+     * The mutex is taken so the signal cannot be sent between the waiter
+     * checking the ring and waiting on the condition.
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&waitq->waiters, __ATOMIC_RELAXED) != 0)
+    {
+        pthread_mutex_lock(&ring->lock);
+        OS_Posix_QueueRingWakeLocked(ring, waitq, count);
+        pthread_mutex_unlock(&ring->lock);
+    }
+}
+
+/*---------------------------------------------------------------------------------------
+ * Marks the ring buffer, or the given subscriber to it (if not NULL), as about to be
+ * deleted, or no longer so.  The tasks waiting on it are woken, and give up while it
+ * is marked, releasing their references to the queue.
+ *
+ * A ring buffer with slots still handed out to the application by OS_QueueReserve()
+ * or OS_QueueGetRef() cannot be deleted, as the application would be left with
+ * pointers to freed memory.  Nor can a broadcast queue with subscribers, which hold
+ * references to it, so it is refused here rather than waking the tasks using it.
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingDeletePending(OS_impl_queue_ring_t *ring, OS_impl_queue_reader_t *reader,
+                                             bool pending)
+{
+    uint32 *deleting;
+
+    deleting = (reader != NULL) ? &reader->deleting : &ring->deleting;
+
+    if (pending && reader == NULL && __atomic_load_n(&ring->handed_out, __ATOMIC_ACQUIRE) != 0)
+    {
+        OS_DEBUG("OS_QueueDelete Error. Queue entries are still reserved or referenced\n");
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    pthread_mutex_lock(&ring->lock);
+    if (pending && reader == NULL && ring->bcast != NULL && ring->bcast->readers != NULL)
+    {
+        pthread_mutex_unlock(&ring->lock);
+        OS_DEBUG("OS_QueueDelete Error. Broadcast queue still has subscribers\n");
+        return OS_ERR_OBJECT_IN_USE;
+    }
+    if (pending)
+    {
+        ++*deleting;
+        OS_Posix_QueueRingWakeLocked(ring, &ring->not_empty, UINT32_MAX);
+        OS_Posix_QueueRingWakeLocked(ring, &ring->not_full, UINT32_MAX);
+    }
+    else
+    {
+        --*deleting;
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Releases the resources associated with a ring buffer
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingDelete(OS_impl_queue_internal_record_t *impl)
+{
+    OS_impl_queue_ring_t *ring;
+    uint32                priority;
+
+    ring = impl->ring;
+
+    pthread_mutex_lock(&ring->lock);
+
+    if (ring->bcast != NULL && ring->bcast->readers != NULL)
+    {
+        pthread_mutex_unlock(&ring->lock);
+        OS_DEBUG("OS_QueueDelete Error. Broadcast queue still has subscribers\n");
+        return OS_ERR_OBJECT_IN_USE;
+    }
+
+    /* An entry may have been handed out after the queue was marked, before it was locked */
+    if (__atomic_load_n(&ring->handed_out, __ATOMIC_ACQUIRE) != 0)
+    {
+        pthread_mutex_unlock(&ring->lock);
+        OS_DEBUG("OS_QueueDelete Error. Queue entries are still reserved or referenced\n");
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    /*
+     * The tasks using the queue, including those in OS_SelectMultiple(), held
+     * references to it, so they are already done with the ring buffer.
+     */
+    pthread_mutex_unlock(&ring->lock);
+
+    pthread_cond_destroy(&ring->not_full.cond);
+    pthread_cond_destroy(&ring->not_empty.cond);
+    pthread_mutex_destroy(&ring->lock);
+    for (priority = 0; priority < OS_QUEUE_PRIORITY_LEVELS; ++priority)
+    {
+        free(ring->lanes[priority]);
+    }
+    free(ring->packed);
+    free(ring->bcast);
+    free(ring);
+    impl->ring = NULL;
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Claims the oldest filled slot for the consumer of a single consumer queue, without waiting
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingClaimGetSingle(OS_impl_queue_ring_t *ring, OS_impl_queue_slot_t **slot_out)
+{
+    OS_impl_queue_lane_t *lane;
+    OS_impl_queue_slot_t *slot;
+    uint32                pos;
+
+    lane = ring->lanes[0];
+    pos  = __atomic_load_n(&lane->dequeue_pos, __ATOMIC_RELAXED);
+    slot = OS_Posix_QueueRingSlot(ring, lane, pos);
+
+    if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != pos + 1)
+    {
+        return OS_QUEUE_EMPTY;
+    }
+
+    __atomic_store_n(&lane->dequeue_pos, pos + 1, __ATOMIC_RELAXED);
+
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_QueueStatsLatency(ring->queue, slot->stamp);
+#endif
+    *slot_out = slot;
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Claims the oldest filled slot of the highest priority lane for a consumer, without
+ * waiting.  The priority argument is not used, as the lane is chosen by this function.
+ * The slot must subsequently be passed to OS_Posix_QueueRingFree().
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingClaimGet(OS_impl_queue_ring_t *ring, uint32 priority, OS_impl_queue_slot_t **slot_out)
+{
+    OS_impl_queue_lane_t *lane;
+    OS_impl_queue_slot_t *slot;
+    uint32                lanes_used;
+    uint32                pos;
+    int32                 diff;
+
+    if (ring->spsc)
+    {
+        return OS_Posix_QueueRingClaimGetSingle(ring, slot_out);
+    }
+
+    lanes_used = __atomic_load_n(&ring->lanes_used, __ATOMIC_ACQUIRE);
+
+    priority = OS_QUEUE_PRIORITY_LEVELS;
+    while (priority > 0)
+    {
+        --priority;
+        if ((lanes_used & (1U << priority)) == 0)
+        {
+            continue;
+        }
+
+        lane = ring->lanes[priority];
+        while (true)
+        {
+            pos  = __atomic_load_n(&lane->dequeue_pos, __ATOMIC_RELAXED);
+            slot = OS_Posix_QueueRingSlot(ring, lane, pos);
+            diff = (int32)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - (pos + 1));
+
+            if (diff < 0)
+            {
+                /* the producer has not yet filled this slot, so try the next lane */
+                break;
+            }
+
+            if (diff == 0 && __atomic_compare_exchange_n(&lane->dequeue_pos, &pos, pos + 1, false,
+                                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+#ifdef OSAL_CONFIG_QUEUE_STATS
+                OS_QueueStatsLatency(ring->queue, slot->stamp);
+#endif
+                *slot_out = slot;
+                return OS_SUCCESS;
+            }
+
+            /* another consumer claimed this position first, so try again */
+        }
+    }
+
+    return OS_QUEUE_EMPTY;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Returns a consumed slot to the ring buffer, for use by the producer on the next lap.
+ * This must be followed by OS_Posix_QueueRingWake() to wake any waiting producer.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingFree(OS_impl_queue_ring_t *ring, OS_impl_queue_slot_t *slot)
+{
+    /* The filled slot holds "pos + 1", and it is next filled at "pos + mask + 1" */
+    __atomic_store_n(&slot->seq, slot->seq + ring->mask, __ATOMIC_RELEASE);
+
+    /* Pairs with the acquire in OS_Posix_QueueRingClaimPut(), so the free slot is seen there */
+    if (!ring->spsc)
+    {
+        __atomic_sub_fetch(&ring->count, 1, __ATOMIC_RELEASE);
+    }
+}
+
+/*---------------------------------------------------------------------------------------
+ * Claims a slot in the ring buffer using the given function, waiting up to the
+ * timeout on the given wait queue if none is available
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingWait(const OS_object_token_t *token, OS_impl_queue_ring_t *ring,
+                                    OS_impl_queue_waitq_t *waitq, OS_Posix_QueueRingClaimFunc_t claim_func,
+                                    uint32 priority, OS_impl_queue_slot_t **slot_out, int32 timeout)
+{
+    int32                         return_code;
+    struct timespec               ts;
+    OS_Posix_QueueRingWaitState_t state;
+
+    /* Fast path, does not involve the mutex at all */
+    return_code = claim_func(ring, priority, slot_out);
+    if (return_code == OS_SUCCESS || timeout == OS_CHECK)
+    {
+        return return_code;
+    }
+
+    if (timeout != OS_PEND)
+    {
+        OS_Posix_CompAbsDelayTime(timeout, &ts);
+    }
+
+    state.token = token;
+    state.ring  = ring;
+    state.waitq = waitq;
+
+    pthread_mutex_lock(&ring->lock);
+    __atomic_add_fetch(&waitq->waiters, 1, __ATOMIC_SEQ_CST);
+
+    /* pthread_cond_wait() is a cancellation point, so also end the wait if canceled */
+    pthread_cleanup_push(OS_Posix_QueueRingCancelWait, &state);
+
+    while (true)
+    {
+        if (ring->deleting != 0)
+        {
+            return_code = OS_ERR_INVALID_ID;
+            break;
+        }
+
+        return_code = claim_func(ring, priority, slot_out);
+        if (return_code == OS_SUCCESS)
+        {
+            break;
+        }
+
+        if (timeout == OS_PEND)
+        {
+            pthread_cond_wait(&waitq->cond, &ring->lock);
+        }
+        else if (pthread_cond_timedwait(&waitq->cond, &ring->lock, &ts) == ETIMEDOUT)
+        {
+            /* one last check, in case a slot became available just as the wait timed out */
+            if (ring->deleting != 0)
+            {
+                return_code = OS_ERR_INVALID_ID;
+            }
+            else if (claim_func(ring, priority, slot_out) != OS_SUCCESS)
+            {
+                return_code = OS_QUEUE_TIMEOUT;
+            }
+            else
+            {
+                return_code = OS_SUCCESS;
+            }
+            break;
+        }
+    }
+
+    /* The handler is not executed, as the reference is still needed by the caller */
+    pthread_cleanup_pop(false);
+
+    OS_Posix_QueueRingEndWait(&state);
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Waits up to the timeout on the given wait queue until the ready function returns true.
+ * This is used where the ring buffer is only accessed with the mutex held, so it must
+ * be called with the ring buffer locked, which it still is on return.  A task waiting
+ * through a subscriber passes it as reader, so it gives up if the subscriber is deleted.
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueLockedWait(const OS_object_token_t *token, OS_impl_queue_ring_t *ring,
+                                      OS_impl_queue_waitq_t *waitq, OS_Posix_QueueReadyFunc_t ready_func,
+                                      const void *arg, OS_impl_queue_reader_t *reader, int32 timeout)
+{
+    int32                         return_code;
+    struct timespec               ts;
+    OS_Posix_QueueRingWaitState_t state;
+
+    if (OS_Posix_QueueRingDeleted(ring, reader))
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (ready_func(ring, arg))
+    {
+        return OS_SUCCESS;
+    }
+
+    if (timeout == OS_CHECK)
+    {
+        return (waitq == &ring->not_empty) ? OS_QUEUE_EMPTY : OS_QUEUE_FULL;
+    }
+
+    if (timeout != OS_PEND)
+    {
+        OS_Posix_CompAbsDelayTime(timeout, &ts);
+    }
+
+    state.token = token;
+    state.ring  = ring;
+    state.waitq = waitq;
+
+    __atomic_add_fetch(&waitq->waiters, 1, __ATOMIC_SEQ_CST);
+
+    /* pthread_cond_wait() is a cancellation point, so also end the wait if canceled */
+    pthread_cleanup_push(OS_Posix_QueueRingCancelWait, &state);
+
+    return_code = OS_SUCCESS;
+    while (!OS_Posix_QueueRingDeleted(ring, reader) && !ready_func(ring, arg))
+    {
+        if (timeout == OS_PEND)
+        {
+            pthread_cond_wait(&waitq->cond, &ring->lock);
+        }
+        else if (pthread_cond_timedwait(&waitq->cond, &ring->lock, &ts) == ETIMEDOUT)
+        {
+            /* one last check, in case the state changed just as the wait timed out */
+            if (!ready_func(ring, arg))
+            {
+                return_code = OS_QUEUE_TIMEOUT;
+            }
+            break;
+        }
+    }
+
+    if (OS_Posix_QueueRingDeleted(ring, reader))
+    {
+        return_code = OS_ERR_INVALID_ID;
+    }
+
+    /* The handler is not executed, as the caller goes on to use the ring with the mutex held */
+    pthread_cleanup_pop(false);
+
+    __atomic_sub_fetch(&waitq->waiters, 1, __ATOMIC_SEQ_CST);
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Finds the slot holding the message data at the given address, if the address is
+ * that of the data in one of the slots of the ring buffer, and the slot is either
+ * claimed by a producer but not yet published (if reserved is set) or claimed by
+ * a consumer but not yet freed.  This is the state OS_QueueReserve() or
+ * OS_QueueGetRef() leaves the slot in, so a slot can only be committed or released
+ * once, and not before it was handed out.
+ ----------------------------------------------------------------------------------------*/
+static OS_impl_queue_slot_t *OS_Posix_QueueRingSlotFromData(OS_impl_queue_ring_t *ring, const void *data,
+                                                            bool reserved)
+{
+    OS_impl_queue_lane_t *lane;
+    OS_impl_queue_slot_t *slot;
+    uint32                priority;
+    uint32                pos;
+    uint32                claimed;
+    size_t                offset;
+
+    priority = OS_Posix_QueueRingSlotPriority(ring, (const uint8 *)data - sizeof(OS_impl_queue_slot_t));
+    if (priority >= OS_QUEUE_PRIORITY_LEVELS)
+    {
+        return NULL;
+    }
+
+    lane   = ring->lanes[priority];
+    offset = (size_t)((const uint8 *)data - lane->slots) - sizeof(OS_impl_queue_slot_t);
+    if ((offset % ring->stride) != 0)
+    {
+        return NULL;
+    }
+
+    /*
+     * A claimed slot holds the sequence number of its position, "pos", until it is
+     * published, then "pos + 1" until it is freed.  The position must also be one
+     * of the last mask + 1 claimed, or the slot is still free.
+     */
+    slot = (OS_impl_queue_slot_t *)(void *)&lane->slots[offset];
+    pos  = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+    if (reserved)
+    {
+        claimed = __atomic_load_n(&lane->enqueue_pos, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        claimed = __atomic_load_n(&lane->dequeue_pos, __ATOMIC_RELAXED);
+        --pos;
+    }
+
+    if ((pos & ring->mask) != (offset / ring->stride) || (claimed - pos - 1) > ring->mask)
+    {
+        return NULL;
+    }
+
+    return slot;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Finds where a message taking entry_size bytes would be put in a packed ring buffer,
+ * returning false if there is not currently enough space for it
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_QueuePackedFit(OS_impl_queue_packed_t *packed, size_t entry_size, size_t *offset)
+{
+    if (packed->tail > packed->head || packed->used == 0)
+    {
+        /* The free space is after the tail, and before the head once wrapped around */
+        if (packed->capacity - packed->tail >= entry_size)
+        {
+            *offset = packed->tail;
+            return true;
+        }
+        if (packed->head >= entry_size)
+        {
+            *offset = 0;
+            return true;
+        }
+        return false;
+    }
+
+    /* The free space is between the tail and the head, which is none if full */
+    *offset = packed->tail;
+    return (packed->head - packed->tail) >= entry_size;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Checks whether a packed ring buffer has space for a message taking the number of
+ * bytes pointed to by arg
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_QueuePackedHasSpace(OS_impl_queue_ring_t *ring, const void *arg)
+{
+    size_t offset;
+
+    return OS_Posix_QueuePackedFit(ring->packed, *(const size_t *)arg, &offset);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Checks whether a packed ring buffer holds a message
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_QueuePackedHasMessage(OS_impl_queue_ring_t *ring, const void *arg)
+{
+    return ring->packed->used != 0;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies a message into a packed ring buffer, which must have space for it
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueuePackedWrite(OS_impl_queue_packed_t *packed, const void *data, size_t size)
+{
+    OS_impl_queue_slot_t *slot;
+    size_t                entry_size;
+    size_t                offset;
+
+    entry_size = OS_Posix_QueuePackedEntrySize(size);
+    OS_Posix_QueuePackedFit(packed, entry_size, &offset);
+
+    /* The space at the end of the ring is too small, so mark it as skipped */
+    if (offset != packed->tail)
+    {
+        slot       = (OS_impl_queue_slot_t *)(void *)&packed->bytes[packed->tail];
+        slot->size = OS_POSIX_QUEUE_PACKED_SKIP;
+        packed->used += packed->capacity - packed->tail;
+    }
+
+    slot       = (OS_impl_queue_slot_t *)(void *)&packed->bytes[offset];
+    slot->size = size;
+    memcpy(slot + 1, data, size);
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_GetMonotonicTime_Impl(&slot->stamp);
+#endif
+
+    packed->tail = offset + entry_size;
+    if (packed->tail == packed->capacity)
+    {
+        packed->tail = 0;
+    }
+    packed->used += entry_size;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Removes the oldest message from a packed ring buffer, along with any space
+ * skipped after it
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueuePackedRemove(OS_impl_queue_packed_t *packed)
+{
+    OS_impl_queue_slot_t *slot;
+    size_t                entry_size;
+
+    slot       = (OS_impl_queue_slot_t *)(void *)&packed->bytes[packed->head];
+    entry_size = OS_Posix_QueuePackedEntrySize(slot->size);
+
+    packed->head += entry_size;
+    packed->used -= entry_size;
+    if (packed->head == packed->capacity)
+    {
+        packed->head = 0;
+    }
+
+    if (packed->used == 0)
+    {
+        /* Starting over from the beginning leaves the most contiguous space */
+        packed->head = 0;
+        packed->tail = 0;
+    }
+    else if (((OS_impl_queue_slot_t *)(void *)&packed->bytes[packed->head])->size == OS_POSIX_QUEUE_PACKED_SKIP)
+    {
+        packed->used -= packed->capacity - packed->head;
+        packed->head = 0;
+    }
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies the oldest message out of a packed ring buffer, which must hold a message
+ ----------------------------------------------------------------------------------------*/
+static size_t OS_Posix_QueuePackedRead(OS_impl_queue_ring_t *ring, void *data)
+{
+    OS_impl_queue_slot_t *slot;
+    size_t                size;
+
+    /* The shared layer ensures the buffer is at least as large as any message */
+    slot = (OS_impl_queue_slot_t *)(void *)&ring->packed->bytes[ring->packed->head];
+    size = slot->size;
+    memcpy(data, slot + 1, size);
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_QueueStatsLatency(ring->queue, slot->stamp);
+#endif
+
+    OS_Posix_QueuePackedRemove(ring->packed);
+
+    return size;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies a message into a packed ring buffer, waiting up to the timeout if full
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueuePackedPut(const OS_object_token_t *token, OS_impl_queue_ring_t *ring, const void *data,
+                                     size_t size, int32 timeout)
+{
+    int32  return_code;
+    size_t entry_size;
+
+    entry_size = OS_Posix_QueuePackedEntrySize(size);
+
+    pthread_mutex_lock(&ring->lock);
+    return_code = OS_Posix_QueueLockedWait(token, ring, &ring->not_full, OS_Posix_QueuePackedHasSpace, &entry_size,
+                                           NULL, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        OS_Posix_QueuePackedWrite(ring->packed, data, size);
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    if (return_code == OS_SUCCESS)
+    {
+        OS_Posix_QueueRingWake(ring, &ring->not_empty, 1);
+    }
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies a message out of a packed ring buffer, waiting up to the timeout if empty
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueuePackedGet(const OS_object_token_t *token, OS_impl_queue_ring_t *ring, void *data,
+                                     size_t *size_copied, uint32 *priority, int32 timeout)
+{
+    int32 return_code;
+
+    *size_copied = OSAL_SIZE_C(0);
+
+    pthread_mutex_lock(&ring->lock);
+    return_code =
+        OS_Posix_QueueLockedWait(token, ring, &ring->not_empty, OS_Posix_QueuePackedHasMessage, NULL, NULL, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        *size_copied = OS_Posix_QueuePackedRead(ring, data);
+        *priority    = 0;
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    /*
+     * The space freed may be enough for several smaller messages,
+     * so all waiting producers are woken to check for themselves
+     */
+    if (return_code == OS_SUCCESS)
+    {
+        OS_Posix_QueueRingWake(ring, &ring->not_full, UINT32_MAX);
+    }
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies several messages into a packed ring buffer, waking consumers only once
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueuePackedPutMultiple(const OS_object_token_t *token, OS_impl_queue_ring_t *ring,
+                                             const uint8 *data, size_t size, const size_t *sizes, uint32 count,
+                                             uint32 *count_put)
+{
+    int32  return_code;
+    size_t entry_size;
+    uint32 i;
+
+    return_code = OS_SUCCESS;
+
+    pthread_mutex_lock(&ring->lock);
+    for (i = 0; i < count; ++i)
+    {
+        entry_size  = OS_Posix_QueuePackedEntrySize(sizes[i]);
+        return_code  = OS_Posix_QueueLockedWait(token, ring, &ring->not_full, OS_Posix_QueuePackedHasSpace,
+                                                &entry_size, NULL, OS_CHECK);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        OS_Posix_QueuePackedWrite(ring->packed, &data[i * size], sizes[i]);
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    if (i > 0)
+    {
+        OS_Posix_QueueRingWake(ring, &ring->not_empty, i);
+    }
+
+    *count_put = i;
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies several messages out of a packed ring buffer, waiting up to the timeout
+ * only for the first one
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueuePackedGetMultiple(const OS_object_token_t *token, OS_impl_queue_ring_t *ring, uint8 *data,
+                                             size_t size, size_t *sizes, uint32 max_count, uint32 *count_copied,
+                                             int32 timeout)
+{
+    int32  return_code;
+    uint32 i;
+
+    i = 0;
+
+    pthread_mutex_lock(&ring->lock);
+    return_code =
+        OS_Posix_QueueLockedWait(token, ring, &ring->not_empty, OS_Posix_QueuePackedHasMessage, NULL, NULL, timeout);
+    while (return_code == OS_SUCCESS && i < max_count && ring->packed->used != 0)
+    {
+        sizes[i] = OS_Posix_QueuePackedRead(ring, &data[i * size]);
+        ++i;
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    *count_copied = i;
+
+    if (i > 0)
+    {
+        OS_Posix_QueueRingWake(ring, &ring->not_full, UINT32_MAX);
+    }
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Gets the slot for a given position in a broadcast ring buffer
+ ----------------------------------------------------------------------------------------*/
+static inline OS_impl_queue_slot_t *OS_Posix_QueueBcastSlot(OS_impl_queue_ring_t *ring, uint32 pos)
+{
+    return (OS_impl_queue_slot_t *)(void *)&ring->bcast->slots[(pos & ring->mask) * ring->stride];
+}
+
+/*---------------------------------------------------------------------------------------
+ * Checks whether a message can be put on a broadcast ring buffer, which is not the case
+ * while any subscriber that does not drop messages is a whole queue depth behind
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_QueueBcastHasSpace(OS_impl_queue_ring_t *ring, const void *arg)
+{
+    OS_impl_queue_reader_t *reader;
+
+    for (reader = ring->bcast->readers; reader != NULL; reader = reader->next)
+    {
+        if (!reader->drop_oldest && (ring->bcast->write_pos - reader->read_pos) >= ring->depth)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Checks whether the subscriber pointed to by arg has a message to receive
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_QueueBcastHasMessage(OS_impl_queue_ring_t *ring, const void *arg)
+{
+    const OS_impl_queue_reader_t *reader = arg;
+
+    return reader->read_pos != ring->bcast->write_pos;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies a message into a broadcast ring buffer, which must have space for it
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueBcastWrite(OS_impl_queue_ring_t *ring, const void *data, size_t size)
+{
+    OS_impl_queue_bcast_t * bcast;
+    OS_impl_queue_reader_t *reader;
+    OS_impl_queue_slot_t *  slot;
+
+    bcast = ring->bcast;
+
+    /* Any subscriber which has not yet received the oldest message loses it */
+    for (reader = bcast->readers; reader != NULL; reader = reader->next)
+    {
+        if ((bcast->write_pos - reader->read_pos) >= ring->depth)
+        {
+            ++reader->read_pos;
+#ifdef OSAL_CONFIG_QUEUE_STATS
+            OS_QueueStatsDrop(reader->queue, 1);
+#endif
+        }
+    }
+
+    slot       = OS_Posix_QueueBcastSlot(ring, bcast->write_pos);
+    slot->size = size;
+    memcpy(slot + 1, data, size);
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_GetMonotonicTime_Impl(&slot->stamp);
+#endif
+
+    ++bcast->write_pos;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies the next message for a subscriber out of its broadcast ring buffer,
+ * which must hold one
+ ----------------------------------------------------------------------------------------*/
+static size_t OS_Posix_QueueBcastRead(OS_impl_queue_reader_t *reader, void *data)
+{
+    OS_impl_queue_slot_t *slot;
+
+    /* The shared layer ensures the buffer is at least as large as any message */
+    slot = OS_Posix_QueueBcastSlot(reader->source, reader->read_pos);
+    memcpy(data, slot + 1, slot->size);
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_QueueStatsLatency(reader->queue, slot->stamp);
+#endif
+
+    ++reader->read_pos;
+
+    return slot->size;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies a message into a broadcast ring buffer, waiting up to the timeout if full
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueBcastPut(const OS_object_token_t *token, OS_impl_queue_ring_t *ring, const void *data,
+                                    size_t size, int32 timeout)
+{
+    int32 return_code;
+
+    pthread_mutex_lock(&ring->lock);
+    return_code =
+        OS_Posix_QueueLockedWait(token, ring, &ring->not_full, OS_Posix_QueueBcastHasSpace, NULL, NULL, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        OS_Posix_QueueBcastWrite(ring, data, size);
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    /* Every subscriber now has a message to receive */
+    if (return_code == OS_SUCCESS)
+    {
+        OS_Posix_QueueRingWake(ring, &ring->not_empty, UINT32_MAX);
+    }
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies several messages into a broadcast ring buffer, waking subscribers only once
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueBcastPutMultiple(const OS_object_token_t *token, OS_impl_queue_ring_t *ring,
+                                            const uint8 *data, size_t size, const size_t *sizes, uint32 count,
+                                            uint32 *count_put)
+{
+    int32  return_code;
+    uint32 i;
+
+    return_code = OS_SUCCESS;
+
+    pthread_mutex_lock(&ring->lock);
+    for (i = 0; i < count; ++i)
+    {
+        return_code =
+            OS_Posix_QueueLockedWait(token, ring, &ring->not_full, OS_Posix_QueueBcastHasSpace, NULL, NULL, OS_CHECK);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        OS_Posix_QueueBcastWrite(ring, &data[i * size], sizes[i]);
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    if (i > 0)
+    {
+        OS_Posix_QueueRingWake(ring, &ring->not_empty, UINT32_MAX);
+    }
+
+    *count_put = i;
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies a message out of a broadcast ring buffer for a subscriber, waiting up to the
+ * timeout if it has received every message
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueReaderGet(const OS_object_token_t *token, OS_impl_queue_reader_t *reader, void *data,
+                                     size_t *size_copied, uint32 *priority, int32 timeout)
+{
+    OS_impl_queue_ring_t *ring;
+    int32                 return_code;
+
+    ring         = reader->source;
+    *size_copied = OSAL_SIZE_C(0);
+
+    pthread_mutex_lock(&ring->lock);
+    return_code =
+        OS_Posix_QueueLockedWait(token, ring, &ring->not_empty, OS_Posix_QueueBcastHasMessage, reader, reader, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        *size_copied = OS_Posix_QueueBcastRead(reader, data);
+        *priority    = 0;
+
+        /*
+         * Only a subscriber which does not drop messages can be holding up the producer.
+         * The subscriber holds a reference to the broadcast queue, which is only released
+         * once this task has released its own reference to the subscriber and the
+         * subscriber is deleted, so the ring buffer remains valid throughout.
+         */
+        if (!reader->drop_oldest)
+        {
+            OS_Posix_QueueRingWakeLocked(ring, &ring->not_full, 1);
+        }
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies several messages out of a broadcast ring buffer for a subscriber, waiting up
+ * to the timeout only for the first one
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueReaderGetMultiple(const OS_object_token_t *token, OS_impl_queue_reader_t *reader,
+                                             uint8 *data, size_t size, size_t *sizes, uint32 max_count,
+                                             uint32 *count_copied, int32 timeout)
+{
+    OS_impl_queue_ring_t *ring;
+    int32                 return_code;
+    uint32                i;
+
+    ring = reader->source;
+    i    = 0;
+
+    pthread_mutex_lock(&ring->lock);
+    return_code =
+        OS_Posix_QueueLockedWait(token, ring, &ring->not_empty, OS_Posix_QueueBcastHasMessage, reader, reader, timeout);
+    while (return_code == OS_SUCCESS && i < max_count && OS_Posix_QueueBcastHasMessage(ring, reader))
+    {
+        sizes[i] = OS_Posix_QueueBcastRead(reader, &data[i * size]);
+        ++i;
+    }
+    if (i > 0 && !reader->drop_oldest)
+    {
+        OS_Posix_QueueRingWakeLocked(ring, &ring->not_full, i);
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    *count_copied = i;
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Removes a subscriber from its broadcast ring buffer, and releases it.  The tasks using
+ * the subscriber, including in OS_SelectMultiple(), held references to it, so they are
+ * already done with it.
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueReaderDelete(OS_impl_queue_internal_record_t *impl)
+{
+    OS_impl_queue_reader_t * reader;
+    OS_impl_queue_reader_t **link;
+    OS_impl_queue_ring_t *   ring;
+
+    reader = impl->reader;
+    ring   = reader->source;
+
+    pthread_mutex_lock(&ring->lock);
+    link = &ring->bcast->readers;
+    while (*link != reader)
+    {
+        link = &(*link)->next;
+    }
+    *link = reader->next;
+
+    /*
+     * The producer may have been waiting for this subscriber to catch up.  The broadcast
+     * queue cannot be deleted yet, as the shared layer only releases the reference held
+     * by the subscriber once it has been deleted.
+     */
+    if (!reader->drop_oldest)
+    {
+        OS_Posix_QueueRingWakeLocked(ring, &ring->not_full, UINT32_MAX);
+    }
+    pthread_mutex_unlock(&ring->lock);
+
+    free(reader);
+    impl->reader = NULL;
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies a message into the ring buffer, waiting up to the timeout if full
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingPut(const OS_object_token_t *token, OS_impl_queue_ring_t *ring, const void *data,
+                                   size_t size, uint32 priority, int32 timeout)
+{
+    OS_impl_queue_slot_t *slot;
+    int32                 return_code;
+
+    if (ring->packed != NULL)
+    {
+        return OS_Posix_QueuePackedPut(token, ring, data, size, timeout);
+    }
+    if (ring->bcast != NULL)
+    {
+        return OS_Posix_QueueBcastPut(token, ring, data, size, timeout);
+    }
+
+    return_code = OS_Posix_QueueRingLaneCheck(ring, priority);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code =
+            OS_Posix_QueueRingWait(token, ring, &ring->not_full, OS_Posix_QueueRingClaimPut, priority, &slot, timeout);
+    }
+    if (return_code == OS_SUCCESS)
+    {
+        slot->size = size;
+        memcpy(slot + 1, data, size);
+        OS_Posix_QueueRingPublish(ring, slot);
+        OS_Posix_QueueRingWake(ring, &ring->not_empty, 1);
+    }
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies a message out of the ring buffer, waiting up to the timeout if empty
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingGet(const OS_object_token_t *token, OS_impl_queue_ring_t *ring, void *data,
+                                   size_t *size_copied, uint32 *priority, int32 timeout)
+{
+    OS_impl_queue_slot_t *slot;
+    int32                 return_code;
+
+    if (ring->packed != NULL)
+    {
+        return OS_Posix_QueuePackedGet(token, ring, data, size_copied, priority, timeout);
+    }
+    if (ring->bcast != NULL)
+    {
+        /* Messages are only received through the subscribers */
+        *size_copied = OSAL_SIZE_C(0);
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    *size_copied = OSAL_SIZE_C(0);
+
+    return_code = OS_Posix_QueueRingWait(token, ring, &ring->not_empty, OS_Posix_QueueRingClaimGet, 0, &slot, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        /* The shared layer ensures the buffer is at least as large as any message */
+        *size_copied = slot->size;
+        *priority    = OS_Posix_QueueRingSlotPriority(ring, slot);
+        memcpy(data, slot + 1, slot->size);
+        OS_Posix_QueueRingFree(ring, slot);
+        OS_Posix_QueueRingWake(ring, &ring->not_full, 1);
+    }
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies several messages into the ring buffer, waking consumers only once
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingPutMultiple(const OS_object_token_t *token, OS_impl_queue_ring_t *ring,
+                                           const uint8 *data, size_t size, const size_t *sizes, uint32 count,
+                                           uint32 priority, uint32 *count_put)
+{
+    OS_impl_queue_slot_t *slot;
+    int32                 return_code;
+    uint32                i;
+
+    if (ring->packed != NULL)
+    {
+        return OS_Posix_QueuePackedPutMultiple(token, ring, data, size, sizes, count, count_put);
+    }
+    if (ring->bcast != NULL)
+    {
+        return OS_Posix_QueueBcastPutMultiple(token, ring, data, size, sizes, count, count_put);
+    }
+
+    i = 0;
+
+    return_code = OS_Posix_QueueRingLaneCheck(ring, priority);
+    while (return_code == OS_SUCCESS && i < count)
+    {
+        return_code = OS_Posix_QueueRingClaimPut(ring, priority, &slot);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        slot->size = sizes[i];
+        memcpy(slot + 1, &data[i * size], sizes[i]);
+        OS_Posix_QueueRingPublish(ring, slot);
+        ++i;
+    }
+
+    if (i > 0)
+    {
+        OS_Posix_QueueRingWake(ring, &ring->not_empty, i);
+    }
+
+    *count_put = i;
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Copies several messages out of the ring buffer, waiting up to the timeout
+ * only for the first one
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingGetMultiple(const OS_object_token_t *token, OS_impl_queue_ring_t *ring, uint8 *data,
+                                           size_t size, size_t *sizes, uint32 max_count, uint32 *count_copied,
+                                           int32 timeout)
+{
+    OS_impl_queue_slot_t *slot;
+    int32                 return_code;
+    uint32                i;
+
+    if (ring->packed != NULL)
+    {
+        return OS_Posix_QueuePackedGetMultiple(token, ring, data, size, sizes, max_count, count_copied, timeout);
+    }
+    if (ring->bcast != NULL)
+    {
+        /* Messages are only received through the subscribers */
+        *count_copied = 0;
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    i = 0;
+
+    return_code = OS_Posix_QueueRingWait(token, ring, &ring->not_empty, OS_Posix_QueueRingClaimGet, 0, &slot, timeout);
+    while (return_code == OS_SUCCESS)
+    {
+        /* The shared layer ensures each buffer is at least as large as any message */
+        sizes[i] = slot->size;
+        memcpy(&data[i * size], slot + 1, slot->size);
+        OS_Posix_QueueRingFree(ring, slot);
+
+        ++i;
+        if (i >= max_count)
+        {
+            break;
+        }
+
+        return_code = OS_Posix_QueueRingClaimGet(ring, 0, &slot);
+    }
+
+    *count_copied = i;
+
+    /* Running out of messages after the first one is not an error */
+    if (i > 0)
+    {
+        OS_Posix_QueueRingWake(ring, &ring->not_full, i);
+        return_code = OS_SUCCESS;
+    }
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Checks whether a message could currently be received from the ring buffer, by the
+ * given subscriber in the case of a broadcast queue
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_QueueRingCanGet(OS_impl_queue_ring_t *ring, OS_impl_queue_reader_t *reader)
+{
+    OS_impl_queue_lane_t *lane;
+    uint32                lanes_used;
+    uint32                priority;
+    uint32                pos;
+    bool                  result;
+
+    if (ring->packed != NULL || ring->bcast != NULL)
+    {
+        pthread_mutex_lock(&ring->lock);
+        if (ring->packed != NULL)
+        {
+            result = OS_Posix_QueuePackedHasMessage(ring, NULL);
+        }
+        else
+        {
+            /* Messages are only received through the subscribers */
+            result = (reader != NULL && OS_Posix_QueueBcastHasMessage(ring, reader));
+        }
+        pthread_mutex_unlock(&ring->lock);
+        return result;
+    }
+
+    lanes_used = __atomic_load_n(&ring->lanes_used, __ATOMIC_ACQUIRE);
+    for (priority = 0; priority < OS_QUEUE_PRIORITY_LEVELS; ++priority)
+    {
+        if ((lanes_used & (1U << priority)) != 0)
+        {
+            lane = ring->lanes[priority];
+            pos  = __atomic_load_n(&lane->dequeue_pos, __ATOMIC_RELAXED);
+            if (__atomic_load_n(&OS_Posix_QueueRingSlot(ring, lane, pos)->seq, __ATOMIC_ACQUIRE) == pos + 1)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Checks whether a message could currently be put on the ring buffer, which is never
+ * the case through a subscriber to a broadcast queue
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_QueueRingCanPut(OS_impl_queue_ring_t *ring, OS_impl_queue_reader_t *reader)
+{
+    OS_impl_queue_lane_t *lane;
+    uint32                pos;
+    bool                  result;
+
+    if (reader != NULL)
+    {
+        return false;
+    }
+
+    if (ring->packed != NULL || ring->bcast != NULL)
+    {
+        pthread_mutex_lock(&ring->lock);
+        if (ring->packed != NULL)
+        {
+            /* Writable only if a message of the maximum size would fit */
+            result = OS_Posix_QueuePackedHasSpace(ring, &ring->stride);
+        }
+        else
+        {
+            result = OS_Posix_QueueBcastHasSpace(ring, NULL);
+        }
+        pthread_mutex_unlock(&ring->lock);
+        return result;
+    }
+
+    if (!ring->spsc)
+    {
+        return __atomic_load_n(&ring->count, __ATOMIC_RELAXED) < ring->depth;
+    }
+
+    lane = ring->lanes[0];
+    pos  = __atomic_load_n(&lane->enqueue_pos, __ATOMIC_RELAXED);
+
+    return (pos - __atomic_load_n(&lane->dequeue_pos, __ATOMIC_RELAXED)) < ring->depth &&
+           __atomic_load_n(&OS_Posix_QueueRingSlot(ring, lane, pos)->seq, __ATOMIC_ACQUIRE) == pos;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Clears the bits in SelectFlags for states which the ring buffer, or the given
+ * subscriber to it, is not currently in
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingSelectState(OS_impl_queue_ring_t *ring, OS_impl_queue_reader_t *reader,
+                                          uint32 *SelectFlags)
+{
+    if ((*SelectFlags & OS_STREAM_STATE_READABLE) != 0 && !OS_Posix_QueueRingCanGet(ring, reader))
+    {
+        *SelectFlags &= ~OS_STREAM_STATE_READABLE;
+    }
+    if ((*SelectFlags & OS_STREAM_STATE_WRITABLE) != 0 && !OS_Posix_QueueRingCanPut(ring, reader))
+    {
+        *SelectFlags &= ~OS_STREAM_STATE_WRITABLE;
+    }
+}
+
+/*---------------------------------------------------------------------------------------
+ * Unregisters a task from a ring buffer it was waiting on in OS_SelectMultiple()
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingSelectUnlink(OS_impl_queue_selector_t *selector)
+{
+    OS_impl_queue_ring_t *     ring;
+    OS_impl_queue_selector_t **link;
+
+    ring = selector->ring;
+
+    for (link = &ring->selectors; *link != selector; link = &(*link)->next)
+    {
+        /* find the link to the entry of the task */
+    }
+    *link = selector->next;
+
+    if ((selector->flags & OS_STREAM_STATE_READABLE) != 0)
+    {
+        --ring->not_empty.selectors;
+        __atomic_sub_fetch(&ring->not_empty.waiters, 1, __ATOMIC_SEQ_CST);
+    }
+    if ((selector->flags & OS_STREAM_STATE_WRITABLE) != 0)
+    {
+        --ring->not_full.selectors;
+        __atomic_sub_fetch(&ring->not_full.waiters, 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+/*---------------------------------------------------------------------------------------
+ * Releases the select state of a task when it exits.  A task which was canceled while
+ * waiting in OS_SelectMultiple() is still registered on the ring buffers and holds the
+ * references to their queues, which are released here.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueSelectTaskDestroy(void *arg)
+{
+    OS_impl_queue_select_task_t *task = arg;
+    OS_impl_queue_selector_t *   selector;
+
+    while (task->selectors != NULL)
+    {
+        selector        = task->selectors;
+        task->selectors = selector->task_next;
+
+        pthread_mutex_lock(&selector->ring->lock);
+        OS_Posix_QueueRingSelectUnlink(selector);
+        pthread_mutex_unlock(&selector->ring->lock);
+
+        OS_ObjectIdRelease(&selector->token);
+        free(selector);
+    }
+
+    close(task->pipe[0]);
+    close(task->pipe[1]);
+    free(task);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Gets the select state of the calling task, creating it on first use
+ ----------------------------------------------------------------------------------------*/
+static OS_impl_queue_select_task_t *OS_Posix_QueueSelectTask(void)
+{
+    OS_impl_queue_select_task_t *task;
+    int                          i;
+
+    task = pthread_getspecific(POSIX_GlobalVars.QueueSelectKey);
+    if (task != NULL)
+    {
+        return task;
+    }
+
+    task = malloc(sizeof(*task));
+    if (task == NULL)
+    {
+        OS_DEBUG("Error: unable to allocate select state\n");
+        return NULL;
+    }
+
+    if (pipe(task->pipe) < 0)
+    {
+        OS_DEBUG("Error: pipe failed: %s\n", strerror(errno));
+        free(task);
+        return NULL;
+    }
+
+    /* Wakeups are never waited for, and are discarded once the state of the queues is checked */
+    for (i = 0; i < 2; ++i)
+    {
+        fcntl(task->pipe[i], F_SETFL, fcntl(task->pipe[i], F_GETFL) | O_NONBLOCK);
+        fcntl(task->pipe[i], F_SETFD, FD_CLOEXEC);
+    }
+    task->selectors = NULL;
+
+    if (pthread_setspecific(POSIX_GlobalVars.QueueSelectKey, task) != 0)
+    {
+        OS_DEBUG("Error: unable to save select state\n");
+        close(task->pipe[0]);
+        close(task->pipe[1]);
+        free(task);
+        return NULL;
+    }
+
+    return task;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Registers a task in OS_SelectMultiple() as waiting on the ring buffer, or on the given
+ * subscriber to it.  Producers and consumers then write to the pipe of the task when
+ * they wake waiting tasks.  The task keeps a copy of its token, so that the reference
+ * to the queue is still released if it is canceled while waiting.
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingSelectBegin(const OS_object_token_t *token, OS_impl_queue_ring_t *ring,
+                                           OS_impl_queue_reader_t *reader, uint32 *SelectFlags, int *os_fd,
+                                           uint32 *fd_flags)
+{
+    OS_impl_queue_select_task_t *task;
+    OS_impl_queue_selector_t *   selector;
+
+    task = OS_Posix_QueueSelectTask();
+    if (task == NULL)
+    {
+        return OS_ERROR;
+    }
+
+    selector = malloc(sizeof(*selector));
+    if (selector == NULL)
+    {
+        OS_DEBUG("Error: unable to allocate select entry\n");
+        return OS_ERROR;
+    }
+
+    selector->ring    = ring;
+    selector->reader  = reader;
+    selector->token   = *token;
+    selector->flags   = *SelectFlags;
+    selector->wake_fd = task->pipe[1];
+
+    pthread_mutex_lock(&ring->lock);
+
+    if (OS_Posix_QueueRingDeleted(ring, reader))
+    {
+        pthread_mutex_unlock(&ring->lock);
+        free(selector);
+        return OS_ERR_INVALID_ID;
+    }
+
+    if ((*SelectFlags & OS_STREAM_STATE_READABLE) != 0)
+    {
+        ++ring->not_empty.selectors;
+        __atomic_add_fetch(&ring->not_empty.waiters, 1, __ATOMIC_SEQ_CST);
+    }
+    if ((*SelectFlags & OS_STREAM_STATE_WRITABLE) != 0)
+    {
+        ++ring->not_full.selectors;
+        __atomic_add_fetch(&ring->not_full.waiters, 1, __ATOMIC_SEQ_CST);
+    }
+    selector->next  = ring->selectors;
+    ring->selectors = selector;
+
+    pthread_mutex_unlock(&ring->lock);
+
+    selector->task_next = task->selectors;
+    task->selectors     = selector;
+
+    *os_fd    = task->pipe[0];
+    *fd_flags = OS_STREAM_STATE_READABLE;
+
+    /*
+     * Pairs with the fence in OS_Posix_QueueRingWake(): either the state is
+     * seen here, or the waker sees this task and writes to its pipe.
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    OS_Posix_QueueRingSelectState(ring, reader, SelectFlags);
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Unregisters a task in OS_SelectMultiple() which was waiting on the ring buffer, or on
+ * the given subscriber to it.  A queue which is being deleted is reported in every state
+ * waited for, so that the task notices as soon as it next uses the queue.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingSelectEnd(OS_impl_queue_ring_t *ring, OS_impl_queue_reader_t *reader, uint32 *SelectFlags)
+{
+    OS_impl_queue_select_task_t *task;
+    OS_impl_queue_selector_t *   selector;
+    OS_impl_queue_selector_t **  link;
+    uint8                        discard[16];
+    int                          cancel_state;
+
+    task = pthread_getspecific(POSIX_GlobalVars.QueueSelectKey);
+
+    for (link = &task->selectors; (*link)->ring != ring || (*link)->reader != reader; link = &(*link)->task_next)
+    {
+        /* find the entry of the ring buffer, which was registered by OS_Posix_QueueRingSelectBegin() */
+    }
+    selector = *link;
+    *link    = selector->task_next;
+
+    OS_Posix_QueueRingSelectState(ring, reader, SelectFlags);
+
+    pthread_mutex_lock(&ring->lock);
+
+    if (OS_Posix_QueueRingDeleted(ring, reader))
+    {
+        *SelectFlags = selector->flags;
+    }
+    OS_Posix_QueueRingSelectUnlink(selector);
+
+    pthread_mutex_unlock(&ring->lock);
+
+    free(selector);
+
+    /*
+     * The state of the ring is checked directly, so any pending wakeups are not needed.
+     * Only the pipe of this task is drained, so no other task can miss its wakeup.
+     */
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancel_state);
+    while (read(task->pipe[0], discard, sizeof(discard)) > 0)
+    {
+        /* keep reading until the pipe is empty */
+    }
+    pthread_setcancelstate(cancel_state, NULL);
+}
 
 /****************************************************************************************
                                 MESSAGE QUEUE API
@@ -49,7 +2040,22 @@ OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
  ----------------------------------------------------------------------------------------*/
 int32 OS_Posix_QueueAPI_Impl_Init(void)
 {
-    memset(OS_impl_queue_table, 0, sizeof(OS_impl_queue_table));
+    int   ret;
+    int32 return_code;
+
+    return_code = OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_QUEUE, OS_impl_queue_table);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    /* The select state of a task is released when it exits, even if it was canceled */
+    ret = pthread_key_create(&POSIX_GlobalVars.QueueSelectKey, OS_Posix_QueueSelectTaskDestroy);
+    if (ret != 0)
+    {
+        OS_DEBUG("Error creating queue select key: %s (%d)\n", strerror(ret), ret);
+        return OS_ERROR;
+    }
 
     /*
      * Automatic truncation is dependent on the OSAL_CONFIG_DEBUG_PERMISSIVE_MODE compile-time define - so
@@ -89,6 +2095,24 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
     impl  = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
     queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
 
+    impl->ring   = NULL;
+    impl->reader = NULL;
+
+#ifdef OSAL_CONFIG_QUEUE_RINGBUFFER
+    flags |= OS_QUEUE_FLAG_LOCAL;
+#endif
+
+    /*
+     * Queues are never shared with other processes, so they can be held in
+     * process memory.  This is not subject to the system message queue limits,
+     * so the depth is never truncated.  Packed and broadcast queues are always
+     * held this way.
+     */
+    if ((flags & (OS_QUEUE_FLAG_LOCAL | OS_QUEUE_FLAG_SPSC | OS_QUEUE_FLAG_BROADCAST)) != 0 || queue->max_bytes != 0)
+    {
+        return OS_Posix_QueueRingCreate(impl, queue, flags);
+    }
+
     /* set queue attributes */
     memset(&queueAttr, 0, sizeof(queueAttr));
     queueAttr.mq_maxmsg  = queue->max_depth;
@@ -152,6 +2176,66 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueSubscribe_Impl(const OS_object_token_t *token, const OS_object_token_t *source_token, uint32 flags)
+{
+    OS_impl_queue_internal_record_t *impl;
+    OS_impl_queue_internal_record_t *source;
+    OS_impl_queue_reader_t *         reader;
+    OS_impl_queue_ring_t *           ring;
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    source = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *source_token);
+
+    impl->ring   = NULL;
+    impl->reader = NULL;
+
+    ring = source->ring;
+    if (ring == NULL || ring->bcast == NULL)
+    {
+        return OS_ERR_INCORRECT_OBJ_TYPE;
+    }
+
+    reader = malloc(sizeof(*reader));
+    if (reader == NULL)
+    {
+        OS_DEBUG("OS_QueueSubscribe Error. Unable to allocate subscriber\n");
+        return OS_ERROR;
+    }
+
+    memset(reader, 0, sizeof(*reader));
+    reader->source      = ring;
+    reader->drop_oldest = ((flags & OS_QUEUE_FLAG_DROP_OLDEST) != 0);
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    reader->queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
+#endif
+
+    /* Only messages put from now on are received */
+    pthread_mutex_lock(&ring->lock);
+    if (ring->deleting != 0)
+    {
+        pthread_mutex_unlock(&ring->lock);
+        free(reader);
+        OS_DEBUG("OS_QueueSubscribe Error. Broadcast queue is being deleted\n");
+        return OS_ERR_INVALID_ID;
+    }
+    reader->read_pos     = ring->bcast->write_pos;
+    reader->next         = ring->bcast->readers;
+    ring->bcast->readers = reader;
+    pthread_mutex_unlock(&ring->lock);
+
+    impl->reader = reader;
+
+    OS_OBJECT_TABLE_GET(OS_queue_table, *token)->referenced = true;
+
+    return OS_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -165,6 +2249,16 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+    if (impl->reader != NULL)
+    {
+        return OS_Posix_QueueReaderDelete(impl);
+    }
+
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingDelete(impl);
+    }
+
     /* Try to delete and unlink the queue */
     if (mq_close(impl->id) != 0)
     {
@@ -173,10 +2267,35 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
     }
     else
     {
-        return_code = OS_SUCCESS;
+        return_code = OS_SUCCESS;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueDeletePending_Impl(const OS_object_token_t *token, bool pending)
+{
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->reader != NULL)
+    {
+        return OS_Posix_QueueRingDeletePending(impl->reader->source, impl->reader, pending);
+    }
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingDeletePending(impl->ring, NULL, pending);
     }
 
-    return return_code;
+    /* Tasks waiting on a system message queue do not hold references to it */
+    return OS_SUCCESS;
 }
 
 /*----------------------------------------------------------------
@@ -186,14 +2305,39 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
  *
  *-----------------------------------------------------------------*/
 int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied, int32 timeout)
+{
+    uint32 priority;
+
+    return OS_QueueGetWithPriority_Impl(token, data, size, size_copied, &priority, timeout);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetWithPriority_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied,
+                                   uint32 *priority, int32 timeout)
 {
     int32                            return_code;
     ssize_t                          sizeCopied;
+    unsigned int                     msg_prio;
     struct timespec                  ts;
     OS_impl_queue_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+    if (impl->reader != NULL)
+    {
+        return OS_Posix_QueueReaderGet(token, impl->reader, data, size_copied, priority, timeout);
+    }
+
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingGet(token, impl->ring, data, size_copied, priority, timeout);
+    }
+
     /*
      ** Read the message queue for data
      */
@@ -206,7 +2350,7 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
          */
         do
         {
-            sizeCopied = mq_receive(impl->id, data, size, NULL);
+            sizeCopied = mq_receive(impl->id, data, size, &msg_prio);
         } while (sizeCopied < 0 && errno == EINTR);
     }
     else
@@ -235,7 +2379,7 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
          */
         do
         {
-            sizeCopied = mq_timedreceive(impl->id, data, size, NULL, &ts);
+            sizeCopied = mq_timedreceive(impl->id, data, size, &msg_prio, &ts);
         } while (timeout != OS_CHECK && sizeCopied < 0 && errno == EINTR);
 
     } /* END timeout */
@@ -270,6 +2414,7 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     else
     {
         *size_copied = OSAL_SIZE_C(sizeCopied);
+        *priority    = msg_prio;
         return_code  = OS_SUCCESS;
     }
 
@@ -283,6 +2428,18 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
  *
  *-----------------------------------------------------------------*/
 int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags)
+{
+    return OS_QueuePutTimed_Impl(token, data, size, flags, OS_CHECK);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutTimed_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags,
+                            int32 timeout)
 {
     int32                            return_code;
     int                              result;
@@ -291,33 +2448,361 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
-    /*
-     * NOTE - using a zero timeout here for the same reason that QueueGet does ---
-     * checking the attributes and doing the actual send is non-atomic, and if
-     * two threads call QueuePut() at the same time on a nearly-full queue,
-     * one could block.
-     */
-    memset(&ts, 0, sizeof(ts));
+    /* Messages are only put on the broadcast queue itself */
+    if (impl->reader != NULL)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
 
-    /* send message */
-    do
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingPut(token, impl->ring, data, size, OS_Posix_QueueRingPriority(impl->ring, flags),
+                                     timeout);
+    }
+
+    if (timeout == OS_PEND)
+    {
+        /*
+         ** A signal can interrupt the mq_send call, so the call has to be done with
+         ** a loop
+         */
+        do
+        {
+            result = mq_send(impl->id, data, size, OS_QUEUE_FLAGS_PRIORITY(flags));
+        } while (result == -1 && errno == EINTR);
+    }
+    else
     {
-        result = mq_timedsend(impl->id, data, size, 1, &ts);
-    } while (result == -1 && errno == EINTR);
+        /*
+         * NOTE - using a zero timeout for OS_CHECK for the same reason that QueueGet does ---
+         * checking the attributes and doing the actual send is non-atomic, and if
+         * two threads call QueuePut() at the same time on a nearly-full queue,
+         * one could block.
+         */
+        if (timeout == OS_CHECK)
+        {
+            memset(&ts, 0, sizeof(ts));
+        }
+        else
+        {
+            OS_Posix_CompAbsDelayTime(timeout, &ts);
+        }
+
+        /* send message */
+        do
+        {
+            result = mq_timedsend(impl->id, data, size, OS_QUEUE_FLAGS_PRIORITY(flags), &ts);
+        } while (result == -1 && errno == EINTR);
+    }
 
     if (result == 0)
     {
         return_code = OS_SUCCESS;
     }
-    else if (errno == ETIMEDOUT)
+    else if (timeout == OS_PEND || errno != ETIMEDOUT)
+    {
+        /* Something else went wrong */
+        return_code = OS_ERROR;
+    }
+    else if (timeout == OS_CHECK)
     {
         return_code = OS_QUEUE_FULL;
     }
     else
     {
-        /* Something else went wrong */
-        return_code = OS_ERROR;
+        return_code = OS_QUEUE_TIMEOUT;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data_ptr)
+{
+    int32                            return_code;
+    OS_impl_queue_slot_t *           slot;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    /* Only a queue held in lanes in process memory has slots that can be handed out */
+    if (impl->ring == NULL || impl->ring->lanes[0] == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    /* Messages built in place are always of the default priority */
+    return_code = OS_Posix_QueueRingClaimPut(impl->ring, 0, &slot);
+    if (return_code == OS_SUCCESS)
+    {
+        __atomic_add_fetch(&impl->ring->handed_out, 1, __ATOMIC_RELEASE);
+        *data_ptr = slot + 1;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data_ptr, size_t size, uint32 flags)
+{
+    OS_impl_queue_slot_t *           slot;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    slot = OS_Posix_QueueRingSlotFromData(impl->ring, data_ptr, true);
+    if (slot == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    slot->size = size;
+    OS_Posix_QueueRingPublish(impl->ring, slot);
+    __atomic_sub_fetch(&impl->ring->handed_out, 1, __ATOMIC_RELEASE);
+    OS_Posix_QueueRingWake(impl->ring, &impl->ring->not_empty, 1);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetRef_Impl(const OS_object_token_t *token, const void **data_ptr, size_t *size_copied, int32 timeout)
+{
+    int32                            return_code;
+    OS_impl_queue_slot_t *           slot;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->ring == NULL || impl->ring->lanes[0] == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    return_code = OS_Posix_QueueRingWait(token, impl->ring, &impl->ring->not_empty, OS_Posix_QueueRingClaimGet, 0,
+                                         &slot, timeout);
+    if (return_code == OS_SUCCESS)
+    {
+        __atomic_add_fetch(&impl->ring->handed_out, 1, __ATOMIC_RELEASE);
+        *data_ptr    = slot + 1;
+        *size_copied = slot->size;
     }
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *data_ptr)
+{
+    OS_impl_queue_slot_t *           slot;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->ring == NULL)
+    {
+        return OS_ERR_NOT_IMPLEMENTED;
+    }
+
+    slot = OS_Posix_QueueRingSlotFromData(impl->ring, data_ptr, false);
+    if (slot == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    OS_Posix_QueueRingFree(impl->ring, slot);
+    __atomic_sub_fetch(&impl->ring->handed_out, 1, __ATOMIC_RELEASE);
+    OS_Posix_QueueRingWake(impl->ring, &impl->ring->not_full, 1);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutMultiple_Impl(const OS_object_token_t *token, const void *data, size_t size, const size_t *sizes,
+                               uint32 count, uint32 flags, uint32 *count_put)
+{
+    int32                            return_code;
+    uint32                           i;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->reader != NULL)
+    {
+        *count_put = 0;
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingPutMultiple(token, impl->ring, data, size, sizes, count,
+                                             OS_Posix_QueueRingPriority(impl->ring, flags), count_put);
+    }
+
+    /* A system message queue can only accept one message per call */
+    return_code = OS_SUCCESS;
+    for (i = 0; i < count; ++i)
+    {
+        return_code = OS_QueuePut_Impl(token, (const uint8 *)data + (i * size), sizes[i], flags);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    *count_put = i;
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMultiple_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *sizes,
+                               uint32 max_count, uint32 *count_copied, int32 timeout)
+{
+    int32                            return_code;
+    uint32                           i;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->reader != NULL)
+    {
+        return OS_Posix_QueueReaderGetMultiple(token, impl->reader, data, size, sizes, max_count, count_copied,
+                                               timeout);
+    }
+
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingGetMultiple(token, impl->ring, data, size, sizes, max_count, count_copied, timeout);
+    }
+
+    /* A system message queue can only deliver one message per call, only the first may wait */
+    i           = 0;
+    return_code = OS_QueueGet_Impl(token, data, size, &sizes[0], timeout);
+    while (return_code == OS_SUCCESS)
+    {
+        ++i;
+        if (i >= max_count)
+        {
+            break;
+        }
+
+        return_code = OS_QueueGet_Impl(token, (uint8 *)data + (i * size), size, &sizes[i], OS_CHECK);
+    }
+
+    *count_copied = i;
+
+    /* Running out of messages after the first one is not an error */
+    if (i > 0)
+    {
+        return_code = OS_SUCCESS;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueSelectBegin_Impl(const OS_object_token_t *token, uint32 *SelectFlags, int *os_fd, uint32 *fd_flags)
+{
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->reader != NULL)
+    {
+        return OS_Posix_QueueRingSelectBegin(token, impl->reader->source, impl->reader, SelectFlags, os_fd,
+                                             fd_flags);
+    }
+
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingSelectBegin(token, impl->ring, NULL, SelectFlags, os_fd, fd_flags);
+    }
+
+    /* A system message queue descriptor becomes readable or writable just like a file */
+    *os_fd       = (int)impl->id;
+    *fd_flags    = *SelectFlags;
+    *SelectFlags = 0;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_QueueSelectEnd_Impl(const OS_object_token_t *token, uint32 *SelectFlags)
+{
+    struct mq_attr                   queueAttr;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (impl->reader != NULL)
+    {
+        OS_Posix_QueueRingSelectEnd(impl->reader->source, impl->reader, SelectFlags);
+        return;
+    }
+
+    if (impl->ring != NULL)
+    {
+        OS_Posix_QueueRingSelectEnd(impl->ring, NULL, SelectFlags);
+        return;
+    }
+
+    if (mq_getattr(impl->id, &queueAttr) != 0)
+    {
+        *SelectFlags = 0;
+        return;
+    }
+
+    if (queueAttr.mq_curmsgs <= 0)
+    {
+        *SelectFlags &= ~OS_STREAM_STATE_READABLE;
+    }
+    if (queueAttr.mq_curmsgs >= queueAttr.mq_maxmsg)
+    {
+        *SelectFlags &= ~OS_STREAM_STATE_WRITABLE;
+    }
+}
@@ -33,7 +33,7 @@
 #include "os-impl-rwlock.h"
 
 /* Tables where the OS object information is stored */
-OS_impl_rwlock_internal_record_t OS_impl_rwlock_table[OS_MAX_RWLOCKS];
+OS_impl_rwlock_internal_record_t *OS_impl_rwlock_table;
 
 /****************************************************************************************
                                   RWLOCK API
@@ -46,8 +46,7 @@ OS_impl_rwlock_internal_record_t OS_impl_rwlock_table[OS_MAX_RWLOCKS];
  *-----------------------------------------------------------------*/
 int32 OS_Posix_RwLockAPI_Impl_Init(void)
 {
-    memset(OS_impl_rwlock_table, 0, sizeof(OS_impl_rwlock_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_RWLOCK, OS_impl_rwlock_table);
 }
 
 /*----------------------------------------------------------------
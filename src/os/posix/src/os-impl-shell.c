@@ -83,7 +83,7 @@ int32 OS_ShellOutputToFile_Impl(const OS_object_token_t *token, const char *Cmd)
         dup2(impl->fd, STDERR_FILENO);
 
         /* close all _other_ filehandles */
-        for (local_id = 0; local_id < OS_MAX_NUM_OPEN_FILES; ++local_id)
+        for (local_id = 0; local_id < OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_STREAM); ++local_id)
         {
             if (OS_ObjectIdIsValid(OS_global_stream_table[local_id].active_id))
             {
@@ -60,7 +60,7 @@
 #endif
 
 /* Tables where the OS object information is stored */
-OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
+OS_impl_task_internal_record_t *OS_impl_task_table;
 
 /*
  * Local Function Prototypes
@@ -75,7 +75,7 @@ OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
  * to be within the range of [0,OS_MAX_TASK_PRIORITY]
  *
 ----------------------------------------------------------------------------*/
-static int OS_PriorityRemap(osal_priority_t InputPri)
+int OS_PriorityRemap(osal_priority_t InputPri)
 {
     int OutputPri;
 
@@ -227,9 +227,14 @@ int32 OS_Posix_TaskAPI_Impl_Init(void)
     bool                   sched_fifo_valid;
     POSIX_PriorityLimits_t sched_rr_limits;
     bool                   sched_rr_valid;
+    int32                  return_code;
 
     /* Initialize Local Tables */
-    memset(OS_impl_task_table, 0, sizeof(OS_impl_task_table));
+    return_code = OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TASK, OS_impl_task_table);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
 
     /* Clear the "limits" structs otherwise the compiler may warn
      * about possibly being used uninitialized (false warning)
@@ -70,7 +70,7 @@ static void OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec);
                                      GLOBALS
  ***************************************************************************************/
 
-OS_impl_timebase_internal_record_t OS_impl_timebase_table[OS_MAX_TIMEBASES];
+OS_impl_timebase_internal_record_t *OS_impl_timebase_table;
 
 /****************************************************************************************
                                 INTERNAL FUNCTIONS
@@ -206,7 +206,11 @@ int32 OS_Posix_TimeBaseAPI_Impl_Init(void)
         /*
         ** Mark all timers as available
         */
-        memset(OS_impl_timebase_table, 0, sizeof(OS_impl_timebase_table));
+        return_code = OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TIMEBASE, OS_impl_timebase_table);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
 
         /*
         ** get the resolution of the selected clock
@@ -257,7 +261,7 @@ int32 OS_Posix_TimeBaseAPI_Impl_Init(void)
             break;
         }
 
-        for (idx = 0; idx < OS_MAX_TIMEBASES; ++idx)
+        for (idx = 0; idx < OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_TIMEBASE); ++idx)
         {
             /*
             ** create the timebase sync mutex
@@ -374,7 +378,7 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
          * This is all done while the global lock is held so no chance of the
          * underlying tables changing
          */
-        for (idx = 0; idx < OS_MAX_TIMEBASES; ++idx)
+        for (idx = 0; idx < OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_TIMEBASE); ++idx)
         {
             if (OS_ObjectIdIsValid(OS_global_timebase_table[idx].active_id) &&
                 OS_impl_timebase_table[idx].assigned_signal != 0)
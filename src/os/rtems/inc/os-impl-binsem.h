@@ -35,6 +35,6 @@ typedef struct
 } OS_impl_binsem_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+extern OS_impl_binsem_internal_record_t *OS_impl_bin_sem_table;
 
 #endif /* OS_IMPL_BINSEM_H */
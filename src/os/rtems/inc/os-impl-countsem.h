@@ -35,6 +35,6 @@ typedef struct
 } OS_impl_countsem_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_countsem_internal_record_t OS_impl_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
+extern OS_impl_countsem_internal_record_t *OS_impl_count_sem_table;
 
 #endif /* OS_IMPL_COUNTSEM_H */
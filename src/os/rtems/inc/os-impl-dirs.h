@@ -41,6 +41,6 @@ typedef struct
 /*
  * The directory handle table.
  */
-extern OS_impl_dir_internal_record_t OS_impl_dir_table[OS_MAX_NUM_OPEN_DIRS];
+extern OS_impl_dir_internal_record_t *OS_impl_dir_table;
 
 #endif /* OS_IMPL_DIRS_H */
@@ -46,6 +46,6 @@ typedef struct
     void *dl_handle;
 } OS_impl_module_internal_record_t;
 
-extern OS_impl_module_internal_record_t OS_impl_module_table[OS_MAX_MODULES];
+extern OS_impl_module_internal_record_t *OS_impl_module_table;
 
 #endif /* OS_IMPL_LOADER_H */
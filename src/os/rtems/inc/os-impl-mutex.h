@@ -35,6 +35,6 @@ typedef struct
 } OS_impl_mutex_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
+extern OS_impl_mutex_internal_record_t *OS_impl_mutex_table;
 
 #endif /* OS_IMPL_MUTEX_H */
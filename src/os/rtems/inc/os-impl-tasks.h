@@ -35,6 +35,6 @@ typedef struct
 } OS_impl_task_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
+extern OS_impl_task_internal_record_t *OS_impl_task_table;
 
 #endif /* OS_IMPL_TASKS_H */
@@ -102,6 +102,7 @@ int32 OS_Rtems_ModuleAPI_Impl_Init(void);
 int32 OS_Rtems_StreamAPI_Impl_Init(void);
 int32 OS_Rtems_DirAPI_Impl_Init(void);
 int32 OS_Rtems_FileSysAPI_Impl_Init(void);
+int32 OS_Rtems_ConsoleAPI_Impl_Init(void);
 
 int32 OS_Rtems_TableMutex_Init(osal_objtype_t idtype);
 
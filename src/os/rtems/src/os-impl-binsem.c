@@ -58,7 +58,7 @@
 /*  tables for the properties of objects */
 
 /* Tables where the OS object information is stored */
-OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+OS_impl_binsem_internal_record_t *OS_impl_bin_sem_table;
 
 /****************************************************************************************
                                   SEMAPHORE API
@@ -71,8 +71,7 @@ OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
  *-----------------------------------------------------------------*/
 int32 OS_Rtems_BinSemAPI_Impl_Init(void)
 {
-    memset(OS_impl_bin_sem_table, 0, sizeof(OS_impl_bin_sem_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_BINSEM, OS_impl_bin_sem_table);
 }
 
 /*----------------------------------------------------------------
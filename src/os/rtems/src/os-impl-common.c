@@ -93,6 +93,9 @@ int32 OS_API_Impl_Init(osal_objtype_t idtype)
         case OS_OBJECT_TYPE_OS_FILESYS:
             return_code = OS_Rtems_FileSysAPI_Impl_Init();
             break;
+        case OS_OBJECT_TYPE_OS_CONSOLE:
+            return_code = OS_Rtems_ConsoleAPI_Impl_Init();
+            break;
         default:
             break;
     }
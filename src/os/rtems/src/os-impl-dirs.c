@@ -29,6 +29,7 @@
 
 #include "os-rtems.h"
 #include "os-shared-dir.h"
+#include "os-shared-idmap.h"
 
 #include <fcntl.h>
 #include <dirent.h>
@@ -45,7 +46,7 @@
 /*
  * The directory handle table.
  */
-DIR *OS_impl_dir_table[OS_MAX_NUM_OPEN_DIRS];
+OS_impl_dir_internal_record_t *OS_impl_dir_table;
 
 /****************************************************************************************
                          IMPLEMENTATION-SPECIFIC ROUTINES
@@ -61,6 +62,5 @@ DIR *OS_impl_dir_table[OS_MAX_NUM_OPEN_DIRS];
  ---------------------------------------------------------------------------------------*/
 int32 OS_Rtems_DirAPI_Impl_Init(void)
 {
-    memset(OS_impl_dir_table, 0, sizeof(OS_impl_dir_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_DIR, OS_impl_dir_table);
 }
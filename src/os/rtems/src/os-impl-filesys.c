@@ -73,7 +73,7 @@ const char OS_RTEMS_DEVICEFILE_PREFIX[] = "/dev/";
  * The implementation-specific file system state table.
  * This keeps record of the RTEMS driver and mount options for each filesystem
  */
-OS_impl_filesys_internal_record_t OS_impl_filesys_table[OS_MAX_FILE_SYSTEMS];
+OS_impl_filesys_internal_record_t *OS_impl_filesys_table;
 
 /****************************************************************************************
                                     Filesys API
@@ -89,8 +89,7 @@ OS_impl_filesys_internal_record_t OS_impl_filesys_table[OS_MAX_FILE_SYSTEMS];
 int32 OS_Rtems_FileSysAPI_Impl_Init(void)
 {
     /* clear the local filesys table */
-    memset(OS_impl_filesys_table, 0, sizeof(OS_impl_filesys_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_FILESYS, OS_impl_filesys_table);
 }
 
 /*----------------------------------------------------------------
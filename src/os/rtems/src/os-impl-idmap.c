@@ -32,6 +32,7 @@
 #include "os-rtems.h"
 #include "os-shared-idmap.h"
 #include "os-impl-idmap.h"
+#include "os-shared-timebase.h"
 
 /****************************************************************************************
                                      DEFINES
@@ -39,6 +40,9 @@
 
 #define OSAL_TABLE_MUTEX_ATTRIBS (RTEMS_PRIORITY | RTEMS_BINARY_SEMAPHORE | RTEMS_INHERIT_PRIORITY)
 
+/* Interval at which to re-check a busy object table entry */
+#define OS_RTEMS_TABLE_POLL_MSEC 10
+
 /****************************************************************************************
                                      GLOBALS
  ***************************************************************************************/
@@ -126,17 +130,27 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
  *           See prototype for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, int32 timeout)
 {
-    rtems_interval wait_ticks;
-
-    if (attempts <= 10)
+    int    wait_ticks;
+    uint32 wait_msec;
+
+    /*
+     * There is no notification of state changes here, so this polls
+     * at a short fixed interval, limited by the caller's timeout.
+     */
+    if (timeout < 0 || timeout > OS_RTEMS_TABLE_POLL_MSEC)
     {
-        wait_ticks = attempts * attempts;
+        wait_msec = OS_RTEMS_TABLE_POLL_MSEC;
     }
     else
     {
-        wait_ticks = 100;
+        wait_msec = timeout;
+    }
+
+    if (OS_Milli2Ticks(wait_msec, &wait_ticks) != OS_SUCCESS)
+    {
+        wait_ticks = 1;
     }
 
     OS_Unlock_Global_Impl(objtype);
@@ -144,6 +158,29 @@ void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
     OS_Lock_Global_Impl(objtype);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_WaitForHandoff_Impl(osal_objtype_t objtype, int32 timeout)
+{
+    /* waiting is done by polling, so this is the same as any other state change */
+    OS_WaitForStateChange_Impl(objtype, timeout);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_SignalHandoff_Impl(osal_objtype_t objtype)
+{
+    /* nothing to do, waiting tasks will see the change when they next poll */
+}
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
  ***************************************************************************************/
@@ -46,7 +46,7 @@ typedef rtems_rtl_obj_t rtems_rtl_obj; /* Alias for RTEMS 4.11 */
                                    GLOBAL DATA
  ***************************************************************************************/
 
-OS_impl_module_internal_record_t OS_impl_module_table[OS_MAX_MODULES];
+OS_impl_module_internal_record_t *OS_impl_module_table;
 
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
@@ -59,8 +59,7 @@ OS_impl_module_internal_record_t OS_impl_module_table[OS_MAX_MODULES];
  *-----------------------------------------------------------------*/
 int32 OS_Rtems_ModuleAPI_Impl_Init(void)
 {
-    memset(OS_impl_module_table, 0, sizeof(OS_impl_module_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_MODULE, OS_impl_module_table);
 }
 
 /****************************************************************************************
@@ -51,12 +51,17 @@
 
 #define OSAL_MUTEX_ATTRIBS (RTEMS_PRIORITY | RTEMS_BINARY_SEMAPHORE | RTEMS_INHERIT_PRIORITY)
 
+/*
+ * Attributes of a mutex using the priority ceiling protocol instead of inheritance
+ */
+#define OSAL_MUTEX_CEILING_ATTRIBS (RTEMS_PRIORITY | RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY_CEILING)
+
 /****************************************************************************************
                                    GLOBAL DATA
  ***************************************************************************************/
 
 /* Tables where the OS object information is stored */
-OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
+OS_impl_mutex_internal_record_t *OS_impl_mutex_table;
 
 /****************************************************************************************
                                   MUTEX API
@@ -69,8 +74,7 @@ OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
  *-----------------------------------------------------------------*/
 int32 OS_Rtems_MutexAPI_Impl_Init(void)
 {
-    memset(OS_impl_mutex_table, 0, sizeof(OS_impl_mutex_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_MUTEX, OS_impl_mutex_table);
 }
 
 /*----------------------------------------------------------------
@@ -91,7 +95,15 @@ int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
     ** Try to create the mutex
     */
     r_name = OS_ObjectIdToInteger(OS_ObjectIdFromToken(token));
-    status = rtems_semaphore_create(r_name, 1, OSAL_MUTEX_ATTRIBS, 0, &impl->id);
+    if ((options & OS_MUTEX_FLAG_PRIO_CEILING) != 0)
+    {
+        /* OSAL priorities are used directly as RTEMS priorities */
+        status = rtems_semaphore_create(r_name, 1, OSAL_MUTEX_CEILING_ATTRIBS, (options >> 8) & 0xFF, &impl->id);
+    }
+    else
+    {
+        status = rtems_semaphore_create(r_name, 1, OSAL_MUTEX_ATTRIBS, 0, &impl->id);
+    }
 
     if (status != RTEMS_SUCCESSFUL)
     {
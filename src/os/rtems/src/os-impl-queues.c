@@ -49,7 +49,7 @@
  ***************************************************************************************/
 
 /* Tables where the OS object information is stored */
-OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
+OS_impl_queue_internal_record_t *OS_impl_queue_table;
 
 /****************************************************************************************
                                 MESSAGE QUEUE API
@@ -62,8 +62,7 @@ OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
  *-----------------------------------------------------------------*/
 int32 OS_Rtems_QueueAPI_Impl_Init(void)
 {
-    memset(OS_impl_queue_table, 0, sizeof(OS_impl_queue_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_QUEUE, OS_impl_queue_table);
 }
 
 /*----------------------------------------------------------------
@@ -138,6 +137,18 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueDeletePending_Impl(const OS_object_token_t *token, bool pending)
+{
+    /* Deleting the message queue wakes the tasks waiting on it, so nothing is needed beforehand */
+    return OS_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -231,6 +242,21 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetWithPriority_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied,
+                                   uint32 *priority, int32 timeout)
+{
+    /* The priority of a message is not recorded by the OS */
+    *priority = 0;
+
+    return OS_QueueGet_Impl(token, data, size, size_copied, timeout);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -250,10 +276,18 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
     /* Write the buffer pointer to the queue.  If an error occurred, report it
     ** with the corresponding SB status code.
     */
-    status = rtems_message_queue_send(rtems_queue_id, /* message queue descriptor */
-                                      data,           /* pointer to message */
-                                      size            /* length of message */
-    );
+    /* Only normal and urgent messages are distinguished, urgent ones go to the front of the queue */
+    if (OS_QUEUE_FLAGS_PRIORITY(flags) != 0)
+    {
+        status = rtems_message_queue_urgent(rtems_queue_id, data, size);
+    }
+    else
+    {
+        status = rtems_message_queue_send(rtems_queue_id, /* message queue descriptor */
+                                          data,           /* pointer to message */
+                                          size            /* length of message */
+        );
+    }
 
     if (status == RTEMS_TOO_MANY)
     {
@@ -275,6 +309,117 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutTimed_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags,
+                            int32 timeout)
+{
+    int32 return_code;
+    int   tick_count;
+
+    tick_count = 0;
+    if (timeout != OS_PEND && timeout != OS_CHECK)
+    {
+        /* msecs rounded to the closest system tick count */
+        if (OS_Milli2Ticks(timeout, &tick_count) != OS_SUCCESS)
+        {
+            return OS_ERROR;
+        }
+    }
+
+    /*
+     * RTEMS message queues cannot block the sender, so poll for space once
+     * per tick until the timeout expires.
+     */
+    return_code = OS_QueuePut_Impl(token, data, size, flags);
+    while (return_code == OS_QUEUE_FULL && timeout != OS_CHECK)
+    {
+        if (timeout != OS_PEND)
+        {
+            if (tick_count <= 0)
+            {
+                return_code = OS_QUEUE_TIMEOUT;
+                break;
+            }
+            --tick_count;
+        }
+
+        rtems_task_wake_after(1);
+        return_code = OS_QueuePut_Impl(token, data, size, flags);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutMultiple_Impl(const OS_object_token_t *token, const void *data, size_t size, const size_t *sizes,
+                               uint32 count, uint32 flags, uint32 *count_put)
+{
+    int32  return_code;
+    uint32 i;
+
+    /* The OS queue can only accept one message per call */
+    return_code = OS_SUCCESS;
+    for (i = 0; i < count; ++i)
+    {
+        return_code = OS_QueuePut_Impl(token, (const uint8 *)data + (i * size), sizes[i], flags);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    *count_put = i;
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMultiple_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *sizes,
+                               uint32 max_count, uint32 *count_copied, int32 timeout)
+{
+    int32  return_code;
+    uint32 i;
+
+    /* The OS queue can only deliver one message per call, only the first may wait */
+    i           = 0;
+    return_code = OS_QueueGet_Impl(token, data, size, &sizes[0], timeout);
+    while (return_code == OS_SUCCESS)
+    {
+        ++i;
+        if (i >= max_count)
+        {
+            break;
+        }
+
+        return_code = OS_QueueGet_Impl(token, (uint8 *)data + (i * size), size, &sizes[i], OS_CHECK);
+    }
+
+    *count_copied = i;
+
+    /* Running out of messages after the first one is not an error */
+    if (i > 0)
+    {
+        return_code = OS_SUCCESS;
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -53,7 +53,7 @@
                                    GLOBAL DATA
  ***************************************************************************************/
 /* Tables where the OS object information is stored */
-OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
+OS_impl_task_internal_record_t *OS_impl_task_table;
 
 /*---------------------------------------------------------------------------------------
    Name: OS_RtemsEntry
@@ -79,8 +79,7 @@ static rtems_task OS_RtemsEntry(rtems_task_argument arg)
  *-----------------------------------------------------------------*/
 int32 OS_Rtems_TaskAPI_Impl_Init(void)
 {
-    memset(OS_impl_task_table, 0, sizeof(OS_impl_task_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TASK, OS_impl_task_table);
 }
 
 /*----------------------------------------------------------------
@@ -80,7 +80,7 @@ typedef struct
                                    GLOBAL DATA
  ***************************************************************************************/
 
-OS_impl_timebase_internal_record_t OS_impl_timebase_table[OS_MAX_TIMEBASES];
+OS_impl_timebase_internal_record_t *OS_impl_timebase_table;
 
 /*----------------------------------------------------------------
  *
@@ -233,7 +233,7 @@ int32 OS_Rtems_TimeBaseAPI_Impl_Init(void)
      */
     OS_SharedGlobalVars.MicroSecPerTick = (RTEMS_GlobalVars.ClockAccuracyNsec + 500) / 1000;
 
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TIMEBASE, OS_impl_timebase_table);
 }
 
 /****************************************************************************************
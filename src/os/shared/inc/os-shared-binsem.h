@@ -39,7 +39,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_bin_sem_internal_record_t OS_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+extern OS_bin_sem_internal_record_t *OS_bin_sem_table;
 
 /****************************************************************************************
                  SEMAPHORE API LOW-LEVEL IMPLEMENTATION FUNCTIONS
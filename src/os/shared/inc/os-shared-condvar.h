@@ -38,7 +38,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_condvar_internal_record_t OS_condvar_table[OS_MAX_CONDVARS];
+extern OS_condvar_internal_record_t *OS_condvar_table;
 
 /*---------------------------------------------------------------------------------------
    Name: OS_CondVarAPI_Init
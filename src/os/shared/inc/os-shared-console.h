@@ -53,7 +53,7 @@ typedef struct
     bool            IsAsync;        /**< Whether to write data via deferred utility task */
 } OS_console_internal_record_t;
 
-extern OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
+extern OS_console_internal_record_t *OS_console_table;
 
 /****************************************************************************************
                  CONSOLE / DEBUG API LOW-LEVEL IMPLEMENTATION FUNCTIONS
@@ -39,7 +39,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_count_sem_internal_record_t OS_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
+extern OS_count_sem_internal_record_t *OS_count_sem_table;
 
 /****************************************************************************************
                                 IMPLEMENTATION FUNCTIONS
@@ -88,6 +88,33 @@ int32 OS_CountSemTake_Impl(const OS_object_token_t *token);
  ------------------------------------------------------------------*/
 int32 OS_CountSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs);
 
+/*----------------------------------------------------------------
+
+    Purpose: Increment the semaphore value by the given number of units
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_CountSemGiveN_Impl(const OS_object_token_t *token, uint32 count);
+
+/*----------------------------------------------------------------
+
+    Purpose: Decrement the semaphore value by the given number of units
+             Block the calling task until the value is at least that number.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_CountSemTakeN_Impl(const OS_object_token_t *token, uint32 count);
+
+/*----------------------------------------------------------------
+
+    Purpose: Decrement the semaphore value by the given number of units,
+             with a time limit
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_SEM_TIMEOUT must be returned if the time limit was reached
+ ------------------------------------------------------------------*/
+int32 OS_CountSemTimedWaitN_Impl(const OS_object_token_t *token, uint32 count, uint32 msecs);
+
 /*----------------------------------------------------------------
 
     Purpose: Free the OS resources associated with the counting semaphore
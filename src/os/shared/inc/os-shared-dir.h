@@ -39,7 +39,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_dir_internal_record_t OS_dir_table[OS_MAX_NUM_OPEN_DIRS];
+extern OS_dir_internal_record_t *OS_dir_table;
 
 /*
  * Directory API abstraction layer
@@ -41,7 +41,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_stream_internal_record_t OS_stream_table[OS_MAX_NUM_OPEN_FILES];
+extern OS_stream_internal_record_t *OS_stream_table;
 
 /****************************************************************************************
                  FILE / DIRECTORY API LOW-LEVEL IMPLEMENTATION FUNCTIONS
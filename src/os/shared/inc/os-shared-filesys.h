@@ -101,7 +101,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_filesys_internal_record_t OS_filesys_table[OS_MAX_FILE_SYSTEMS];
+extern OS_filesys_internal_record_t *OS_filesys_table;
 
 /*
  * File system abstraction layer
@@ -31,6 +31,23 @@
 
 #define OS_OBJECT_ID_RESERVED ((osal_id_t) {0xFFFFFFFF})
 
+/*
+ * Default time limit, in milliseconds, for an object lock to wait
+ * for another task to release the object when converting a token.
+ */
+#define OS_OBJECT_LOCK_TIMEOUT 1000
+
+#ifdef OSAL_CONFIG_CACHE_ALIGNED_OBJECTS
+/*
+ * The size of the fields in OS_common_record_t, and the padding needed
+ * to extend the record to a whole number of cache lines.  This must be
+ * kept consistent with the structure below, which is verified at compile time.
+ */
+#define OS_COMMON_RECORD_DATA_SIZE (sizeof(const char *) + (2 * sizeof(osal_id_t)) + sizeof(uint16))
+#define OS_COMMON_RECORD_PAD_SIZE \
+    ((OS_CACHE_LINE_SIZE - (OS_COMMON_RECORD_DATA_SIZE % OS_CACHE_LINE_SIZE)) % OS_CACHE_LINE_SIZE)
+#endif
+
 /*
  * This supplies a non-abstract definition of "OS_common_record_t"
  */
@@ -40,8 +57,16 @@ struct OS_common_record
     osal_id_t   active_id;
     osal_id_t   creator;
     uint16      refcount;
+
+#ifdef OSAL_CONFIG_CACHE_ALIGNED_OBJECTS
+    uint8 cache_pad[OS_COMMON_RECORD_PAD_SIZE];
+#endif
 };
 
+/*
+ * Layout of the common table using the compile-time limits.  These are the
+ * defaults; the actual layout is determined by the limits set at startup.
+ */
 typedef enum
 {
     OS_TASK_BASE         = 0,
@@ -100,6 +125,11 @@ struct OS_object_token
  */
 #define OS_OBJECT_TABLE_GET(tbl, tok) (&tbl[OS_ObjectIndexFromToken(&(tok))])
 
+/*
+ * Macro to allocate a per-type table, based on the type of its records
+ */
+#define OS_OBJECT_TABLE_ALLOC(idtype, tbl) OS_ObjectIdTableAlloc(idtype, sizeof(*(tbl)), (void **)&(tbl))
+
 /*
  * Macro to clear a table entry and reset its name
  */
@@ -139,24 +169,50 @@ typedef struct
     OS_object_token_t    token;
 } OS_object_iter_t;
 
+/*
+ * The number of object IDs collected by each pass of a snapshot
+ */
+#define OS_OBJECT_SNAPSHOT_SIZE 16
+
+/*
+ * The number of objects processed under each table lock by the batch create/delete APIs
+ */
+#define OS_OBJECT_BATCH_SIZE 16
+
+/*
+ * State object associated with an object snapshot
+ *
+ * Unlike an iterator, a snapshot only holds the table lock while it
+ * collects each batch of IDs, and never while the IDs are being used.
+ */
+typedef struct
+{
+    OS_ObjectMatchFunc_t match;
+    void *               arg;
+    osal_objtype_t       objtype;
+    uint32               next_idx;
+    uint32               count;
+    osal_id_t            ids[OS_OBJECT_SNAPSHOT_SIZE];
+} OS_object_snapshot_t;
+
 /*
  * Global instantiations
  */
-/* The following are quick-access pointers to the various sections of the common table */
-extern OS_common_record_t *const OS_global_task_table;
-extern OS_common_record_t *const OS_global_queue_table;
-extern OS_common_record_t *const OS_global_bin_sem_table;
-extern OS_common_record_t *const OS_global_count_sem_table;
-extern OS_common_record_t *const OS_global_mutex_table;
-extern OS_common_record_t *const OS_global_rwlock_table;
-extern OS_common_record_t *const OS_global_stream_table;
-extern OS_common_record_t *const OS_global_dir_table;
-extern OS_common_record_t *const OS_global_timebase_table;
-extern OS_common_record_t *const OS_global_timecb_table;
-extern OS_common_record_t *const OS_global_module_table;
-extern OS_common_record_t *const OS_global_filesys_table;
-extern OS_common_record_t *const OS_global_console_table;
-extern OS_common_record_t *const OS_global_condvar_table;
+/* The following are quick-access pointers to the various sections of the common table, set by OS_ObjectIdInit() */
+extern OS_common_record_t *OS_global_task_table;
+extern OS_common_record_t *OS_global_queue_table;
+extern OS_common_record_t *OS_global_bin_sem_table;
+extern OS_common_record_t *OS_global_count_sem_table;
+extern OS_common_record_t *OS_global_mutex_table;
+extern OS_common_record_t *OS_global_rwlock_table;
+extern OS_common_record_t *OS_global_stream_table;
+extern OS_common_record_t *OS_global_dir_table;
+extern OS_common_record_t *OS_global_timebase_table;
+extern OS_common_record_t *OS_global_timecb_table;
+extern OS_common_record_t *OS_global_module_table;
+extern OS_common_record_t *OS_global_filesys_table;
+extern OS_common_record_t *OS_global_console_table;
+extern OS_common_record_t *OS_global_condvar_table;
 
 /****************************************************************************************
                                 ID MAPPING FUNCTIONS
@@ -171,6 +227,17 @@ extern OS_common_record_t *const OS_global_condvar_table;
 ---------------------------------------------------------------------------------------*/
 int32 OS_ObjectIdInit(void);
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_ObjectIdTableAlloc
+
+   Purpose: Allocates a per-type table, with one zeroed record of "record_size"
+            bytes for each object of "idtype" configured at startup.  Any table
+            previously allocated at "*table" is freed.
+
+   returns: OS_SUCCESS on success, or OS_ERROR if the memory is not available
+---------------------------------------------------------------------------------------*/
+int32 OS_ObjectIdTableAlloc(osal_objtype_t idtype, size_t record_size, void **table);
+
 /*
  * Table locking and unlocking for global objects can be done at the shared code
  * layer but the actual implementation is OS-specific
@@ -212,12 +279,14 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype);
 
     Purpose: Waits for a change in the global table identified by "idtype"
 
+   The timeout is in milliseconds, or OS_PEND to wait indefinitely.
+
    NOTE: The table must be already "owned" (via OS_Lock_Global) by the calling
    at the time this function is invoked.  The lock is released and re-acquired
    before returning from this function.
 
   -----------------------------------------------------------------*/
-void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts);
+void OS_WaitForStateChange(OS_object_token_t *token, int32 timeout);
 
 /*----------------------------------------------------------------
 
@@ -226,12 +295,56 @@ void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts);
    state i.e. the acquisition or release of a lock/refcount from
    another thread.
 
+   The caller is blocked for no longer than the timeout, in milliseconds,
+   or indefinitely if the timeout is OS_PEND.
+
    It is not guaranteed what, if any, state change has actually
    occurred when this function returns.  This may be implemented as
-   a simple OS_TaskDelay().
+   a simple OS_TaskDelay() of up to the timeout.
+
+ ------------------------------------------------------------------*/
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Waits for all other references to the object identified by
+    "token" to be released, after its ID has been set to OS_OBJECT_ID_RESERVED
+    as part of obtaining an EXCLUSIVE lock.
+
+   The timeout is in milliseconds, or OS_PEND to wait indefinitely.
+
+   NOTE: The table must be already "owned" (via OS_Lock_Global) by the calling
+   at the time this function is invoked.  The lock is released and re-acquired
+   before returning from this function.
+
+  -----------------------------------------------------------------*/
+void OS_WaitForHandoff(OS_object_token_t *token, int32 timeout);
+
+/*----------------------------------------------------------------
+
+   Purpose: Block the caller until the last reference to an object
+   which is pending an EXCLUSIVE lock has been released by another
+   thread, as indicated via OS_SignalHandoff_Impl().
+
+   The caller is blocked for no longer than the timeout, in milliseconds,
+   or indefinitely if the timeout is OS_PEND.
+
+   Unlike OS_WaitForStateChange_Impl(), this is not woken by other
+   activity on the table.  It is not guaranteed that the references have
+   actually been released when this function returns.  This may be
+   implemented in the same manner as OS_WaitForStateChange_Impl().
 
  ------------------------------------------------------------------*/
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts);
+void OS_WaitForHandoff_Impl(osal_objtype_t objtype, int32 timeout);
+
+/*----------------------------------------------------------------
+
+   Purpose: Wake any task blocked in OS_WaitForHandoff_Impl() for the
+   given object type.  This is invoked with the table locked, after the
+   last reference to an object pending an EXCLUSIVE lock is released.
+
+ ------------------------------------------------------------------*/
+void OS_SignalHandoff_Impl(osal_objtype_t objtype);
 
 /*
    Function prototypes for routines implemented in common layers but private to OSAL
@@ -292,10 +405,36 @@ static inline bool OS_ObjectIdIsValid(osal_id_t object_id)
 
     Purpose: Obtains the maximum number of objects for "idtype" in the global table
 
-    Returns: OS_SUCCESS on success, or relevant error code
+    This is the limit in effect at runtime, which may be lower than the
+    compile-time limit if so configured by the BSP at startup.
+
+    Returns: The number of objects, or 0 if idtype is not valid
  ------------------------------------------------------------------*/
 uint32 OS_GetMaxForObjectType(osal_objtype_t idtype);
 
+/*----------------------------------------------------------------
+
+    Purpose: Obtains the compile-time maximum number of objects for "idtype"
+
+    This is the limit for the type when none is configured at startup.
+
+    Returns: The number of objects, or 0 if idtype is not valid
+ ------------------------------------------------------------------*/
+uint32 OS_GetDefaultMaxForObjectType(osal_objtype_t idtype);
+
+/*----------------------------------------------------------------
+
+    Purpose: Obtains the highest number of objects for "idtype" that
+    may be configured at startup
+
+    Queues and streams are also identified by a bit in an OS_FdSet, which
+    is sized at compile time, so these are limited to the default.  Other
+    types are limited by the size of the index within an object ID.
+
+    Returns: The number of objects, or 0 if idtype is not valid
+ ------------------------------------------------------------------*/
+uint32 OS_GetHighestMaxForObjectType(osal_objtype_t idtype);
+
 /*----------------------------------------------------------------
 
     Purpose: Obtains the base object number for "idtype" in the global table
@@ -377,6 +516,22 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
     Purpose: Converts a token from OS_ObjectIdTransactionInit() to the
              type that was requested by the user.
 
+             If the object is busy, this waits for up to "timeout" milliseconds
+             for it to become available.  OS_PEND waits indefinitely, and
+             OS_CHECK fails immediately with OS_ERR_OBJECT_IN_USE.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdConvertTokenTimed(OS_object_token_t *token, int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Converts a token from OS_ObjectIdTransactionInit() to the
+             type that was requested by the user.
+
+             This is equivalent to OS_ObjectIdConvertTokenTimed() with
+             a timeout of OS_OBJECT_LOCK_TIMEOUT.
+
     Returns: OS_SUCCESS on success, or relevant error code
  ------------------------------------------------------------------*/
 int32 OS_ObjectIdConvertToken(OS_object_token_t *token);
@@ -469,6 +624,56 @@ int32 OS_ObjectIdFinalizeNew(int32 operation_status, OS_object_token_t *token, o
  ------------------------------------------------------------------*/
 int32 OS_ObjectIdFinalizeDelete(int32 operation_status, OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Issue new object IDs of the given type for each of the given names,
+             which may be NULL, under a single lock of the table.
+             This is all-or-nothing: if any ID cannot be issued, none are.
+             On success, each token is as if returned by OS_ObjectIdAllocateNew()
+             followed by OS_ObjectIdConvertToken(), but the table is left unlocked.
+             The OS_ObjectIdFinalizeNewBatch() function must be called to complete
+             the operation.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdAllocateNewBatch(osal_objtype_t idtype, const char *const *names, uint32 count,
+                                  OS_object_token_t *tokens);
+
+/*----------------------------------------------------------------
+
+    Purpose: Completes the operation initiated by OS_ObjectIdAllocateNewBatch()
+             under a single lock of the table.
+             If the operation was successful, the final OSAL IDs are returned
+             If the operation was unsuccessful, all IDs are deleted and returned to the pool.
+
+    Returns: The operation_status value
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdFinalizeNewBatch(int32 operation_status, OS_object_token_t *tokens, uint32 count, osal_id_t *outids);
+
+/*----------------------------------------------------------------
+
+    Purpose: Obtains an EXCLUSIVE lock on each of the given objects, for deletion.
+             Idle objects are all locked under a single lock of the table; only
+             objects which are in use by another task are waited for individually.
+             Upon return, the lock mode of each token indicates if it was locked
+             (EXCLUSIVE) or not (NONE).  The OS_ObjectIdFinalizeDeleteBatch()
+             function must be called to complete the operation.
+
+    Returns: OS_SUCCESS if all objects were locked, or the first error code
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdGetByIdBatch(osal_objtype_t idtype, const osal_id_t *ids, uint32 count, OS_object_token_t *tokens);
+
+/*----------------------------------------------------------------
+
+    Purpose: Completes the delete operations on the tokens locked by
+             OS_ObjectIdGetByIdBatch() under a single lock of the table.
+             Each object for which the operation status is OS_SUCCESS is deleted
+             and its ID returned to the pool.  Tokens which are not locked are skipped.
+
+    Returns: OS_SUCCESS, or the first unsuccessful operation status
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdFinalizeDeleteBatch(const int32 *operation_status, OS_object_token_t *tokens, uint32 count);
+
 /*----------------------------------------------------------------
 
     Purpose: Initialize a generic object iterator of the given type.
@@ -525,14 +730,43 @@ static inline const OS_object_token_t *OS_ObjectIdIteratorRef(OS_object_iter_t *
  ------------------------------------------------------------------*/
 int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, OS_ObjectIdIteratorProcessFunc_t func);
 
+/*----------------------------------------------------------------
+
+    Purpose: Initialize a snapshot of the objects of the given type.
+             This does not lock the table, and there is nothing to release.
+
+    Returns: None
+ ------------------------------------------------------------------*/
+void OS_ObjectIdSnapshotInit(OS_ObjectMatchFunc_t matchfunc, void *matcharg, osal_objtype_t objtype,
+                             OS_object_snapshot_t *snap);
+
+/*----------------------------------------------------------------
+
+    Purpose: Collect the IDs of the next batch of matching objects.
+             The table is locked only for the duration of this call, and
+             the match function is invoked with the lock held.  The IDs
+             are placed in the "ids" member and the number collected in
+             the "count" member.
+
+    Returns: true if any IDs were collected, false if at end of table
+ ------------------------------------------------------------------*/
+bool OS_ObjectIdSnapshotNext(OS_object_snapshot_t *snap);
+
 /*
  * Internal helper functions
  * These are not normally called outside this unit, but need
  * to be exposed for unit testing.
  */
-bool  OS_ObjectFilterActive(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
-bool  OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
-int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_object_token_t *token);
-int32 OS_ObjectIdFindNextFree(OS_object_token_t *token);
+bool   OS_ObjectFilterActive(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
+bool   OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
+int32  OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_object_token_t *token);
+int32  OS_ObjectIdFindNextFree(OS_object_token_t *token);
+void   OS_ObjectIdFreeQueueAppend(const OS_object_token_t *token);
+bool   OS_ObjectIdRefcountTryAcquire(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token);
+bool   OS_ObjectIdRefcountRelease(OS_object_token_t *token);
+uint32 OS_ObjectNameHash(const char *name);
+void   OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name);
+void   OS_ObjectIdNameIndexRemove(const OS_object_token_t *token);
+int32  OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token);
 
 #endif /* OS_SHARED_IDMAP_H */
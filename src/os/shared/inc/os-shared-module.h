@@ -49,7 +49,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_module_internal_record_t OS_module_table[OS_MAX_MODULES];
+extern OS_module_internal_record_t *OS_module_table;
 
 /****************************************************************************************
                  MODULE LOADER API LOW-LEVEL IMPLEMENTATION FUNCTIONS
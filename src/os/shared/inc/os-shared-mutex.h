@@ -33,13 +33,18 @@ typedef struct
 {
     char      obj_name[OS_MAX_API_NAME];
     osal_id_t last_owner;
+
+#ifdef OSAL_CONFIG_MUTEX_STATS
+    OS_time_t          take_time; /**< When the current owner took the mutex */
+    OS_mut_sem_stats_t stats;
+#endif
 } OS_mutex_internal_record_t;
 
 /*
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_mutex_internal_record_t OS_mutex_table[OS_MAX_MUTEXES];
+extern OS_mutex_internal_record_t *OS_mutex_table;
 
 /*---------------------------------------------------------------------------------------
    Name: OS_MutexAPI_Init
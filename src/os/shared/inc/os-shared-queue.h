@@ -28,19 +28,32 @@
 
 #include "osapi-queue.h"
 #include "os-shared-globaldefs.h"
+#include "os-shared-idmap.h"
 
 typedef struct
 {
     char              queue_name[OS_MAX_API_NAME];
     size_t            max_size;
     osal_blockcount_t max_depth;
+    size_t            max_bytes;  /**< byte budget of a packed queue, 0 if messages are held in fixed size entries */
+    bool              referenced; /**< set by the implementation if operations must hold a reference to the queue */
+    OS_object_token_t source;     /**< reference to the broadcast queue held by a subscriber until it is deleted */
+
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_queue_stats_t stats;
+#endif
 } OS_queue_internal_record_t;
 
 /*
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_queue_internal_record_t OS_queue_table[OS_MAX_QUEUES];
+extern OS_queue_internal_record_t *OS_queue_table;
+
+/*
+ * Extracts the message priority from the flags passed to OS_QueuePut() and similar calls
+ */
+#define OS_QUEUE_FLAGS_PRIORITY(flags) ((flags) >> OS_QUEUE_PRIORITY_SHIFT)
 
 /****************************************************************************************
                  MESSAGE QUEUE API LOW-LEVEL IMPLEMENTATION FUNCTIONS
@@ -55,6 +68,24 @@ extern OS_queue_internal_record_t OS_queue_table[OS_MAX_QUEUES];
 ---------------------------------------------------------------------------------------*/
 int32 OS_QueueAPI_Init(void);
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_QueueStatsLatency
+
+   Purpose: Records the latency of a message which was put at "put_time",
+            as measured by OS_GetMonotonicTime_Impl(), in the queue statistics.
+            Only used if OSAL_CONFIG_QUEUE_STATS is enabled.
+---------------------------------------------------------------------------------------*/
+void OS_QueueStatsLatency(OS_queue_internal_record_t *queue, OS_time_t put_time);
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_QueueStatsDrop
+
+   Purpose: Records that a broadcast subscriber lost "count" messages by falling
+            behind, in the queue statistics.
+            Only used if OSAL_CONFIG_QUEUE_STATS is enabled.
+---------------------------------------------------------------------------------------*/
+void OS_QueueStatsDrop(OS_queue_internal_record_t *queue, uint32 count);
+
 /*----------------------------------------------------------------
 
     Purpose: Prepare/Allocate OS resources for a message queue
@@ -71,6 +102,34 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags);
  ------------------------------------------------------------------*/
 int32 OS_QueueDelete_Impl(const OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Mark a message queue as about to be deleted, or no longer so if
+             deleting it failed.  Calls may be nested.  While marked, a task
+             waiting on the queue must be woken and return OS_ERR_INVALID_ID,
+             so that it releases its reference to the queue.
+
+             Only needed where the implementation sets the referenced flag of
+             the queue, as tasks do not hold references to other queues.
+
+             The implementation may refuse to mark a queue which cannot be
+             deleted, in which case the queue is not deleted either.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_QueueDeletePending_Impl(const OS_object_token_t *token, bool pending);
+
+/*----------------------------------------------------------------
+
+    Purpose: Prepare/Allocate OS resources for a subscriber to a broadcast queue
+             The broadcast queue is referenced by source_token, and cannot be
+             deleted while the subscriber exists.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_INCORRECT_OBJ_TYPE must be returned if the source is not a broadcast queue
+ ------------------------------------------------------------------*/
+int32 OS_QueueSubscribe_Impl(const OS_object_token_t *token, const OS_object_token_t *source_token, uint32 flags);
+
 /*----------------------------------------------------------------
 
     Purpose: Receive a message on a message queue.
@@ -83,6 +142,17 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token);
  ------------------------------------------------------------------*/
 int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied, int32 timeout);
 
+/*----------------------------------------------------------------
+
+    Purpose: Receive a message on a message queue, along with its priority
+             The priority is output as 0 if the OS does not record it.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             As OS_QueueGet_Impl()
+ ------------------------------------------------------------------*/
+int32 OS_QueueGetWithPriority_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied,
+                                   uint32 *priority, int32 timeout);
+
 /*----------------------------------------------------------------
 
     Purpose: Put a message into a message queue
@@ -92,6 +162,90 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
  ------------------------------------------------------------------*/
 int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags);
 
+/*----------------------------------------------------------------
+
+    Purpose: Put a message into a message queue, waiting for space if it is full
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_QUEUE_FULL must be returned if the queue is full and timeout is OS_CHECK
+             OS_QUEUE_TIMEOUT must be returned if the queue remained full until the timeout
+ ------------------------------------------------------------------*/
+int32 OS_QueuePutTimed_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags,
+                            int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Receive several messages from a message queue.
+             The calling task will be blocked if no message is immediately available,
+             but only waits for the first message.  Messages are stored in consecutive
+             buffers of "size" bytes each, starting at "data".
+
+    Returns: OS_SUCCESS if at least one message was received, or relevant error code
+             OS_QUEUE_TIMEOUT must be returned if the timeout expired and no message was received
+             OS_QUEUE_EMPTY must be returned if the queue is empty when polled (OS_CHECK)
+ ------------------------------------------------------------------*/
+int32 OS_QueueGetMultiple_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *sizes,
+                               uint32 max_count, uint32 *count_copied, int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Put several messages into a message queue, in order.
+             Messages are taken from consecutive buffers of "size" bytes each,
+             starting at "data".
+
+    Returns: OS_SUCCESS if all messages were put, or relevant error code
+             OS_QUEUE_FULL must be returned if the queue became full, in which case
+             count_put indicates the number of messages that were put.
+ ------------------------------------------------------------------*/
+int32 OS_QueuePutMultiple_Impl(const OS_object_token_t *token, const void *data, size_t size, const size_t *sizes,
+                               uint32 count, uint32 flags, uint32 *count_put);
+
+/*----------------------------------------------------------------
+
+    Purpose: Claim the next free slot in a message queue, and output
+             a pointer to its data area for the caller to fill in
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_QUEUE_FULL must be returned if the queue is full.
+             OS_ERR_NOT_IMPLEMENTED if the queue storage is not accessible
+ ------------------------------------------------------------------*/
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data_ptr);
+
+/*----------------------------------------------------------------
+
+    Purpose: Make a slot previously claimed by OS_QueueReserve_Impl()
+             available to receivers, as a message of the given size
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_INVALID_POINTER if data_ptr does not refer to a slot which
+             is reserved and not yet committed
+ ------------------------------------------------------------------*/
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data_ptr, size_t size, uint32 flags);
+
+/*----------------------------------------------------------------
+
+    Purpose: Claim the oldest message in a message queue, and output
+             a pointer to its data in the queue storage.
+             The calling task will be blocked if no message is immediately available
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_QUEUE_TIMEOUT must be returned if the timeout expired and no message was received
+             OS_QUEUE_EMPTY must be returned if the queue is empty when polled (OS_CHECK)
+             OS_ERR_NOT_IMPLEMENTED if the queue storage is not accessible
+ ------------------------------------------------------------------*/
+int32 OS_QueueGetRef_Impl(const OS_object_token_t *token, const void **data_ptr, size_t *size_copied, int32 timeout);
+
+/*----------------------------------------------------------------
+
+    Purpose: Return a slot previously claimed by OS_QueueGetRef_Impl()
+             to the message queue
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_INVALID_POINTER if data_ptr does not refer to a slot which
+             was received and not yet released
+ ------------------------------------------------------------------*/
+int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *data_ptr);
+
 /*----------------------------------------------------------------
 
     Purpose: Obtain OS-specific information about a message queue
@@ -100,4 +254,33 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
  ------------------------------------------------------------------*/
 int32 OS_QueueGetInfo_Impl(const OS_object_token_t *token, OS_queue_prop_t *queue_prop);
 
+/*----------------------------------------------------------------
+
+    Purpose: Prepare for OS_SelectMultiple_Impl() to wait on a queue
+
+             On entry, SelectFlags indicates whether to wait for the queue to be
+             readable (not empty) and/or writable (not full), as OS_STREAM_STATE_READABLE
+             and OS_STREAM_STATE_WRITABLE.  On return, it indicates which of these
+             states are already known to be true, so the wait need not block.
+
+             The file descriptor to wait on is stored in os_fd, and fd_flags indicates
+             whether to wait for it to become readable and/or writable.
+
+             Each successful call must be followed by OS_QueueSelectEnd_Impl()
+             with the same SelectFlags as were passed in.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_OPERATION_NOT_SUPPORTED if the queue cannot be used with select()
+ ------------------------------------------------------------------*/
+int32 OS_QueueSelectBegin_Impl(const OS_object_token_t *token, uint32 *SelectFlags, int *os_fd, uint32 *fd_flags);
+
+/*----------------------------------------------------------------
+
+    Purpose: Complete a wait on a queue prepared by OS_QueueSelectBegin_Impl()
+
+             On entry, SelectFlags indicates the states which were waited for, and
+             on return it indicates which of these states the queue is now in.
+ ------------------------------------------------------------------*/
+void OS_QueueSelectEnd_Impl(const OS_object_token_t *token, uint32 *SelectFlags);
+
 #endif /* OS_SHARED_QUEUE_H */
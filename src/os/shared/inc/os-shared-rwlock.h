@@ -39,7 +39,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_rwlock_internal_record_t OS_rwlock_table[OS_MAX_RWLOCKS];
+extern OS_rwlock_internal_record_t *OS_rwlock_table;
 
 /*---------------------------------------------------------------------------------------
    Name: OS_RwLockAPI_Init
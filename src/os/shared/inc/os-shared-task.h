@@ -45,7 +45,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_task_internal_record_t OS_task_table[OS_MAX_TASKS];
+extern OS_task_internal_record_t *OS_task_table;
 
 /****************************************************************************************
                           TASK API LOW-LEVEL IMPLEMENTATION FUNCTIONS
@@ -51,7 +51,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_timecb_internal_record_t OS_timecb_table[OS_MAX_TIMERS];
+extern OS_timecb_internal_record_t *OS_timecb_table;
 
 /*---------------------------------------------------------------------------------------
    Name: OS_TimerCbAPI_Init
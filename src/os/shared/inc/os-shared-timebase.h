@@ -44,7 +44,7 @@ typedef struct
  * These record types have extra information with each entry.  These tables are used
  * to share extra data between the common layer and the OS-specific implementation.
  */
-extern OS_timebase_internal_record_t OS_timebase_table[OS_MAX_TIMEBASES];
+extern OS_timebase_internal_record_t *OS_timebase_table;
 
 /****************************************************************************************
                  CLOCK / TIME API LOW-LEVEL IMPLEMENTATION FUNCTIONS
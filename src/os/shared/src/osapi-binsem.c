@@ -56,7 +56,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_BINSEM
 };
 
-OS_bin_sem_internal_record_t OS_bin_sem_table[LOCAL_NUM_OBJECTS];
+OS_bin_sem_internal_record_t *OS_bin_sem_table;
 
 /****************************************************************************************
                                   SEMAPHORE API
@@ -78,8 +78,7 @@ OS_bin_sem_internal_record_t OS_bin_sem_table[LOCAL_NUM_OBJECTS];
  *-----------------------------------------------------------------*/
 int32 OS_BinSemAPI_Init(void)
 {
-    memset(OS_bin_sem_table, 0, sizeof(OS_bin_sem_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_bin_sem_table);
 }
 
 /*----------------------------------------------------------------
@@ -117,6 +116,99 @@ int32 OS_BinSemCreate(osal_id_t *sem_id, const char *sem_name, uint32 sem_initia
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemCreateBatch(osal_id_t *sem_ids, const char *const *sem_names, uint32 count, uint32 sem_initial_value,
+                           uint32 options)
+{
+    int32                         return_code;
+    OS_object_token_t             tokens[OS_OBJECT_BATCH_SIZE];
+    OS_bin_sem_internal_record_t *binsem;
+    uint32                        done;
+    uint32                        chunk;
+    uint32                        i;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(sem_ids);
+    OS_CHECK_POINTER(sem_names);
+    ARGCHECK(count > 0, OS_ERR_INVALID_SIZE);
+    for (i = 0; i < count; ++i)
+    {
+        OS_CHECK_APINAME(sem_names[i]);
+    }
+
+    return_code = OS_SUCCESS;
+    done        = 0;
+    while (done < count)
+    {
+        chunk = count - done;
+        if (chunk > OS_OBJECT_BATCH_SIZE)
+        {
+            chunk = OS_OBJECT_BATCH_SIZE;
+        }
+
+        /* Note - unlike OS_ObjectIdAllocateNew() this does not leave the table locked */
+        return_code = OS_ObjectIdAllocateNewBatch(LOCAL_OBJID_TYPE, &sem_names[done], chunk, tokens);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        for (i = 0; i < chunk; ++i)
+        {
+            binsem = OS_OBJECT_TABLE_GET(OS_bin_sem_table, tokens[i]);
+
+            /* Reset the table entry and save the name */
+            OS_OBJECT_INIT(tokens[i], binsem, obj_name, sem_names[done + i]);
+
+            return_code = OS_BinSemCreate_Impl(&tokens[i], sem_initial_value, options);
+            if (return_code != OS_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        /* If any failed, then the semaphores already created in this group are deleted */
+        if (return_code != OS_SUCCESS)
+        {
+            while (i > 0)
+            {
+                --i;
+                OS_BinSemDelete_Impl(&tokens[i]);
+            }
+        }
+
+        /* Check result, finalize records */
+        return_code = OS_ObjectIdFinalizeNewBatch(return_code, tokens, chunk, &sem_ids[done]);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        done += chunk;
+    }
+
+    /* If any group failed, then the semaphores created in the previous groups are deleted */
+    if (return_code != OS_SUCCESS)
+    {
+        if (done > 0)
+        {
+            OS_BinSemDeleteBatch(sem_ids, done);
+        }
+
+        for (i = 0; i < count; ++i)
+        {
+            sem_ids[i] = OS_OBJECT_ID_UNDEFINED;
+        }
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -140,6 +232,62 @@ int32 OS_BinSemDelete(osal_id_t sem_id)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemDeleteBatch(const osal_id_t *sem_ids, uint32 count)
+{
+    OS_object_token_t tokens[OS_OBJECT_BATCH_SIZE];
+    int32             status[OS_OBJECT_BATCH_SIZE];
+    int32             return_code;
+    int32             chunk_code;
+    uint32            done;
+    uint32            chunk;
+    uint32            i;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(sem_ids);
+    ARGCHECK(count > 0, OS_ERR_INVALID_SIZE);
+
+    return_code = OS_SUCCESS;
+    for (done = 0; done < count; done += chunk)
+    {
+        chunk = count - done;
+        if (chunk > OS_OBJECT_BATCH_SIZE)
+        {
+            chunk = OS_OBJECT_BATCH_SIZE;
+        }
+
+        /* Any semaphore which could not be locked is skipped, but the rest are still deleted */
+        chunk_code = OS_ObjectIdGetByIdBatch(LOCAL_OBJID_TYPE, &sem_ids[done], chunk, tokens);
+        for (i = 0; i < chunk; ++i)
+        {
+            status[i] = chunk_code;
+            if (tokens[i].lock_mode != OS_LOCK_MODE_NONE)
+            {
+                status[i] = OS_BinSemDelete_Impl(&tokens[i]);
+            }
+        }
+
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = chunk_code;
+        }
+
+        /* Complete the operation via the common routine */
+        chunk_code = OS_ObjectIdFinalizeDeleteBatch(status, tokens, chunk);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = chunk_code;
+        }
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -48,6 +48,7 @@
 #include "os-shared-idmap.h"
 #include "os-shared-module.h"
 #include "os-shared-mutex.h"
+#include "os-shared-rwlock.h"
 #include "os-shared-network.h"
 #include "os-shared-printf.h"
 #include "os-shared-queue.h"
@@ -134,6 +135,7 @@ int32 OS_API_Init(void)
     return_code = OS_ObjectIdInit();
     if (return_code != OS_SUCCESS)
     {
+        OS_SharedGlobalVars.GlobalState = OS_SHUTDOWN_MAGIC_NUMBER;
         return return_code;
     }
 
@@ -164,6 +166,9 @@ int32 OS_API_Init(void)
             case OS_OBJECT_TYPE_OS_MUTEX:
                 return_code = OS_MutexAPI_Init();
                 break;
+            case OS_OBJECT_TYPE_OS_RWLOCK:
+                return_code = OS_RwLockAPI_Init();
+                break;
             case OS_OBJECT_TYPE_OS_MODULE:
                 return_code = OS_ModuleAPI_Init();
                 break;
@@ -52,7 +52,7 @@
 #error "osconfig.h must define OS_MAX_CONDVARS to a valid value"
 #endif
 
-OS_condvar_internal_record_t OS_condvar_table[OS_MAX_CONDVARS];
+OS_condvar_internal_record_t *OS_condvar_table;
 
 /****************************************************************************************
                                   CONDITION VARIABLE API
@@ -66,9 +66,7 @@ OS_condvar_internal_record_t OS_condvar_table[OS_MAX_CONDVARS];
  *-----------------------------------------------------------------*/
 int32 OS_CondVarAPI_Init(void)
 {
-    // SAD: Using memset as sizeof(OS_condvar_table) ensures correct array size
-    memset(OS_condvar_table, 0, sizeof(OS_condvar_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_CONDVAR, OS_condvar_table);
 }
 
 /*----------------------------------------------------------------
@@ -56,7 +56,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_COUNTSEM
 };
 
-OS_count_sem_internal_record_t OS_count_sem_table[LOCAL_NUM_OBJECTS];
+OS_count_sem_internal_record_t *OS_count_sem_table;
 
 /****************************************************************************************
                                   SEMAPHORE API
@@ -70,8 +70,7 @@ OS_count_sem_internal_record_t OS_count_sem_table[LOCAL_NUM_OBJECTS];
  *-----------------------------------------------------------------*/
 int32 OS_CountSemAPI_Init(void)
 {
-    memset(OS_count_sem_table, 0, sizeof(OS_count_sem_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_count_sem_table);
 }
 
 /*----------------------------------------------------------------
@@ -195,6 +194,84 @@ int32 OS_CountSemTimedWait(osal_id_t sem_id, uint32 msecs)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemGiveN(osal_id_t sem_id, uint32 count)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    if (count == 0)
+    {
+        return OS_INVALID_SEM_VALUE;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_CountSemGiveN_Impl(&token, count);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTakeN(osal_id_t sem_id, uint32 count)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    if (count == 0)
+    {
+        return OS_INVALID_SEM_VALUE;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_CountSemTakeN_Impl(&token, count);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTimedWaitN(osal_id_t sem_id, uint32 count, uint32 msecs)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    if (count == 0)
+    {
+        return OS_INVALID_SEM_VALUE;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_CountSemTimedWaitN_Impl(&token, count, msecs);
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -58,7 +58,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_DIR
 };
 
-OS_dir_internal_record_t OS_dir_table[LOCAL_NUM_OBJECTS];
+OS_dir_internal_record_t *OS_dir_table;
 
 /****************************************************************************************
                                   DIRECTORY API
@@ -72,8 +72,7 @@ OS_dir_internal_record_t OS_dir_table[LOCAL_NUM_OBJECTS];
  *-----------------------------------------------------------------*/
 int32 OS_DirAPI_Init(void)
 {
-    memset(OS_dir_table, 0, sizeof(OS_dir_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_dir_table);
 }
 
 /*----------------------------------------------------------------
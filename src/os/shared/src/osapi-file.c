@@ -62,7 +62,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_STREAM
 };
 
-OS_stream_internal_record_t OS_stream_table[OS_MAX_NUM_OPEN_FILES];
+OS_stream_internal_record_t *OS_stream_table;
 
 /*
  * OS_cp copyblock size - in theory could be adjusted
@@ -94,8 +94,7 @@ int32 OS_FileIteratorClose(osal_id_t filedes, void *arg)
  *-----------------------------------------------------------------*/
 int32 OS_FileAPI_Init(void)
 {
-    memset(OS_stream_table, 0, sizeof(OS_stream_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_stream_table);
 }
 
 /*----------------------------------------------------------------
@@ -51,7 +51,7 @@ enum
 /*
  * Internal filesystem state table entries
  */
-OS_filesys_internal_record_t OS_filesys_table[LOCAL_NUM_OBJECTS];
+OS_filesys_internal_record_t *OS_filesys_table;
 
 /*
  * A string that should be the prefix of RAM disk volume names, which
@@ -225,11 +225,7 @@ int32 OS_FileSys_Initialize(char *address, const char *fsdevname, const char *fs
  *-----------------------------------------------------------------*/
 int32 OS_FileSysAPI_Init(void)
 {
-    int32 return_code = OS_SUCCESS;
-
-    memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
-
-    return return_code;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_filesys_table);
 }
 
 /*----------------------------------------------------------------
@@ -625,8 +621,8 @@ int32 OS_GetFsInfo(os_fsinfo_t *filesys_info)
 
     memset(filesys_info, 0, sizeof(*filesys_info));
 
-    filesys_info->MaxFds     = OS_MAX_NUM_OPEN_FILES;
-    filesys_info->MaxVolumes = OS_MAX_FILE_SYSTEMS;
+    filesys_info->MaxFds     = OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_STREAM);
+    filesys_info->MaxVolumes = OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_FILESYS);
 
     OS_ObjectIdIteratorInit(OS_FileSysFilterFree, NULL, OS_OBJECT_TYPE_OS_STREAM, &iter);
     while (OS_ObjectIdIteratorGetNext(&iter))
@@ -46,9 +46,11 @@
 /*
  * User defined include files
  */
+#include "os-shared-clock.h"
 #include "os-shared-common.h"
 #include "os-shared-idmap.h"
 #include "os-shared-task.h"
+#include "osapi-bsp.h"
 
 /*
  * A fixed nonzero value to put into the upper 8 bits
@@ -57,6 +59,18 @@
 #define OS_LOCK_KEY_FIXED_VALUE 0x4D000000
 #define OS_LOCK_KEY_INVALID     ((osal_key_t) {0})
 
+/*
+ * Reference counts are managed without the global table lock when configured
+ * to do so, but only if the compiler provides lock-free atomic operations for
+ * the sizes of the active_id and refcount fields.
+ */
+#if defined(OSAL_CONFIG_LOCKFREE_REFCOUNT) && defined(__GCC_ATOMIC_INT_LOCK_FREE) && \
+    defined(__GCC_ATOMIC_SHORT_LOCK_FREE)
+#if (__GCC_ATOMIC_INT_LOCK_FREE == 2) && (__GCC_ATOMIC_SHORT_LOCK_FREE == 2)
+#define OS_LOCKFREE_REFCOUNT
+#endif
+#endif
+
 /*
  * A structure containing the user-specified
  * details of a "foreach" iteration request
@@ -72,8 +86,8 @@ typedef struct
  * Global ID storage tables
  */
 
-/* Tables where the OS object information is stored */
-static OS_common_record_t OS_common_table[OS_MAX_TOTAL_RECORDS];
+/* Tables where the OS object information is stored (allocated from OS_object_arena) */
+static OS_common_record_t *OS_common_table;
 
 typedef struct
 {
@@ -85,24 +99,173 @@ typedef struct
 
     /* The key required to unlock this table */
     osal_key_t owner_key;
+
+    /* Position of this type within the common table, and the number of records it has */
+    uint32 base_idx;
+    uint32 max_count;
+
+    /* Position of the first entry, and number of entries, in the free record queue */
+    uint32 free_head;
+    uint32 free_count;
+
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+    /* Contention statistics for the table lock, and the time it was last acquired */
+    OS_lock_stats_t lock_stats;
+    OS_time_t       lock_time;
+#endif
 } OS_objtype_state_t;
 
 OS_objtype_state_t OS_objtype_state[OS_OBJECT_TYPE_USER];
 
-OS_common_record_t *const OS_global_task_table      = &OS_common_table[OS_TASK_BASE];
-OS_common_record_t *const OS_global_queue_table     = &OS_common_table[OS_QUEUE_BASE];
-OS_common_record_t *const OS_global_bin_sem_table   = &OS_common_table[OS_BINSEM_BASE];
-OS_common_record_t *const OS_global_count_sem_table = &OS_common_table[OS_COUNTSEM_BASE];
-OS_common_record_t *const OS_global_mutex_table     = &OS_common_table[OS_MUTEX_BASE];
-OS_common_record_t *const OS_global_rwlock_table    = &OS_common_table[OS_RWLOCK_BASE];
-OS_common_record_t *const OS_global_stream_table    = &OS_common_table[OS_STREAM_BASE];
-OS_common_record_t *const OS_global_dir_table       = &OS_common_table[OS_DIR_BASE];
-OS_common_record_t *const OS_global_timebase_table  = &OS_common_table[OS_TIMEBASE_BASE];
-OS_common_record_t *const OS_global_timecb_table    = &OS_common_table[OS_TIMECB_BASE];
-OS_common_record_t *const OS_global_module_table    = &OS_common_table[OS_MODULE_BASE];
-OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESYS_BASE];
-OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
-OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVAR_BASE];
+/*
+ * Name lookup index
+ *
+ * Object names are hashed into per-type buckets so that a lookup by name
+ * only needs to visit the records sharing the same bucket, rather than
+ * every record of that type.  Each type has as many buckets as it has
+ * records, and the buckets for a type occupy the same range of indices
+ * as the records themselves do within OS_common_table.
+ *
+ * All values stored here are a local (per-type) index + 1, such that
+ * zero represents an empty bucket or the end of a chain.
+ */
+typedef struct
+{
+    osal_index_t next;   /* next record in the same bucket */
+    osal_index_t bucket; /* the bucket this record is linked into */
+} OS_name_index_link_t;
+
+static osal_index_t *        OS_name_index_head;
+static OS_name_index_link_t *OS_name_index_link;
+
+/*
+ * Free record queue
+ *
+ * Each object type has a circular FIFO of the local indices of its free
+ * records, occupying the same range of indices as the records themselves
+ * within OS_common_table.  Records are appended when they are returned
+ * to the pool, so the least recently used record is always issued next.
+ */
+static osal_index_t *OS_free_index_queue;
+
+/*
+ * Object table arena
+ *
+ * The common records, name index and free record queue of every object type
+ * are all carved from this single block by OS_ObjectIdInit(), according to the
+ * number of objects of each type configured at startup.  The records in use are
+ * therefore contiguous, and the block is allocated at startup to the size which
+ * the configuration requires.  The per-type tables of the shared and
+ * implementation layers are likewise sized by OS_ObjectIdTableAlloc().
+ */
+#define OS_OBJECT_ARENA_RECORD_SIZE \
+    (sizeof(OS_common_record_t) + sizeof(OS_name_index_link_t) + sizeof(osal_index_t) + sizeof(osal_index_t))
+
+/*
+ * When the records are cache aligned, the block includes an extra cache line
+ * so the first record can be placed on a line boundary.  Records are then
+ * padded to whole lines, so no two records (or object types) share a line.
+ */
+#ifdef OSAL_CONFIG_CACHE_ALIGNED_OBJECTS
+#define OS_OBJECT_ARENA_ALIGN_SIZE OS_CACHE_LINE_SIZE
+CompileTimeAssert((OS_CACHE_LINE_SIZE & (OS_CACHE_LINE_SIZE - 1)) == 0, CacheLineSizeNotPowerOfTwo);
+CompileTimeAssert((sizeof(OS_common_record_t) % OS_CACHE_LINE_SIZE) == 0, CommonRecordNotCacheAligned);
+#else
+#define OS_OBJECT_ARENA_ALIGN_SIZE 0
+#endif
+
+static void *OS_object_arena;
+
+OS_common_record_t *OS_global_task_table;
+OS_common_record_t *OS_global_queue_table;
+OS_common_record_t *OS_global_bin_sem_table;
+OS_common_record_t *OS_global_count_sem_table;
+OS_common_record_t *OS_global_mutex_table;
+OS_common_record_t *OS_global_rwlock_table;
+OS_common_record_t *OS_global_stream_table;
+OS_common_record_t *OS_global_dir_table;
+OS_common_record_t *OS_global_timebase_table;
+OS_common_record_t *OS_global_timecb_table;
+OS_common_record_t *OS_global_module_table;
+OS_common_record_t *OS_global_filesys_table;
+OS_common_record_t *OS_global_console_table;
+OS_common_record_t *OS_global_condvar_table;
+
+/*
+ * Accessors for the active_id and refcount fields of a record
+ *
+ * When lock-free reference counting is in use, these fields are also accessed
+ * by tasks which do not hold the global table lock, so all modifications must
+ * be atomic.  Sequential consistency is required because an EXCLUSIVE lock
+ * stores the ID and then reads the refcount, whereas a REFCOUNT lock modifies
+ * the refcount and then reads the ID: each side must observe the other.
+ */
+#ifdef OS_LOCKFREE_REFCOUNT
+
+static inline osal_id_t OS_RecordGetActiveId(const OS_common_record_t *record)
+{
+    osal_id_t id;
+
+    __atomic_load(&record->active_id, &id, __ATOMIC_SEQ_CST);
+    return id;
+}
+
+static inline void OS_RecordSetActiveId(OS_common_record_t *record, osal_id_t id)
+{
+    __atomic_store(&record->active_id, &id, __ATOMIC_SEQ_CST);
+}
+
+static inline uint16 OS_RecordGetRefcount(const OS_common_record_t *record)
+{
+    return __atomic_load_n(&record->refcount, __ATOMIC_SEQ_CST);
+}
+
+static inline uint16 OS_RecordIncrRefcount(OS_common_record_t *record)
+{
+    return __atomic_add_fetch(&record->refcount, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline uint16 OS_RecordDecrRefcount(OS_common_record_t *record)
+{
+    return __atomic_sub_fetch(&record->refcount, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline osal_id_t OS_RecordGetCreator(const OS_common_record_t *record)
+{
+    osal_id_t id;
+
+    __atomic_load(&record->creator, &id, __ATOMIC_SEQ_CST);
+    return id;
+}
+
+#else
+
+static inline osal_id_t OS_RecordGetActiveId(const OS_common_record_t *record)
+{
+    return record->active_id;
+}
+
+static inline void OS_RecordSetActiveId(OS_common_record_t *record, osal_id_t id)
+{
+    record->active_id = id;
+}
+
+static inline uint16 OS_RecordGetRefcount(const OS_common_record_t *record)
+{
+    return record->refcount;
+}
+
+static inline uint16 OS_RecordIncrRefcount(OS_common_record_t *record)
+{
+    return ++record->refcount;
+}
+
+static inline uint16 OS_RecordDecrRefcount(OS_common_record_t *record)
+{
+    return --record->refcount;
+}
+
+#endif
 
 /*
  *********************************************************************************
@@ -118,17 +281,149 @@ OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVA
  *-----------------------------------------------------------------*/
 int32 OS_ObjectIdInit(void)
 {
-    memset(OS_common_table, 0, sizeof(OS_common_table));
+    osal_objtype_t idtype;
+    uint32         base_id;
+    uint32         max_id;
+    uint32         total;
+    uint32         i;
+    size_t         arena_size;
+
     memset(OS_objtype_state, 0, sizeof(OS_objtype_state));
+
+    /*
+     * Determine the number of records of each type, which may be set
+     * by the BSP at startup, and lay the types out consecutively.
+     */
+    total = 0;
+    for (idtype = 0; idtype < OS_OBJECT_TYPE_USER; ++idtype)
+    {
+        max_id = OS_BSP_GetResourceTypeLimit(idtype);
+        if (max_id == 0)
+        {
+            max_id = OS_GetDefaultMaxForObjectType(idtype);
+        }
+        else if (max_id > OS_GetHighestMaxForObjectType(idtype))
+        {
+            OS_DEBUG("Limit of %lu for object type %u exceeds highest limit of %lu\n", (unsigned long)max_id,
+                     (unsigned int)idtype, (unsigned long)OS_GetHighestMaxForObjectType(idtype));
+            max_id = OS_GetHighestMaxForObjectType(idtype);
+        }
+
+        OS_objtype_state[idtype].base_idx  = total;
+        OS_objtype_state[idtype].max_count = max_id;
+        total += max_id;
+    }
+
+    /*
+     * Allocate the arena for this configuration, replacing any arena
+     * left from a previous initialization.
+     */
+    if (OS_object_arena != NULL)
+    {
+        free(OS_object_arena);
+    }
+
+    arena_size      = (total * OS_OBJECT_ARENA_RECORD_SIZE) + OS_OBJECT_ARENA_ALIGN_SIZE;
+    OS_object_arena = malloc(arena_size);
+    if (OS_object_arena == NULL)
+    {
+        OS_DEBUG("Unable to allocate %lu bytes for the object tables\n", (unsigned long)arena_size);
+        memset(OS_objtype_state, 0, sizeof(OS_objtype_state));
+        OS_common_table = NULL;
+        return OS_ERROR;
+    }
+
+    memset(OS_object_arena, 0, arena_size);
+
+#ifdef OSAL_CONFIG_CACHE_ALIGNED_OBJECTS
+    OS_common_table = (OS_common_record_t *)(((cpuaddr)OS_object_arena + OS_CACHE_LINE_SIZE - 1) &
+                                             ~(cpuaddr)(OS_CACHE_LINE_SIZE - 1));
+#else
+    OS_common_table = OS_object_arena;
+#endif
+
+    OS_name_index_link  = (OS_name_index_link_t *)&OS_common_table[total];
+    OS_name_index_head  = (osal_index_t *)&OS_name_index_link[total];
+    OS_free_index_queue = &OS_name_index_head[total];
+
+    OS_global_task_table      = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_TASK)];
+    OS_global_queue_table     = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_QUEUE)];
+    OS_global_bin_sem_table   = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_BINSEM)];
+    OS_global_count_sem_table = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_COUNTSEM)];
+    OS_global_mutex_table     = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_MUTEX)];
+    OS_global_rwlock_table    = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_RWLOCK)];
+    OS_global_stream_table    = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_STREAM)];
+    OS_global_dir_table       = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_DIR)];
+    OS_global_timebase_table  = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_TIMEBASE)];
+    OS_global_timecb_table    = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_TIMECB)];
+    OS_global_module_table    = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_MODULE)];
+    OS_global_filesys_table   = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_FILESYS)];
+    OS_global_console_table   = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_CONSOLE)];
+    OS_global_condvar_table   = &OS_common_table[OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_CONDVAR)];
+
+    /*
+     * All records start out free.  They are queued such that the
+     * first ID issued is serial number 1, following on from the
+     * (zero) initial value of last_id_issued.
+     */
+    for (idtype = 0; idtype < OS_OBJECT_TYPE_USER; ++idtype)
+    {
+        base_id = OS_GetBaseForObjectType(idtype);
+        max_id  = OS_GetMaxForObjectType(idtype);
+
+        for (i = 0; i < max_id; ++i)
+        {
+            OS_free_index_queue[base_id + i] = OSAL_INDEX_C((i + 1) % max_id);
+        }
+
+        OS_objtype_state[idtype].free_count = max_id;
+    }
+
     return OS_SUCCESS;
 }
 
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
+ *           Allocates a per-type table of a layer, with one record
+ *           for each object of the type configured at startup.
  *
  *-----------------------------------------------------------------*/
-uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
+int32 OS_ObjectIdTableAlloc(osal_objtype_t idtype, size_t record_size, void **table)
+{
+    size_t table_size;
+
+    if (*table != NULL)
+    {
+        free(*table);
+        *table = NULL;
+    }
+
+    table_size = record_size * OS_GetMaxForObjectType(idtype);
+    if (table_size == 0)
+    {
+        return OS_SUCCESS;
+    }
+
+    *table = malloc(table_size);
+    if (*table == NULL)
+    {
+        OS_DEBUG("Unable to allocate %lu bytes for object type %u\n", (unsigned long)table_size,
+                 (unsigned int)idtype);
+        return OS_ERROR;
+    }
+
+    memset(*table, 0, table_size);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_GetDefaultMaxForObjectType(osal_objtype_t idtype)
 {
     switch (idtype)
     {
@@ -170,41 +465,52 @@ uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
  *  Purpose: Local helper routine, not part of OSAL API.
  *
  *-----------------------------------------------------------------*/
-uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
+uint32 OS_GetHighestMaxForObjectType(osal_objtype_t idtype)
 {
     switch (idtype)
     {
-        case OS_OBJECT_TYPE_OS_TASK:
-            return OS_TASK_BASE;
         case OS_OBJECT_TYPE_OS_QUEUE:
-            return OS_QUEUE_BASE;
-        case OS_OBJECT_TYPE_OS_BINSEM:
-            return OS_BINSEM_BASE;
-        case OS_OBJECT_TYPE_OS_COUNTSEM:
-            return OS_COUNTSEM_BASE;
-        case OS_OBJECT_TYPE_OS_MUTEX:
-            return OS_MUTEX_BASE;
-        case OS_OBJECT_TYPE_OS_RWLOCK:
-            return OS_RWLOCK_BASE;
         case OS_OBJECT_TYPE_OS_STREAM:
-            return OS_STREAM_BASE;
-        case OS_OBJECT_TYPE_OS_DIR:
-            return OS_DIR_BASE;
-        case OS_OBJECT_TYPE_OS_TIMEBASE:
-            return OS_TIMEBASE_BASE;
-        case OS_OBJECT_TYPE_OS_TIMECB:
-            return OS_TIMECB_BASE;
-        case OS_OBJECT_TYPE_OS_MODULE:
-            return OS_MODULE_BASE;
-        case OS_OBJECT_TYPE_OS_FILESYS:
-            return OS_FILESYS_BASE;
-        case OS_OBJECT_TYPE_OS_CONSOLE:
-            return OS_CONSOLE_BASE;
-        case OS_OBJECT_TYPE_OS_CONDVAR:
-            return OS_CONDVAR_BASE;
+            /* these are also members of an OS_FdSet, which is sized at compile time */
+            return OS_GetDefaultMaxForObjectType(idtype);
         default:
-            return 0;
+            if (OS_GetDefaultMaxForObjectType(idtype) == 0)
+            {
+                /* the type is not supported by this build */
+                return 0;
+            }
+            return OS_OBJECT_INDEX_MASK;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
+{
+    if (idtype >= OS_OBJECT_TYPE_USER)
+    {
+        return 0;
+    }
+
+    return OS_objtype_state[idtype].max_count;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
+{
+    if (idtype >= OS_OBJECT_TYPE_USER)
+    {
+        return 0;
     }
+
+    return OS_objtype_state[idtype].base_idx;
 }
 
 /**************************************************************
@@ -276,6 +582,152 @@ bool OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_comm
     return (obj->name_entry != NULL && strcmp((const char *)ref, obj->name_entry) == 0);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Computes the hash value of an object name, for use with
+ *           the name lookup index (32-bit FNV-1a).
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_ObjectNameHash(const char *name)
+{
+    uint32 hash = 2166136261U;
+
+    while (*name != 0)
+    {
+        hash ^= (uint8)*name;
+        hash *= 16777619U;
+        ++name;
+    }
+
+    return hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Unlinks the record referred to by the token from the name index.
+ *           This is a no-op if the record is not currently indexed.
+ *
+ *           The appropriate global table lock must be held prior to calling this.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ObjectIdNameIndexRemove(const OS_object_token_t *token)
+{
+    uint32                base_idx;
+    osal_index_t *        link;
+    OS_name_index_link_t *entry;
+
+    base_idx = OS_GetBaseForObjectType(token->obj_type);
+    entry    = &OS_name_index_link[base_idx + token->obj_idx];
+
+    if (entry->bucket != 0)
+    {
+        /* find the reference to this record within the bucket chain and skip over it */
+        link = &OS_name_index_head[base_idx + entry->bucket - 1];
+        while (*link != 0)
+        {
+            if (*link == (token->obj_idx + 1))
+            {
+                *link = entry->next;
+                break;
+            }
+
+            link = &OS_name_index_link[base_idx + *link - 1].next;
+        }
+
+        entry->next   = 0;
+        entry->bucket = 0;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Links the record referred to by the token into the name index,
+ *           using the given name as the key.
+ *
+ *           The appropriate global table lock must be held prior to calling this.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name)
+{
+    uint32                base_idx;
+    uint32                bucket;
+    OS_name_index_link_t *entry;
+
+    /* A record may only be linked into a single bucket */
+    OS_ObjectIdNameIndexRemove(token);
+
+    base_idx = OS_GetBaseForObjectType(token->obj_type);
+    bucket   = OS_ObjectNameHash(name) % OS_GetMaxForObjectType(token->obj_type);
+    entry    = &OS_name_index_link[base_idx + token->obj_idx];
+
+    entry->next                           = OS_name_index_head[base_idx + bucket];
+    entry->bucket                         = OSAL_INDEX_C(bucket + 1);
+    OS_name_index_head[base_idx + bucket] = OSAL_INDEX_C(token->obj_idx + 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Locate an existing object of the token type with the given name.
+ *           On success the token index and ID are set to the matching record.
+ *
+ *           Objects which are allocated without a name and named later (streams
+ *           and directories) are not indexed, so these types fall back to a
+ *           search of the entire table.
+ *
+ *           The appropriate global table lock must be held prior to calling this.
+ *
+ *  returns: OS_ERR_NAME_NOT_FOUND if not found, OS_SUCCESS if match is found
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token)
+{
+    int32               return_code;
+    uint32              base_idx;
+    uint32              max_id;
+    osal_index_t        next;
+    OS_common_record_t *record;
+
+    if (token->obj_type == OS_OBJECT_TYPE_OS_STREAM || token->obj_type == OS_OBJECT_TYPE_OS_DIR)
+    {
+        return OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
+    }
+
+    return_code   = OS_ERR_NAME_NOT_FOUND;
+    base_idx      = OS_GetBaseForObjectType(token->obj_type);
+    max_id        = OS_GetMaxForObjectType(token->obj_type);
+    token->obj_id = OS_OBJECT_ID_UNDEFINED;
+
+    if (max_id == 0)
+    {
+        next = 0;
+    }
+    else
+    {
+        next = OS_name_index_head[base_idx + (OS_ObjectNameHash(name) % max_id)];
+    }
+
+    while (next != 0)
+    {
+        token->obj_idx = OSAL_INDEX_C(next - 1);
+        record         = &OS_common_table[base_idx + token->obj_idx];
+
+        if (OS_ObjectIdDefined(record->active_id) && OS_ObjectNameMatch((void *)name, token, record))
+        {
+            return_code   = OS_SUCCESS;
+            token->obj_id = record->active_id;
+            break;
+        }
+
+        next = OS_name_index_link[base_idx + token->obj_idx].next;
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -351,8 +803,19 @@ void OS_ObjectIdTransactionCancel(OS_object_token_t *token)
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
  *
- *   Selectively convert the existing lock on a given resource, depending on the lock mode.
+ *-----------------------------------------------------------------*/
+int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
+{
+    return OS_ObjectIdConvertTokenTimed(token, OS_OBJECT_LOCK_TIMEOUT);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *   Selectively convert the existing lock on a given resource, depending on the lock mode.
  *
  *   For any lock_mode other than OS_LOCK_MODE_NONE, the global table lock **must**
  *   already be held prior to entering this function.  This function may or may
@@ -375,7 +838,9 @@ void OS_ObjectIdTransactionCancel(OS_object_token_t *token)
  *
  *   For EXCLUSIVE and REFCOUNT style locks, if the state is not appropriate,
  *   this may unlock the global table and re-lock it several times
- *   while waiting for the state to change.
+ *   while waiting for the state to change.  The total time spent waiting is
+ *   limited by the timeout, which is specified in milliseconds and may be
+ *   OS_PEND to wait indefinitely or OS_CHECK to not wait at all.
  *
  *   Returns: OS_SUCCESS if operation was successful,
  *            or suitable error code if operation was not successful.
@@ -384,10 +849,13 @@ void OS_ObjectIdTransactionCancel(OS_object_token_t *token)
  *         all lock modes other than OS_LOCK_MODE_NONE.
  *
  *-----------------------------------------------------------------*/
-int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
+int32 OS_ObjectIdConvertTokenTimed(OS_object_token_t *token, int32 timeout)
 {
     int32               return_code = OS_ERROR;
-    uint32              attempts    = 0;
+    int32               wait_msec;
+    bool                have_deadline = false;
+    OS_time_t           deadline      = OS_TIME_ZERO;
+    OS_time_t           now           = OS_TIME_ZERO;
     OS_common_record_t *obj;
     osal_id_t           expected_id;
 
@@ -433,15 +901,15 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                  */
                 if (!OS_ObjectIdEqual(expected_id, OS_OBJECT_ID_RESERVED))
                 {
-                    expected_id    = OS_OBJECT_ID_RESERVED;
-                    obj->active_id = expected_id;
+                    expected_id = OS_OBJECT_ID_RESERVED;
+                    OS_RecordSetActiveId(obj, expected_id);
                 }
 
                 /*
                  * Also confirm that reference count is zero
                  * If not zero, will need to wait for other tasks to release.
                  */
-                if (obj->refcount == 0)
+                if (OS_RecordGetRefcount(obj) == 0)
                 {
                     return_code = OS_SUCCESS;
                     break;
@@ -469,19 +937,48 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
          *  b) the refcount is too high - need to wait for release
          *
          * In this case we will UNLOCK the global object again so that the holder
-         * can relinquish it.  We'll try again a few times before giving up hope.
+         * can relinquish it, and keep trying until the timeout expires.
+         *
+         * The deadline is only computed once contention is actually seen, so
+         * the uncontended path never needs to read the clock.  It is based on
+         * the monotonic clock, so it is not affected by changes to the local time.
          */
-        ++attempts;
-        if (attempts >= 5)
+        if (timeout < 0)
         {
-            return_code = OS_ERR_OBJECT_IN_USE;
-            break;
+            wait_msec = OS_PEND;
+        }
+        else
+        {
+            OS_GetMonotonicTime_Impl(&now);
+            if (!have_deadline)
+            {
+                deadline      = OS_TimeAdd(now, OS_TimeFromTotalMilliseconds(timeout));
+                have_deadline = true;
+            }
+
+            wait_msec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(deadline, now));
+            if (wait_msec <= 0)
+            {
+                return_code = OS_ERR_OBJECT_IN_USE;
+                break;
+            }
         }
 
         /*
          * Call the impl layer to wait for some sort of change to occur.
+         *
+         * If the ID still matches, then this task has reserved the object for an
+         * EXCLUSIVE lock and only needs to know when the remaining references
+         * are released.  Otherwise wait for the other task to finish with it.
          */
-        OS_WaitForStateChange(token, attempts);
+        if (OS_ObjectIdEqual(obj->active_id, expected_id))
+        {
+            OS_WaitForHandoff(token, wait_msec);
+        }
+        else
+        {
+            OS_WaitForStateChange(token, wait_msec);
+        }
     }
 
     /*
@@ -496,7 +993,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
         {
             /* always increment the refcount, which means a task is actively
              * using or modifying this record. */
-            ++obj->refcount;
+            OS_RecordIncrRefcount(obj);
 
             /*
              * On a successful operation, the global is unlocked if it is
@@ -521,7 +1018,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
              * it back to the original value which is in the token.
              * (note it had to match initially before overwrite)
              */
-            obj->active_id = OS_ObjectIdFromToken(token);
+            OS_RecordSetActiveId(obj, OS_ObjectIdFromToken(token));
         }
     }
 
@@ -578,8 +1075,9 @@ int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_obj
  *
  *  Purpose: Local helper routine, not part of OSAL API.
  *           Find the next available Object ID of the given type
- *           Searches the global name/id table for an open entry of the given type.
- *           The search will start at the location of the last-issued ID.
+ *           The record is taken from the head of the free record queue for the type,
+ *           and the serial number advances from the last-issued ID to the next value
+ *           that corresponds to that record.
  *
  *           Note: This is an internal helper function and no locking is performed.
  *           The appropriate global table lock must be held prior to calling this.
@@ -595,10 +1093,9 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
     uint32              base_id;
     uint32              local_id = 0;
     uint32              serial;
-    uint32              i;
     int32               return_code;
-    OS_common_record_t *obj = NULL;
-    OS_objtype_state_t *objtype_state;
+    OS_common_record_t *obj           = NULL;
+    OS_objtype_state_t *objtype_state = NULL;
 
     base_id = OS_GetBaseForObjectType(token->obj_type);
     max_id  = OS_GetMaxForObjectType(token->obj_type);
@@ -610,41 +1107,58 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
          * Return the "not implemented" to differentiate between
          * this case vs. running out of valid slots  */
         return_code = OS_ERR_NOT_IMPLEMENTED;
-        serial      = 0;
     }
     else
     {
         return_code   = OS_ERR_NO_FREE_IDS;
         objtype_state = &OS_objtype_state[token->obj_type];
-        serial        = OS_ObjectIdToSerialNumber_Impl(objtype_state->last_id_issued);
+
+        /*
+         * Take the entry at the head of the free queue.  As a safeguard,
+         * any queued entry that is actually in use is discarded, it will
+         * be queued again when it is freed.
+         */
+        while (objtype_state->free_count > 0)
+        {
+            local_id                 = OS_free_index_queue[base_id + objtype_state->free_head];
+            objtype_state->free_head = (objtype_state->free_head + 1) % max_id;
+            --objtype_state->free_count;
+
+            obj = &OS_common_table[local_id + base_id];
+            if (!OS_ObjectIdDefined(obj->active_id))
+            {
+                return_code = OS_SUCCESS;
+                break;
+            }
+        }
     }
 
-    for (i = 0; i < max_id; ++i)
+    if (return_code == OS_SUCCESS)
     {
-        local_id = (++serial) % max_id;
+        /*
+         * Advance the serial number to the next value which maps to this entry,
+         * so that IDs are not re-issued until the serial number wraps around.
+         */
+        serial = OS_ObjectIdToSerialNumber_Impl(objtype_state->last_id_issued);
+        serial += ((local_id + max_id - (serial % max_id) - 1) % max_id) + 1;
         if (serial >= OS_OBJECT_INDEX_MASK)
         {
             /* reset to beginning of ID space */
             serial = local_id;
         }
-        obj = &OS_common_table[local_id + base_id];
-        if (!OS_ObjectIdDefined(obj->active_id))
-        {
-            return_code = OS_SUCCESS;
-            break;
-        }
-    }
 
-    if (return_code == OS_SUCCESS)
-    {
         token->obj_idx = OSAL_INDEX_C(local_id);
         OS_ObjectIdCompose_Impl(token->obj_type, serial, &token->obj_id);
 
-        /* Ensure any data in the record has been cleared */
-        obj->active_id  = token->obj_id;
+        /*
+         * Ensure any data in the record has been cleared.  Note the refcount
+         * of a free record is always zero, and it is not written here as it may
+         * be transiently modified by a REFCOUNT lock attempt using a stale ID
+         * (see OS_ObjectIdRefcountTryAcquire).
+         */
         obj->name_entry = NULL;
         obj->creator    = OS_TaskGetId();
-        obj->refcount   = 0;
+        OS_RecordSetActiveId(obj, token->obj_id);
 
         /* preemptively update the last id issued */
         objtype_state->last_id_issued = token->obj_id;
@@ -659,6 +1173,113 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Appends the record referred to by the token to the free record
+ *           queue for its type, making it available for re-use.
+ *
+ *           The appropriate global table lock must be held prior to calling this.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ObjectIdFreeQueueAppend(const OS_object_token_t *token)
+{
+    uint32              max_id;
+    uint32              base_id;
+    OS_objtype_state_t *objtype_state;
+
+    base_id       = OS_GetBaseForObjectType(token->obj_type);
+    max_id        = OS_GetMaxForObjectType(token->obj_type);
+    objtype_state = &OS_objtype_state[token->obj_type];
+
+    /* the queue can never legitimately be full when an entry is freed */
+    if (objtype_state->free_count < max_id)
+    {
+        OS_free_index_queue[base_id + ((objtype_state->free_head + objtype_state->free_count) % max_id)] =
+            token->obj_idx;
+        ++objtype_state->free_count;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Attempts to obtain a REFCOUNT lock on the given object ID without
+ *           locking the global table.
+ *
+ *           The refcount is incremented before the ID is checked.  A task taking
+ *           an EXCLUSIVE lock sets the ID to OS_OBJECT_ID_RESERVED before it checks
+ *           the refcount, so it will either see this reference and wait for it to
+ *           be released, or this will see the changed ID and back out.
+ *
+ *  returns: true if the token now holds a REFCOUNT lock on the object, false
+ *           if the lock must be obtained through the global table instead.
+ *
+ *-----------------------------------------------------------------*/
+bool OS_ObjectIdRefcountTryAcquire(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token)
+{
+#ifdef OS_LOCKFREE_REFCOUNT
+    OS_common_record_t *record;
+
+    if (!OS_ObjectIdIsValid(id) || OS_ObjectIdTransactionInit(OS_LOCK_MODE_NONE, idtype, token) != OS_SUCCESS ||
+        OS_ObjectIdToArrayIndex(idtype, id, &token->obj_idx) != OS_SUCCESS)
+    {
+        return false;
+    }
+
+    token->lock_mode = OS_LOCK_MODE_REFCOUNT;
+    token->obj_id    = id;
+    record           = OS_ObjectIdGlobalFromToken(token);
+
+    OS_RecordIncrRefcount(record);
+
+    if (!OS_ObjectIdEqual(OS_RecordGetActiveId(record), id))
+    {
+        /* stale ID, or the object is being created/deleted - undo the increment */
+        OS_ObjectIdRefcountRelease(token);
+        token->lock_mode = OS_LOCK_MODE_NONE;
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Releases a REFCOUNT lock without locking the global table.
+ *
+ *           If this drops the last reference while another task is waiting for an
+ *           EXCLUSIVE lock, the global table is briefly locked in order to wake
+ *           the waiting task.
+ *
+ *  returns: true if the reference was released, false if it must be released
+ *           through the global table instead.
+ *
+ *-----------------------------------------------------------------*/
+bool OS_ObjectIdRefcountRelease(OS_object_token_t *token)
+{
+#ifdef OS_LOCKFREE_REFCOUNT
+    OS_common_record_t *record;
+
+    record = OS_ObjectIdGlobalFromToken(token);
+
+    if (OS_RecordDecrRefcount(record) == 0 && OS_ObjectIdEqual(OS_RecordGetActiveId(record), OS_OBJECT_ID_RESERVED))
+    {
+        OS_Lock_Global(token);
+        OS_SignalHandoff_Impl(token->obj_type);
+        OS_Unlock_Global(token);
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
 /*
  *********************************************************************************
  *          OSAL INTERNAL FUNCTIONS
@@ -668,6 +1289,56 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
  *********************************************************************************
  */
 
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Records an acquisition of the table lock, which was requested
+ *           at "request_time".  Must be called with the table locked.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_LockStatsAcquire(OS_objtype_state_t *objtype, OS_time_t request_time, bool contended)
+{
+    OS_time_t wait_time;
+
+    OS_GetMonotonicTime_Impl(&objtype->lock_time);
+    wait_time = OS_TimeSubtract(objtype->lock_time, request_time);
+
+    ++objtype->lock_stats.acquisitions;
+    if (contended)
+    {
+        ++objtype->lock_stats.contended_acquisitions;
+    }
+
+    objtype->lock_stats.total_wait_time = OS_TimeAdd(objtype->lock_stats.total_wait_time, wait_time);
+    if (OS_TimeCompare(wait_time, objtype->lock_stats.max_wait_time) > 0)
+    {
+        objtype->lock_stats.max_wait_time = wait_time;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Records the time the table lock was held, just prior to
+ *           releasing it.  Must be called with the table locked.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_LockStatsRelease(OS_objtype_state_t *objtype)
+{
+    OS_time_t hold_time;
+
+    OS_GetMonotonicTime_Impl(&hold_time);
+    hold_time = OS_TimeSubtract(hold_time, objtype->lock_time);
+
+    objtype->lock_stats.total_hold_time = OS_TimeAdd(objtype->lock_stats.total_hold_time, hold_time);
+    if (OS_TimeCompare(hold_time, objtype->lock_stats.max_hold_time) > 0)
+    {
+        objtype->lock_stats.max_hold_time = hold_time;
+    }
+}
+#endif
+
 /*----------------------------------------------------------------
 
     Purpose: Locks the global table identified by "idtype"
@@ -676,14 +1347,32 @@ void OS_Lock_Global(OS_object_token_t *token)
 {
     osal_id_t           self_task_id;
     OS_objtype_state_t *objtype;
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+    OS_time_t request_time;
+    bool      contended;
+#endif
 
     if (token->obj_type < OS_OBJECT_TYPE_USER && token->lock_mode != OS_LOCK_MODE_NONE)
     {
         objtype      = &OS_objtype_state[token->obj_type];
         self_task_id = OS_TaskGetId_Impl();
 
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+        /*
+         * The owner key is only sampled here, without holding the lock, so this
+         * is a hint rather than an exact indication of contention.
+         */
+        contended    = (objtype->owner_key.key_value != 0);
+        request_time = OS_TIME_ZERO;
+        OS_GetMonotonicTime_Impl(&request_time);
+#endif
+
         OS_Lock_Global_Impl(token->obj_type);
 
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+        OS_LockStatsAcquire(objtype, request_time, contended);
+#endif
+
         /*
          * Track ownership of this table.  It should only be owned by one
          * task at a time, and this aids in recovery if the owning task is
@@ -764,6 +1453,10 @@ void OS_Unlock_Global(OS_object_token_t *token)
         objtype->owner_key = OS_LOCK_KEY_INVALID;
         token->lock_key    = OS_LOCK_KEY_INVALID;
 
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+        OS_LockStatsRelease(objtype);
+#endif
+
         OS_Unlock_Global_Impl(token->obj_type);
     }
     else
@@ -782,7 +1475,7 @@ void OS_Unlock_Global(OS_object_token_t *token)
  *  The "OS_WaitForStateChange_Impl" function should unlock + relock
  *
  *-----------------------------------------------------------------*/
-void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts)
+void OS_WaitForStateChange(OS_object_token_t *token, int32 timeout)
 {
     osal_key_t          saved_unlock_key;
     OS_objtype_state_t *objtype;
@@ -800,12 +1493,21 @@ void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts)
     /* temporarily release the table */
     objtype->owner_key = OS_LOCK_KEY_INVALID;
 
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+    /* the time spent waiting does not count as holding the lock */
+    OS_LockStatsRelease(objtype);
+#endif
+
     /*
      * The implementation layer takes care of the actual unlock + wait.
      * This permits use of condition variables where these two actions
      * are done atomically.
      */
-    OS_WaitForStateChange_Impl(token->obj_type, attempts);
+    OS_WaitForStateChange_Impl(token->obj_type, timeout);
+
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+    OS_GetMonotonicTime_Impl(&objtype->lock_time);
+#endif
 
     /*
      * After return, this task owns the table again
@@ -814,6 +1516,42 @@ void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts)
     objtype->owner_key = saved_unlock_key;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *  Waits for the other references to the object in "token" to be released
+ *
+ *  NOTE: this must be called while the table is _LOCKED_
+ *  The "OS_WaitForHandoff_Impl" function should unlock + relock
+ *
+ *-----------------------------------------------------------------*/
+void OS_WaitForHandoff(OS_object_token_t *token, int32 timeout)
+{
+    osal_key_t          saved_unlock_key;
+    OS_objtype_state_t *objtype;
+
+    /*
+     * As in OS_WaitForStateChange(), the key is temporarily
+     * cleared while the table is released.
+     */
+    objtype            = &OS_objtype_state[token->obj_type];
+    saved_unlock_key   = objtype->owner_key;
+    objtype->owner_key = OS_LOCK_KEY_INVALID;
+
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+    OS_LockStatsRelease(objtype);
+#endif
+
+    OS_WaitForHandoff_Impl(token->obj_type, timeout);
+
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+    OS_GetMonotonicTime_Impl(&objtype->lock_time);
+#endif
+
+    /* cppcheck-suppress redundantAssignment */
+    objtype->owner_key = saved_unlock_key;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -952,7 +1690,27 @@ int32 OS_ObjectIdGetBySearch(OS_lock_mode_t lock_mode, osal_objtype_t idtype, OS
  *-----------------------------------------------------------------*/
 int32 OS_ObjectIdGetByName(OS_lock_mode_t lock_mode, osal_objtype_t idtype, const char *name, OS_object_token_t *token)
 {
-    return OS_ObjectIdGetBySearch(lock_mode, idtype, OS_ObjectNameMatch, (void *)name, token);
+    int32 return_code;
+
+    OS_ObjectIdTransactionInit(lock_mode, idtype, token);
+
+    return_code = OS_ObjectIdFindNameMatch(name, token);
+
+    if (return_code == OS_SUCCESS)
+    {
+        /*
+         * The "ConvertToken" routine will return with the global lock
+         * in a state appropriate for returning to the caller, as indicated
+         * by the "lock_mode" parameter.
+         */
+        return_code = OS_ObjectIdConvertToken(token);
+    }
+    else
+    {
+        OS_ObjectIdTransactionCancel(token);
+    }
+
+    return return_code;
 }
 
 /*----------------------------------------------------------------
@@ -1006,6 +1764,16 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
 {
     int32 return_code;
 
+    /*
+     * A REFCOUNT lock can normally be obtained without the global table lock.
+     * This only fails if the ID is not valid or the object is being created or
+     * deleted, in which case the locked path below handles it as usual.
+     */
+    if (lock_mode == OS_LOCK_MODE_REFCOUNT && OS_ObjectIdRefcountTryAcquire(idtype, id, token))
+    {
+        return OS_SUCCESS;
+    }
+
     return_code = OS_ObjectIdTransactionInit(lock_mode, idtype, token);
     if (return_code != OS_SUCCESS)
     {
@@ -1036,6 +1804,61 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Releases the record referred to by a token, and updates its ID
+ *           if a create/delete operation is being completed.
+ *
+ *           The global table lock must be held by the caller.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectIdTransactionUpdate(OS_object_token_t *token, const osal_id_t *final_id)
+{
+    OS_common_record_t *record;
+
+    record = OS_ObjectIdGlobalFromToken(token);
+
+    if (OS_RecordGetRefcount(record) > 0)
+    {
+        OS_RecordDecrRefcount(record);
+    }
+
+    /*
+     * If an ID update was pending (i.e. for a create/delete op)
+     * then do the ID update now while holding the mutex.
+     */
+    if (final_id != NULL)
+    {
+        OS_RecordSetActiveId(record, *final_id);
+
+        /* a record being returned to the pool must also leave the name index */
+        if (!OS_ObjectIdDefined(record->active_id))
+        {
+            OS_ObjectIdNameIndexRemove(token);
+            OS_ObjectIdFreeQueueAppend(token);
+        }
+    }
+    else if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
+    {
+        /*
+         * If the lock type was EXCLUSIVE, it means that the ID in the record
+         * was reset to OS_OBJECT_ID_RESERVED.  This must restore the original
+         * object ID from the token.
+         */
+        OS_RecordSetActiveId(record, token->obj_id);
+    }
+
+    /*
+     * If this released the last reference to an object which is still RESERVED,
+     * then another task is waiting to lock it exclusively and can proceed now.
+     */
+    if (OS_RecordGetRefcount(record) == 0 && OS_ObjectIdEqual(record->active_id, OS_OBJECT_ID_RESERVED))
+    {
+        OS_SignalHandoff_Impl(token->obj_type);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Complete a transaction which was previously obtained via
@@ -1050,15 +1873,18 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
  *-----------------------------------------------------------------*/
 void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *final_id)
 {
-    OS_common_record_t *record;
-
     if (token->lock_mode == OS_LOCK_MODE_NONE)
     {
         /* nothing to do */
         return;
     }
 
-    record = OS_ObjectIdGlobalFromToken(token);
+    /* releasing a refcount without changing the ID does not normally need the global table lock */
+    if (token->lock_mode == OS_LOCK_MODE_REFCOUNT && final_id == NULL && OS_ObjectIdRefcountRelease(token))
+    {
+        token->lock_mode = OS_LOCK_MODE_NONE;
+        return;
+    }
 
     /* re-acquire global table lock to adjust refcount */
     if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE || token->lock_mode == OS_LOCK_MODE_REFCOUNT)
@@ -1066,32 +1892,12 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         OS_Lock_Global(token);
     }
 
-    if (record->refcount > 0)
-    {
-        --record->refcount;
-    }
-
     /*
      * at this point the global mutex is always held, either
      * from re-acquiring it above or it is still held from
      * the original lock when using OS_LOCK_MODE_GLOBAL.
-     *
-     * If an ID update was pending (i.e. for a create/delete op)
-     * then do the ID update now while holding the mutex.
      */
-    if (final_id != NULL)
-    {
-        record->active_id = *final_id;
-    }
-    else if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
-    {
-        /*
-         * If the lock type was EXCLUSIVE, it means that the ID in the record
-         * was reset to OS_OBJECT_ID_RESERVED.  This must restore the original
-         * object ID from the token.
-         */
-        record->active_id = token->obj_id;
-    }
+    OS_ObjectIdTransactionUpdate(token, final_id);
 
     /* always unlock (this also covers OS_LOCK_MODE_GLOBAL case) */
     OS_Unlock_Global(token);
@@ -1172,7 +1978,7 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
      */
     if (name != NULL)
     {
-        return_code = OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
+        return_code = OS_ObjectIdFindNameMatch(name, token);
     }
     else
     {
@@ -1188,6 +1994,16 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
         return_code = OS_ObjectIdFindNextFree(token);
     }
 
+    /*
+     * Index the name now, rather than once creation is complete, so that the
+     * name remains reserved while the remainder of the create process continues.
+     * If creation fails, it will be removed again by OS_ObjectIdFinalizeNew().
+     */
+    if (return_code == OS_SUCCESS && name != NULL)
+    {
+        OS_ObjectIdNameIndexInsert(token, name);
+    }
+
     /* If allocation failed, abort the operation now - no ID was allocated.
      * After this point, if a future step fails, the allocated ID must be
      * released. */
@@ -1216,11 +2032,314 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
 
 /*----------------------------------------------------------------
 
-    Purpose: Transfer ownership of a token to another buffer
+    Purpose: Issue several new object IDs of the given type under one lock
  ------------------------------------------------------------------*/
-void OS_ObjectIdTransferToken(OS_object_token_t *token_from, OS_object_token_t *token_to)
+int32 OS_ObjectIdAllocateNewBatch(osal_objtype_t idtype, const char *const *names, uint32 count,
+                                  OS_object_token_t *tokens)
 {
-    /* start with a simple copy */
+    int32               return_code;
+    OS_object_token_t   base;
+    OS_common_record_t *record;
+    osal_id_t           final_id;
+    uint32              allocated;
+
+    /*
+     * No new objects can be created after Shutdown request
+     */
+    if (OS_SharedGlobalVars.GlobalState == OS_SHUTDOWN_MAGIC_NUMBER)
+    {
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    return_code = OS_ObjectIdTransactionInit(OS_LOCK_MODE_EXCLUSIVE, idtype, &base);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    /*
+     * Each record is allocated as OS_ObjectIdAllocateNew() would, and then
+     * reserved as OS_ObjectIdConvertToken() would.  As a new record cannot
+     * be in use by any other task, there is no need to wait for it, and so
+     * the table remains locked throughout.
+     */
+    for (allocated = 0; allocated < count; ++allocated)
+    {
+        tokens[allocated] = base;
+
+        if (names[allocated] != NULL && OS_ObjectIdFindNameMatch(names[allocated], &tokens[allocated]) == OS_SUCCESS)
+        {
+            return_code = OS_ERR_NAME_TAKEN;
+            break;
+        }
+
+        return_code = OS_ObjectIdFindNextFree(&tokens[allocated]);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        record = OS_ObjectIdGlobalFromToken(&tokens[allocated]);
+
+        /*
+         * The caller's name is referenced until OS_OBJECT_INIT() stores a copy,
+         * so that a duplicate name later in the same batch is also detected.
+         */
+        if (names[allocated] != NULL)
+        {
+            OS_ObjectIdNameIndexInsert(&tokens[allocated], names[allocated]);
+            record->name_entry = names[allocated];
+        }
+
+        OS_RecordSetActiveId(record, OS_OBJECT_ID_RESERVED);
+        OS_RecordIncrRefcount(record);
+
+        return_code = OS_NotifyEvent(OS_EVENT_RESOURCE_ALLOCATED, tokens[allocated].obj_id, NULL);
+        if (return_code != OS_SUCCESS)
+        {
+            ++allocated;
+            break;
+        }
+    }
+
+    /* If any allocation failed, all records allocated so far are returned to the pool */
+    if (return_code != OS_SUCCESS)
+    {
+        final_id = OS_OBJECT_ID_UNDEFINED;
+        while (allocated > 0)
+        {
+            --allocated;
+            OS_ObjectIdTransactionUpdate(&tokens[allocated], &final_id);
+            tokens[allocated].lock_mode = OS_LOCK_MODE_NONE;
+        }
+    }
+
+    OS_Unlock_Global(&base);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+
+    Purpose: Complete the operation initiated by OS_ObjectIdAllocateNewBatch()
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdFinalizeNewBatch(int32 operation_status, OS_object_token_t *tokens, uint32 count, osal_id_t *outids)
+{
+    osal_id_t final_id;
+    uint32    i;
+
+    OS_Lock_Global(&tokens[0]);
+
+    for (i = 0; i < count; ++i)
+    {
+        if (operation_status == OS_SUCCESS)
+        {
+            final_id = tokens[i].obj_id;
+        }
+        else
+        {
+            final_id = OS_OBJECT_ID_UNDEFINED;
+        }
+
+        OS_ObjectIdTransactionUpdate(&tokens[i], &final_id);
+
+        /* always write the final value to the output buffer */
+        outids[i] = final_id;
+    }
+
+    OS_Unlock_Global(&tokens[0]);
+
+    for (i = 0; i < count; ++i)
+    {
+        tokens[i].lock_mode = OS_LOCK_MODE_NONE;
+
+        /* Give event callback to the application */
+        if (operation_status == OS_SUCCESS)
+        {
+            OS_NotifyEvent(OS_EVENT_RESOURCE_CREATED, tokens[i].obj_id, NULL);
+        }
+    }
+
+    return operation_status;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks if the record referred to by the last token in the
+ *           set is already locked by one of the preceding tokens.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_ObjectIdBatchHasDuplicate(const OS_object_token_t *tokens, uint32 last)
+{
+    uint32 i;
+
+    for (i = 0; i < last; ++i)
+    {
+        if (tokens[i].lock_mode != OS_LOCK_MODE_NONE && tokens[i].obj_idx == tokens[last].obj_idx)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+
+    Purpose: Obtain exclusive locks on several objects of the given type
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdGetByIdBatch(osal_objtype_t idtype, const osal_id_t *ids, uint32 count, OS_object_token_t *tokens)
+{
+    int32               return_code;
+    int32               status;
+    OS_object_token_t   base;
+    OS_common_record_t *record;
+    uint32              i;
+
+    return_code = OS_ObjectIdTransactionInit(OS_LOCK_MODE_EXCLUSIVE, idtype, &base);
+    if (return_code != OS_SUCCESS)
+    {
+        for (i = 0; i < count; ++i)
+        {
+            tokens[i].lock_mode = OS_LOCK_MODE_NONE;
+        }
+        return return_code;
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        tokens[i] = base;
+
+        status = OS_ObjectIdToArrayIndex(idtype, ids[i], &tokens[i].obj_idx);
+        if (status == OS_SUCCESS)
+        {
+            tokens[i].obj_id = ids[i];
+            record           = OS_ObjectIdGlobalFromToken(&tokens[i]);
+
+            if (OS_ObjectIdEqual(record->active_id, ids[i]) && OS_RecordGetRefcount(record) == 0)
+            {
+                /* The usual case: the object is idle, so it can be reserved without releasing the table */
+                OS_RecordSetActiveId(record, OS_OBJECT_ID_RESERVED);
+                OS_RecordIncrRefcount(record);
+            }
+            else if (OS_ObjectIdBatchHasDuplicate(tokens, i))
+            {
+                /* An ID which appears twice would otherwise wait on itself */
+                status = OS_ERR_INVALID_ID;
+            }
+            else
+            {
+                /*
+                 * Otherwise this needs to wait for the other task(s) using the object, or
+                 * fail if the ID is not valid.  The table is unlocked upon success, and
+                 * must be locked again for the remaining objects.
+                 */
+                status = OS_ObjectIdConvertToken(&tokens[i]);
+                if (status == OS_SUCCESS)
+                {
+                    OS_Lock_Global(&base);
+                }
+            }
+        }
+
+        if (status != OS_SUCCESS)
+        {
+            tokens[i].lock_mode = OS_LOCK_MODE_NONE;
+            if (return_code == OS_SUCCESS)
+            {
+                return_code = status;
+            }
+        }
+    }
+
+    OS_Unlock_Global(&base);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+
+    Purpose: Complete delete operations on the objects locked by OS_ObjectIdGetByIdBatch()
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdFinalizeDeleteBatch(const int32 *operation_status, OS_object_token_t *tokens, uint32 count)
+{
+    int32     return_code;
+    osal_id_t final_id;
+    uint32    first;
+    uint32    i;
+
+    /* Find the first token which holds a lock, which is used to lock the table */
+    for (first = 0; first < count; ++first)
+    {
+        if (tokens[first].lock_mode != OS_LOCK_MODE_NONE)
+        {
+            break;
+        }
+    }
+
+    if (first == count)
+    {
+        return OS_SUCCESS;
+    }
+
+    return_code = OS_SUCCESS;
+
+    OS_Lock_Global(&tokens[first]);
+
+    for (i = first; i < count; ++i)
+    {
+        if (tokens[i].lock_mode == OS_LOCK_MODE_NONE)
+        {
+            continue;
+        }
+
+        /* Clear the OSAL ID if successful - this returns the record to the pool */
+        if (operation_status[i] == OS_SUCCESS)
+        {
+            final_id = OS_OBJECT_ID_UNDEFINED;
+        }
+        else
+        {
+            /* this restores the original ID */
+            final_id = tokens[i].obj_id;
+            if (return_code == OS_SUCCESS)
+            {
+                return_code = operation_status[i];
+            }
+        }
+
+        OS_ObjectIdTransactionUpdate(&tokens[i], &final_id);
+    }
+
+    OS_Unlock_Global(&tokens[first]);
+
+    for (i = first; i < count; ++i)
+    {
+        if (tokens[i].lock_mode == OS_LOCK_MODE_NONE)
+        {
+            continue;
+        }
+
+        tokens[i].lock_mode = OS_LOCK_MODE_NONE;
+
+        /* Give event callback to the application */
+        if (operation_status[i] == OS_SUCCESS)
+        {
+            OS_NotifyEvent(OS_EVENT_RESOURCE_DELETED, tokens[i].obj_id, NULL);
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+
+    Purpose: Transfer ownership of a token to another buffer
+ ------------------------------------------------------------------*/
+void OS_ObjectIdTransferToken(OS_object_token_t *token_from, OS_object_token_t *token_to)
+{
+    /* start with a simple copy */
     *token_to = *token_from;
 
     /*
@@ -1324,6 +2443,57 @@ int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, int32 (*func)(osal
     return status;
 }
 
+/*----------------------------------------------------------------
+
+    Purpose: Initialize a snapshot of OSAL objects
+ ------------------------------------------------------------------*/
+void OS_ObjectIdSnapshotInit(OS_ObjectMatchFunc_t matchfunc, void *matcharg, osal_objtype_t objtype,
+                             OS_object_snapshot_t *snap)
+{
+    snap->match    = matchfunc;
+    snap->arg      = matcharg;
+    snap->objtype  = objtype;
+    snap->next_idx = 0;
+    snap->count    = 0;
+}
+
+/*----------------------------------------------------------------
+
+    Purpose: Collect the next batch of IDs into the snapshot
+ ------------------------------------------------------------------*/
+bool OS_ObjectIdSnapshotNext(OS_object_snapshot_t *snap)
+{
+    OS_object_token_t   token;
+    OS_common_record_t *base;
+    OS_common_record_t *record;
+    uint32              limit;
+
+    snap->count = 0;
+
+    if (OS_ObjectIdTransactionInit(OS_LOCK_MODE_GLOBAL, snap->objtype, &token) == OS_SUCCESS)
+    {
+        limit = OS_GetMaxForObjectType(snap->objtype);
+        base  = &OS_common_table[OS_GetBaseForObjectType(snap->objtype)];
+
+        while (snap->count < OS_OBJECT_SNAPSHOT_SIZE && snap->next_idx < limit)
+        {
+            token.obj_idx = OSAL_INDEX_C(snap->next_idx);
+            record        = OS_OBJECT_TABLE_GET(base, token);
+            ++snap->next_idx;
+
+            if (snap->match == NULL || snap->match(snap->arg, &token, record))
+            {
+                snap->ids[snap->count] = record->active_id;
+                ++snap->count;
+            }
+        }
+
+        OS_ObjectIdTransactionCancel(&token);
+    }
+
+    return (snap->count > 0);
+}
+
 /*
  *********************************************************************************
  *          PUBLIC API (these functions may be called externally)
@@ -1367,24 +2537,127 @@ void OS_ForEachObject(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void
 void OS_ForEachObjectOfType(osal_objtype_t objtype, osal_id_t creator_id, OS_ArgCallback_t callback_ptr,
                             void *callback_arg)
 {
-    OS_object_iter_t    iter;
-    OS_creator_filter_t filter;
+    OS_object_snapshot_t snap;
+    OS_creator_filter_t  filter;
+    uint32               i;
 
     filter.creator_id    = creator_id;
     filter.user_callback = callback_ptr;
     filter.user_arg      = callback_arg;
 
-    if (OS_ObjectIdIteratorInit(OS_ForEachFilterCreator, &filter, objtype, &iter) == OS_SUCCESS)
+    /*
+     * The IDs are collected in batches under the table lock, and the
+     * callbacks are invoked for each batch after the lock is released.
+     */
+    OS_ObjectIdSnapshotInit(OS_ForEachFilterCreator, &filter, objtype, &snap);
+    while (OS_ObjectIdSnapshotNext(&snap))
     {
-        while (OS_ObjectIdIteratorGetNext(&iter))
+        for (i = 0; i < snap.count; ++i)
         {
-            OS_ObjectIdIteratorProcessEntry(&iter, OS_ForEachDoCallback);
+            OS_ForEachDoCallback(snap.ids[i], &filter);
         }
+    }
+}
 
-        OS_ObjectIdIteratorDestroy(&iter);
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_ForEachObjectNonBlocking(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void *callback_arg)
+{
+    osal_objtype_t idtype;
+
+    for (idtype = 0; idtype < OS_OBJECT_TYPE_USER; ++idtype)
+    {
+        OS_ForEachObjectOfTypeNonBlocking(idtype, creator_id, callback_ptr, callback_arg);
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_ForEachObjectOfTypeNonBlocking(osal_objtype_t objtype, osal_id_t creator_id, OS_ArgCallback_t callback_ptr,
+                                       void *callback_arg)
+{
+#ifdef OS_LOCKFREE_REFCOUNT
+    OS_object_token_t   token;
+    OS_common_record_t *base;
+    OS_common_record_t *record;
+    osal_id_t           obj_id;
+    osal_id_t           obj_creator;
+
+    /* This only checks the state of OSAL, it does not lock anything */
+    if (OS_ObjectIdTransactionInit(OS_LOCK_MODE_NONE, objtype, &token) != OS_SUCCESS)
+    {
+        return;
+    }
+
+    base = &OS_common_table[OS_GetBaseForObjectType(objtype)];
+
+    for (token.obj_idx = 0; token.obj_idx < OS_GetMaxForObjectType(objtype); ++token.obj_idx)
+    {
+        record = OS_OBJECT_TABLE_GET(base, token);
+        obj_id = OS_RecordGetActiveId(record);
+        if (!OS_ObjectIdIsValid(obj_id))
+        {
+            continue;
+        }
+
+        /*
+         * The creator is written before the ID is published, so it is
+         * consistent with the ID provided the record was not recycled
+         * in the meantime, which would have given it a different ID.
+         */
+        obj_creator = OS_RecordGetCreator(record);
+        if (!OS_ObjectIdEqual(OS_RecordGetActiveId(record), obj_id))
+        {
+            continue;
+        }
+
+        if (OS_ObjectIdEqual(creator_id, OS_OBJECT_CREATOR_ANY) || OS_ObjectIdEqual(obj_creator, creator_id))
+        {
+            callback_ptr(obj_id, callback_arg);
+        }
+    }
+#else
+    /* Without atomic access to the records, the table must be locked to read them */
+    OS_ForEachObjectOfType(objtype, creator_id, callback_ptr, callback_arg);
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GetObjectTypeLockStats(osal_objtype_t objtype, OS_lock_stats_t *stats)
+{
+#ifdef OSAL_CONFIG_OBJECT_LOCK_STATS
+    OS_object_token_t token;
+    int32             return_code;
+
+    OS_CHECK_POINTER(stats);
+
+    /* take the table lock so the statistics are consistent with each other */
+    return_code = OS_ObjectIdTransactionInit(OS_LOCK_MODE_GLOBAL, objtype, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        *stats = OS_objtype_state[objtype].lock_stats;
+        OS_ObjectIdTransactionCancel(&token);
+    }
+
+    return return_code;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -58,7 +58,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_MODULE
 };
 
-OS_module_internal_record_t OS_module_table[OS_MAX_MODULES];
+OS_module_internal_record_t *OS_module_table;
 
 /*
  * If the "OS_STATIC_LOADER" directive is enabled,
@@ -172,8 +172,7 @@ int32 OS_ModuleLoad_Static(const char *ModuleName)
  *-----------------------------------------------------------------*/
 int32 OS_ModuleAPI_Init(void)
 {
-    memset(OS_module_table, 0, sizeof(OS_module_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_module_table);
 }
 
 /*----------------------------------------------------------------
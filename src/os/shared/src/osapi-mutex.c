@@ -38,6 +38,7 @@
  */
 #include "os-shared-idmap.h"
 #include "os-shared-mutex.h"
+#include "os-shared-clock.h"
 
 /*
  * Other OSAL public APIs used by this module
@@ -61,7 +62,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_MUTEX
 };
 
-OS_mutex_internal_record_t OS_mutex_table[LOCAL_NUM_OBJECTS];
+OS_mutex_internal_record_t *OS_mutex_table;
 
 /****************************************************************************************
                                   MUTEX API
@@ -75,8 +76,85 @@ OS_mutex_internal_record_t OS_mutex_table[LOCAL_NUM_OBJECTS];
  *-----------------------------------------------------------------*/
 int32 OS_MutexAPI_Init(void)
 {
-    memset(OS_mutex_table, 0, sizeof(OS_mutex_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_mutex_table);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks whether a take of the mutex is contended, i.e. whether
+ *           another task holds it, and if so gets the time the wait started.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_MutSemStatsWaitStart(OS_mutex_internal_record_t *mutex, OS_time_t *wait_start)
+{
+#ifdef OSAL_CONFIG_MUTEX_STATS
+    osal_id_t owner;
+
+    owner = mutex->last_owner;
+    if (OS_ObjectIdDefined(owner) && !OS_ObjectIdEqual(owner, OS_TaskGetId()))
+    {
+        OS_GetMonotonicTime_Impl(wait_start);
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Records a take of the mutex in the statistics.  This is called
+ *           by the new owner, so the statistics are protected by the mutex.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_MutSemStatsTake(OS_mutex_internal_record_t *mutex, bool contended, OS_time_t wait_start)
+{
+#ifdef OSAL_CONFIG_MUTEX_STATS
+    OS_time_t wait_time;
+
+    OS_GetMonotonicTime_Impl(&mutex->take_time);
+    ++mutex->stats.take_count;
+
+    if (contended)
+    {
+        wait_time = OS_TimeSubtract(mutex->take_time, wait_start);
+
+        ++mutex->stats.contended_count;
+        mutex->stats.total_wait_time = OS_TimeAdd(mutex->stats.total_wait_time, wait_time);
+        if (wait_time.ticks > mutex->stats.max_wait_time.ticks)
+        {
+            mutex->stats.max_wait_time = wait_time;
+        }
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Records the time the mutex was held in the statistics.  This is
+ *           called by the owner before it gives the mutex.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_MutSemStatsGive(OS_mutex_internal_record_t *mutex, osal_id_t self_task)
+{
+#ifdef OSAL_CONFIG_MUTEX_STATS
+    OS_time_t hold_time;
+
+    /* the time it was taken is unknown if this task did not take it */
+    if (OS_ObjectIdEqual(mutex->last_owner, self_task))
+    {
+        OS_GetMonotonicTime_Impl(&hold_time);
+        hold_time = OS_TimeSubtract(hold_time, mutex->take_time);
+        if (hold_time.ticks > mutex->stats.max_hold_time.ticks)
+        {
+            mutex->stats.max_hold_time = hold_time;
+            mutex->stats.max_hold_task = self_task;
+        }
+    }
+#endif
 }
 
 /*----------------------------------------------------------------
@@ -164,6 +242,8 @@ int32 OS_MutSemGive(osal_id_t sem_id)
                      OS_ObjectIdToInteger(sem_id), OS_ObjectIdToInteger(mutex->last_owner));
         }
 
+        OS_MutSemStatsGive(mutex, self_task);
+
         mutex->last_owner = OS_OBJECT_ID_UNDEFINED;
 
         return_code = OS_MutSemGive_Impl(&token);
@@ -183,6 +263,8 @@ int32 OS_MutSemTake(osal_id_t sem_id)
     OS_mutex_internal_record_t *mutex;
     OS_object_token_t           token;
     int32                       return_code;
+    bool                        contended;
+    OS_time_t                   wait_start;
 
     /* Check Parameters */
     return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
@@ -190,11 +272,16 @@ int32 OS_MutSemTake(osal_id_t sem_id)
     {
         mutex = OS_OBJECT_TABLE_GET(OS_mutex_table, token);
 
+        wait_start = OS_TIME_ZERO;
+        contended  = OS_MutSemStatsWaitStart(mutex, &wait_start);
+
         return_code = OS_MutSemTake_Impl(&token);
         if (return_code == OS_SUCCESS)
         {
             /* Always set the owner if OS_MutSemTake_Impl() returned success */
             mutex->last_owner = OS_TaskGetId();
+
+            OS_MutSemStatsTake(mutex, contended, wait_start);
         }
     }
 
@@ -252,3 +339,58 @@ int32 OS_MutSemGetInfo(osal_id_t sem_id, OS_mut_sem_prop_t *mut_prop)
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MutSemGetStats(osal_id_t sem_id, OS_mut_sem_stats_t *stats)
+{
+#ifdef OSAL_CONFIG_MUTEX_STATS
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_mutex_internal_record_t *mutex;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        mutex  = OS_OBJECT_TABLE_GET(OS_mutex_table, token);
+        *stats = mutex->stats;
+    }
+
+    return return_code;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MutSemResetStats(osal_id_t sem_id)
+{
+#ifdef OSAL_CONFIG_MUTEX_STATS
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_mutex_internal_record_t *mutex;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        mutex = OS_OBJECT_TABLE_GET(OS_mutex_table, token);
+        memset(&mutex->stats, 0, sizeof(mutex->stats));
+    }
+
+    return return_code;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
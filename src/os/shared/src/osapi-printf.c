@@ -68,7 +68,7 @@
 static char OS_printf_buffer_mem[(sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE) * OS_BUFFER_MSG_DEPTH];
 
 /* The global console state table */
-OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
+OS_console_internal_record_t *OS_console_table;
 
 /*
  *********************************************************************************
@@ -87,7 +87,11 @@ int32 OS_ConsoleAPI_Init(void)
     int32                         return_code;
     OS_object_token_t             token;
 
-    memset(&OS_console_table, 0, sizeof(OS_console_table));
+    return_code = OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_CONSOLE, OS_console_table);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
 
     /*
      * Configure a console device to be used for OS_printf() calls.
@@ -42,6 +42,7 @@
  */
 #include "os-shared-queue.h"
 #include "os-shared-idmap.h"
+#include "os-shared-clock.h"
 
 /*
  * Sanity checks on the user-supplied configuration
@@ -57,7 +58,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_QUEUE
 };
 
-OS_queue_internal_record_t OS_queue_table[LOCAL_NUM_OBJECTS];
+OS_queue_internal_record_t *OS_queue_table;
 
 /****************************************************************************************
                                 MESSAGE QUEUE API
@@ -71,8 +72,654 @@ OS_queue_internal_record_t OS_queue_table[LOCAL_NUM_OBJECTS];
  *-----------------------------------------------------------------*/
 int32 OS_QueueAPI_Init(void)
 {
-    memset(OS_queue_table, 0, sizeof(OS_queue_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_queue_table);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Looks up a queue for an operation on it.  If the implementation
+ *           frees the storage of the queue when it is deleted, the token holds
+ *           a reference to it until released, which OS_QueueDelete() waits for.
+ *
+ *           Other queues, such as the message queues of an RTOS, can be deleted
+ *           while tasks are blocked on them, so nothing is held in that case.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_QueueGetToken(osal_id_t queue_id, OS_object_token_t *token)
+{
+    int32 return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, token);
+    if (return_code == OS_SUCCESS && !OS_OBJECT_TABLE_GET(OS_queue_table, *token)->referenced)
+    {
+        OS_ObjectIdRelease(token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Marks a queue as about to be deleted, or no longer so if deleting
+ *           it failed.  Tasks waiting on a marked queue give up, releasing their
+ *           references to it, so that the EXCLUSIVE lock needed to delete it
+ *           does not wait for them.
+ *
+ *           If no reference can be taken, such as during shutdown, the queue is
+ *           not marked and the EXCLUSIVE lock decides the outcome instead.
+ *
+ *  returns: The result of OS_QueueDeletePending_Impl(), with *marked set
+ *           if the queue was marked
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_QueueDeletePending(osal_id_t queue_id, bool pending, bool *marked)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    *marked = false;
+
+    if (OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, queue_id, &token) != OS_SUCCESS)
+    {
+        return OS_SUCCESS;
+    }
+
+    return_code = OS_QueueDeletePending_Impl(&token, pending);
+    *marked     = (return_code == OS_SUCCESS);
+
+    OS_ObjectIdRelease(&token);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Records the outcome of a put of "count" messages in the
+ *           queue statistics.  The statistics are updated atomically,
+ *           without locking, so this may be called concurrently.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_QueueStatsPut(OS_queue_internal_record_t *queue, int32 return_code, uint32 count)
+{
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    uint32 depth;
+    uint32 high_water_mark;
+
+    if (return_code == OS_SUCCESS && count > 0)
+    {
+        __atomic_add_fetch(&queue->stats.put_count, count, __ATOMIC_RELAXED);
+        depth = __atomic_add_fetch(&queue->stats.depth, count, __ATOMIC_RELAXED);
+
+        /* The depth may transiently appear negative if the messages were already received */
+        high_water_mark = __atomic_load_n(&queue->stats.high_water_mark, __ATOMIC_RELAXED);
+        while ((int32)depth > (int32)high_water_mark &&
+               !__atomic_compare_exchange_n(&queue->stats.high_water_mark, &high_water_mark, depth, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+            /* high_water_mark was reloaded, check again */
+        }
+    }
+    else if (return_code == OS_QUEUE_FULL)
+    {
+        __atomic_add_fetch(&queue->stats.full_count, 1, __ATOMIC_RELAXED);
+    }
+    else if (return_code == OS_QUEUE_TIMEOUT)
+    {
+        __atomic_add_fetch(&queue->stats.timeout_count, 1, __ATOMIC_RELAXED);
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Records the outcome of a get of "count" messages in the
+ *           queue statistics.  The statistics are updated atomically,
+ *           without locking, so this may be called concurrently.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_QueueStatsGet(OS_queue_internal_record_t *queue, int32 return_code, uint32 count)
+{
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    if (return_code == OS_SUCCESS && count > 0)
+    {
+        __atomic_add_fetch(&queue->stats.get_count, count, __ATOMIC_RELAXED);
+        __atomic_sub_fetch(&queue->stats.depth, count, __ATOMIC_RELAXED);
+    }
+    else if (return_code == OS_QUEUE_TIMEOUT)
+    {
+        __atomic_add_fetch(&queue->stats.timeout_count, 1, __ATOMIC_RELAXED);
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_QueueStatsLatency(OS_queue_internal_record_t *queue, OS_time_t put_time)
+{
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_time_t latency;
+    int64     usec;
+    uint32    bucket;
+    int64     max_ticks;
+
+    OS_GetMonotonicTime_Impl(&latency);
+    latency = OS_TimeSubtract(latency, put_time);
+    usec    = OS_TimeGetTotalMicroseconds(latency);
+
+    /* bucket N holds latencies from 2^(N-1) up to 2^N microseconds */
+    bucket = 0;
+    while (usec > 0 && bucket < (OS_QUEUE_LATENCY_BUCKETS - 1))
+    {
+        usec >>= 1;
+        ++bucket;
+    }
+
+    __atomic_add_fetch(&queue->stats.latency_histogram[bucket], 1, __ATOMIC_RELAXED);
+
+    max_ticks = __atomic_load_n(&queue->stats.max_latency.ticks, __ATOMIC_RELAXED);
+    while (latency.ticks > max_ticks &&
+           !__atomic_compare_exchange_n(&queue->stats.max_latency.ticks, &max_ticks, latency.ticks, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+        /* max_ticks was reloaded, check again */
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_QueueStatsDrop(OS_queue_internal_record_t *queue, uint32 count)
+{
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    __atomic_add_fetch(&queue->stats.drop_count, count, __ATOMIC_RELAXED);
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCreate(osal_id_t *queue_id, const char *queue_name, osal_blockcount_t queue_depth, size_t data_size,
+                     uint32 flags)
+{
+    int32                       return_code;
+    OS_object_token_t           token;
+    OS_queue_internal_record_t *queue;
+
+    /* validate inputs */
+    OS_CHECK_POINTER(queue_id);
+    OS_CHECK_APINAME(queue_name);
+    OS_CHECK_SIZE(data_size);
+    ARGCHECK(queue_depth <= OS_QUEUE_MAX_DEPTH, OS_QUEUE_INVALID_SIZE);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(LOCAL_OBJID_TYPE, queue_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, queue, queue_name, queue_name);
+
+        queue->max_depth = queue_depth;
+        queue->max_size  = data_size;
+
+        /* Now call the OS-specific implementation.  This reads info from the queue table. */
+        return_code = OS_QueueCreate_Impl(&token, flags);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, queue_id);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCreatePacked(osal_id_t *queue_id, const char *queue_name, size_t byte_budget, size_t max_size,
+                           uint32 flags)
+{
+    int32                       return_code;
+    OS_object_token_t           token;
+    OS_queue_internal_record_t *queue;
+    size_t                      depth;
+
+    /* validate inputs */
+    OS_CHECK_POINTER(queue_id);
+    OS_CHECK_APINAME(queue_name);
+    OS_CHECK_SIZE(max_size);
+    ARGCHECK(byte_budget >= max_size, OS_QUEUE_INVALID_SIZE);
+
+    /*
+     * The depth is only used by implementations which cannot pack messages,
+     * for which the budget is divided into entries of the maximum size.
+     */
+    depth = byte_budget / max_size;
+    if (depth > OS_QUEUE_MAX_DEPTH)
+    {
+        depth = OS_QUEUE_MAX_DEPTH;
+    }
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(LOCAL_OBJID_TYPE, queue_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, queue, queue_name, queue_name);
+
+        queue->max_depth = OSAL_BLOCKCOUNT_C(depth);
+        queue->max_size  = max_size;
+        queue->max_bytes = byte_budget;
+
+        /* Now call the OS-specific implementation.  This reads info from the queue table. */
+        return_code = OS_QueueCreate_Impl(&token, flags);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, queue_id);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCreateBatch(osal_id_t *queue_ids, const char *const *queue_names, uint32 count,
+                          osal_blockcount_t queue_depth, size_t data_size, uint32 flags)
+{
+    int32                         return_code;
+    OS_object_token_t             tokens[OS_OBJECT_BATCH_SIZE];
+    OS_queue_internal_record_t *queue;
+    uint32                        done;
+    uint32                        chunk;
+    uint32                        i;
+
+    /* validate inputs */
+    OS_CHECK_POINTER(queue_ids);
+    OS_CHECK_POINTER(queue_names);
+    OS_CHECK_SIZE(data_size);
+    ARGCHECK(queue_depth <= OS_QUEUE_MAX_DEPTH, OS_QUEUE_INVALID_SIZE);
+    ARGCHECK(count > 0, OS_ERR_INVALID_SIZE);
+    for (i = 0; i < count; ++i)
+    {
+        OS_CHECK_APINAME(queue_names[i]);
+    }
+
+    return_code = OS_SUCCESS;
+    done        = 0;
+    while (done < count)
+    {
+        chunk = count - done;
+        if (chunk > OS_OBJECT_BATCH_SIZE)
+        {
+            chunk = OS_OBJECT_BATCH_SIZE;
+        }
+
+        /* Note - unlike OS_ObjectIdAllocateNew() this does not leave the table locked */
+        return_code = OS_ObjectIdAllocateNewBatch(LOCAL_OBJID_TYPE, &queue_names[done], chunk, tokens);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        for (i = 0; i < chunk; ++i)
+        {
+            queue = OS_OBJECT_TABLE_GET(OS_queue_table, tokens[i]);
+
+            /* Reset the table entry and save the name */
+            OS_OBJECT_INIT(tokens[i], queue, queue_name, queue_names[done + i]);
+
+            queue->max_depth = queue_depth;
+            queue->max_size  = data_size;
+
+            return_code = OS_QueueCreate_Impl(&tokens[i], flags);
+            if (return_code != OS_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        /* If any failed, then the queues already created in this group are deleted */
+        if (return_code != OS_SUCCESS)
+        {
+            while (i > 0)
+            {
+                --i;
+                OS_QueueDelete_Impl(&tokens[i]);
+            }
+        }
+
+        /* Check result, finalize records */
+        return_code = OS_ObjectIdFinalizeNewBatch(return_code, tokens, chunk, &queue_ids[done]);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        done += chunk;
+    }
+
+    /* If any group failed, then the queues created in the previous groups are deleted */
+    if (return_code != OS_SUCCESS)
+    {
+        if (done > 0)
+        {
+            OS_QueueDeleteBatch(queue_ids, done);
+        }
+
+        for (i = 0; i < count; ++i)
+        {
+            queue_ids[i] = OS_OBJECT_ID_UNDEFINED;
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueSubscribe(osal_id_t *queue_id, const char *queue_name, osal_id_t broadcast_id, uint32 flags)
+{
+    int32                       return_code;
+    OS_object_token_t           source_token;
+    OS_object_token_t           token;
+    OS_queue_internal_record_t *source;
+    OS_queue_internal_record_t *queue;
+
+    /* validate inputs */
+    OS_CHECK_POINTER(queue_id);
+    OS_CHECK_APINAME(queue_name);
+
+    /*
+     * The reference prevents the broadcast queue from being deleted while subscribing,
+     * and is then held by the subscriber, so that the broadcast queue outlives every
+     * operation on the subscriber.  It is released when the subscriber is deleted.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, broadcast_id, &source_token);
+    if (return_code == OS_SUCCESS)
+    {
+        source = OS_OBJECT_TABLE_GET(OS_queue_table, source_token);
+
+        /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+        return_code = OS_ObjectIdAllocateNew(LOCAL_OBJID_TYPE, queue_name, &token);
+        if (return_code == OS_SUCCESS)
+        {
+            queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+            /* Reset the table entry and save the name */
+            OS_OBJECT_INIT(token, queue, queue_name, queue_name);
+
+            queue->max_depth = source->max_depth;
+            queue->max_size  = source->max_size;
+
+            /* Now call the OS-specific implementation.  This reads info from the queue table. */
+            return_code = OS_QueueSubscribe_Impl(&token, &source_token, flags);
+            if (return_code == OS_SUCCESS)
+            {
+                queue->source = source_token;
+            }
+
+            /* Check result, finalize record, and unlock global table. */
+            return_code = OS_ObjectIdFinalizeNew(return_code, &token, queue_id);
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            OS_ObjectIdRelease(&source_token);
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueDelete(osal_id_t queue_id)
+{
+    OS_object_token_t token;
+    OS_object_token_t source;
+    int32             return_code;
+    bool              marked;
+
+    /* The tasks waiting on the queue are told to give up first */
+    return_code = OS_QueueDeletePending(queue_id, true, &marked);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        source      = OS_OBJECT_TABLE_GET(OS_queue_table, token)->source;
+        return_code = OS_QueueDelete_Impl(&token);
+
+        /* Complete the operation via the common routine */
+        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+
+        /* A subscriber no longer needs its broadcast queue */
+        if (return_code == OS_SUCCESS)
+        {
+            OS_ObjectIdRelease(&source);
+        }
+    }
+
+    /* If the queue still exists, it can be used again */
+    if (return_code != OS_SUCCESS && marked)
+    {
+        OS_QueueDeletePending(queue_id, false, &marked);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueDeleteBatch(const osal_id_t *queue_ids, uint32 count)
+{
+    OS_object_token_t tokens[OS_OBJECT_BATCH_SIZE];
+    OS_object_token_t sources[OS_OBJECT_BATCH_SIZE];
+    osal_id_t         ids[OS_OBJECT_BATCH_SIZE];
+    int32             status[OS_OBJECT_BATCH_SIZE];
+    bool              marked[OS_OBJECT_BATCH_SIZE];
+    int32             return_code;
+    int32             chunk_code;
+    uint32            done;
+    uint32            chunk;
+    uint32            i;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(queue_ids);
+    ARGCHECK(count > 0, OS_ERR_INVALID_SIZE);
+
+    return_code = OS_SUCCESS;
+    for (done = 0; done < count; done += chunk)
+    {
+        chunk = count - done;
+        if (chunk > OS_OBJECT_BATCH_SIZE)
+        {
+            chunk = OS_OBJECT_BATCH_SIZE;
+        }
+
+        /* The tasks waiting on the queues are told to give up first, as in OS_QueueDelete() */
+        for (i = 0; i < chunk; ++i)
+        {
+            status[i] = OS_QueueDeletePending(queue_ids[done + i], true, &marked[i]);
+            ids[i]    = queue_ids[done + i];
+            if (status[i] != OS_SUCCESS)
+            {
+                ids[i] = OS_OBJECT_ID_UNDEFINED;
+                if (return_code == OS_SUCCESS)
+                {
+                    return_code = status[i];
+                }
+            }
+        }
+
+        /* Any queue which could not be locked is skipped, but the rest are still deleted */
+        chunk_code = OS_ObjectIdGetByIdBatch(LOCAL_OBJID_TYPE, ids, chunk, tokens);
+        memset(sources, 0, sizeof(sources));
+        for (i = 0; i < chunk; ++i)
+        {
+            if (tokens[i].lock_mode != OS_LOCK_MODE_NONE)
+            {
+                sources[i] = OS_OBJECT_TABLE_GET(OS_queue_table, tokens[i])->source;
+                status[i]  = OS_QueueDelete_Impl(&tokens[i]);
+            }
+            else if (status[i] == OS_SUCCESS)
+            {
+                status[i] = chunk_code;
+            }
+        }
+
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = chunk_code;
+        }
+
+        /* Complete the operation via the common routine */
+        chunk_code = OS_ObjectIdFinalizeDeleteBatch(status, tokens, chunk);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = chunk_code;
+        }
+
+        /* Any queue which still exists can be used again, and a deleted subscriber releases its broadcast queue */
+        for (i = 0; i < chunk; ++i)
+        {
+            if (status[i] == OS_SUCCESS)
+            {
+                OS_ObjectIdRelease(&sources[i]);
+            }
+            else if (marked[i])
+            {
+                OS_QueueDeletePending(queue_ids[done + i], false, &marked[i]);
+            }
+        }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copied, int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(size_copied);
+    OS_CHECK_SIZE(size);
+
+    return_code = OS_QueueGetToken(queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (size < queue->max_size)
+        {
+            /*
+            ** The buffer that the user is passing in is potentially too small
+            */
+            *size_copied = 0;
+            return_code  = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueueGet_Impl(&token, data, size, size_copied, timeout);
+            OS_QueueStatsGet(queue, return_code, 1);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetWithPriority(osal_id_t queue_id, void *data, size_t size, size_t *size_copied, uint32 *priority,
+                              int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(size_copied);
+    OS_CHECK_POINTER(priority);
+    OS_CHECK_SIZE(size);
+
+    return_code = OS_QueueGetToken(queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (size < queue->max_size)
+        {
+            /*
+            ** The buffer that the user is passing in is potentially too small
+            */
+            *size_copied = 0;
+            return_code  = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueueGetWithPriority_Impl(&token, data, size, size_copied, priority, timeout);
+            OS_QueueStatsGet(queue, return_code, 1);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
 }
 
 /*----------------------------------------------------------------
@@ -81,36 +728,36 @@ int32 OS_QueueAPI_Init(void)
  *           See description in API and header file for detail
  *
  *-----------------------------------------------------------------*/
-int32 OS_QueueCreate(osal_id_t *queue_id, const char *queue_name, osal_blockcount_t queue_depth, size_t data_size,
-                     uint32 flags)
+int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flags)
 {
-    int32                       return_code;
     OS_object_token_t           token;
+    int32                       return_code;
     OS_queue_internal_record_t *queue;
 
-    /* validate inputs */
-    OS_CHECK_POINTER(queue_id);
-    OS_CHECK_APINAME(queue_name);
-    OS_CHECK_SIZE(data_size);
-    ARGCHECK(queue_depth <= OS_QUEUE_MAX_DEPTH, OS_QUEUE_INVALID_SIZE);
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_SIZE(size);
+    ARGCHECK(OS_QUEUE_FLAGS_PRIORITY(flags) < OS_QUEUE_PRIORITY_LEVELS, OS_ERR_INVALID_ARGUMENT);
 
-    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
-    return_code = OS_ObjectIdAllocateNew(LOCAL_OBJID_TYPE, queue_name, &token);
+    return_code = OS_QueueGetToken(queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
         queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
 
-        /* Reset the table entry and save the name */
-        OS_OBJECT_INIT(token, queue, queue_name, queue_name);
-
-        queue->max_depth = queue_depth;
-        queue->max_size  = data_size;
-
-        /* Now call the OS-specific implementation.  This reads info from the queue table. */
-        return_code = OS_QueueCreate_Impl(&token, flags);
+        if (size > queue->max_size)
+        {
+            /*
+            ** The buffer that the user is passing in is too large
+            */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueuePut_Impl(&token, data, size, flags);
+            OS_QueueStatsPut(queue, return_code, 1);
+        }
 
-        /* Check result, finalize record, and unlock global table. */
-        return_code = OS_ObjectIdFinalizeNew(return_code, &token, queue_id);
+        OS_ObjectIdRelease(&token);
     }
 
     return return_code;
@@ -122,18 +769,36 @@ int32 OS_QueueCreate(osal_id_t *queue_id, const char *queue_name, osal_blockcoun
  *           See description in API and header file for detail
  *
  *-----------------------------------------------------------------*/
-int32 OS_QueueDelete(osal_id_t queue_id)
+int32 OS_QueuePutTimed(osal_id_t queue_id, const void *data, size_t size, uint32 flags, int32 timeout)
 {
-    OS_object_token_t token;
-    int32             return_code;
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, queue_id, &token);
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_SIZE(size);
+    ARGCHECK(OS_QUEUE_FLAGS_PRIORITY(flags) < OS_QUEUE_PRIORITY_LEVELS, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_QueueGetToken(queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
-        return_code = OS_QueueDelete_Impl(&token);
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
 
-        /* Complete the operation via the common routine */
-        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+        if (size > queue->max_size)
+        {
+            /*
+            ** The buffer that the user is passing in is too large
+            */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueuePutTimed_Impl(&token, data, size, flags, timeout);
+            OS_QueueStatsPut(queue, return_code, 1);
+        }
+
+        OS_ObjectIdRelease(&token);
     }
 
     return return_code;
@@ -145,7 +810,19 @@ int32 OS_QueueDelete(osal_id_t queue_id)
  *           See description in API and header file for detail
  *
  *-----------------------------------------------------------------*/
-int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copied, int32 timeout)
+int32 OS_QueuePutAbs(osal_id_t queue_id, const void *data, size_t size, uint32 flags, OS_time_t abs_timeout)
+{
+    return OS_QueuePutTimed(queue_id, data, size, flags, OS_TimeToRelativeMilliseconds(abs_timeout));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMultiple(osal_id_t queue_id, void *data, size_t size, size_t *sizes, uint32 max_count,
+                          uint32 *count_copied, int32 timeout)
 {
     OS_object_token_t           token;
     int32                       return_code;
@@ -153,10 +830,14 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
 
     /* Check Parameters */
     OS_CHECK_POINTER(data);
-    OS_CHECK_POINTER(size_copied);
+    OS_CHECK_POINTER(sizes);
+    OS_CHECK_POINTER(count_copied);
     OS_CHECK_SIZE(size);
+    ARGCHECK(max_count > 0, OS_ERR_INVALID_SIZE);
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    *count_copied = 0;
+
+    return_code = OS_QueueGetToken(queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
         queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
@@ -164,15 +845,17 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
         if (size < queue->max_size)
         {
             /*
-            ** The buffer that the user is passing in is potentially too small
+            ** The buffers that the user is passing in are potentially too small
             */
-            *size_copied = 0;
-            return_code  = OS_QUEUE_INVALID_SIZE;
+            return_code = OS_QUEUE_INVALID_SIZE;
         }
         else
         {
-            return_code = OS_QueueGet_Impl(&token, data, size, size_copied, timeout);
+            return_code = OS_QueueGetMultiple_Impl(&token, data, size, sizes, max_count, count_copied, timeout);
+            OS_QueueStatsGet(queue, return_code, *count_copied);
         }
+
+        OS_ObjectIdRelease(&token);
     }
 
     return return_code;
@@ -184,17 +867,79 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
  *           See description in API and header file for detail
  *
  *-----------------------------------------------------------------*/
-int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flags)
+int32 OS_QueuePutMultiple(osal_id_t queue_id, const void *data, size_t size, const size_t *sizes, uint32 count,
+                          uint32 flags, uint32 *count_put)
 {
     OS_object_token_t           token;
     int32                       return_code;
     OS_queue_internal_record_t *queue;
+    uint32                      i;
 
     /* Check Parameters */
     OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(sizes);
+    OS_CHECK_POINTER(count_put);
     OS_CHECK_SIZE(size);
+    ARGCHECK(OS_QUEUE_FLAGS_PRIORITY(flags) < OS_QUEUE_PRIORITY_LEVELS, OS_ERR_INVALID_ARGUMENT);
+    ARGCHECK(count > 0, OS_ERR_INVALID_SIZE);
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    *count_put = 0;
+
+    return_code = OS_QueueGetToken(queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        /* All messages are checked first, so that none are put if any is invalid */
+        for (i = 0; i < count; ++i)
+        {
+            if (sizes[i] == 0)
+            {
+                return_code = OS_ERR_INVALID_SIZE;
+                break;
+            }
+
+            if (sizes[i] > size || sizes[i] > queue->max_size)
+            {
+                /*
+                ** The message is too large for its buffer or the queue
+                */
+                return_code = OS_QUEUE_INVALID_SIZE;
+                break;
+            }
+        }
+
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_QueuePutMultiple_Impl(&token, data, size, sizes, count, flags, count_put);
+            OS_QueueStatsPut(queue, return_code, *count_put);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueReserve(osal_id_t queue_id, void **data_ptr, size_t size)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data_ptr);
+    OS_CHECK_SIZE(size);
+
+    *data_ptr = NULL;
+
+    return_code = OS_QueueGetToken(queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
         queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
@@ -202,14 +947,119 @@ int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flag
         if (size > queue->max_size)
         {
             /*
-            ** The buffer that the user is passing in is too large
+            ** The message that the user wants to build is too large
             */
             return_code = OS_QUEUE_INVALID_SIZE;
         }
         else
         {
-            return_code = OS_QueuePut_Impl(&token, data, size, flags);
+            return_code = OS_QueueReserve_Impl(&token, data_ptr);
+
+            /* the message is not counted until it is committed */
+            OS_QueueStatsPut(queue, return_code, 0);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCommit(osal_id_t queue_id, void *data_ptr, size_t size, uint32 flags)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data_ptr);
+    OS_CHECK_SIZE(size);
+
+    /* The entry was reserved in the storage for the default priority, so it cannot be changed */
+    ARGCHECK(OS_QUEUE_FLAGS_PRIORITY(flags) == 0, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_QueueGetToken(queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (size > queue->max_size)
+        {
+            /*
+            ** The message is too large, the reservation remains outstanding
+            */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            return_code = OS_QueueCommit_Impl(&token, data_ptr, size, flags);
+            OS_QueueStatsPut(queue, return_code, 1);
         }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetRef(osal_id_t queue_id, const void **data_ptr, size_t *size_copied, int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data_ptr);
+    OS_CHECK_POINTER(size_copied);
+
+    *data_ptr    = NULL;
+    *size_copied = 0;
+
+    return_code = OS_QueueGetToken(queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue       = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+        return_code = OS_QueueGetRef_Impl(&token, data_ptr, size_copied, timeout);
+        OS_QueueStatsGet(queue, return_code, 1);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueRelease(osal_id_t queue_id, const void *data_ptr)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data_ptr);
+
+    return_code = OS_QueueGetToken(queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_QueueRelease_Impl(&token, data_ptr);
+
+        OS_ObjectIdRelease(&token);
     }
 
     return return_code;
@@ -269,3 +1119,70 @@ int32 OS_QueueGetInfo(osal_id_t queue_id, OS_queue_prop_t *queue_prop)
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetStats(osal_id_t queue_id, OS_queue_stats_t *stats)
+{
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue  = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+        *stats = queue->stats;
+
+        /* A get may be counted before the put of the same message completes */
+        if ((int32)stats->depth < 0)
+        {
+            stats->depth = 0;
+        }
+    }
+
+    return return_code;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueResetStats(osal_id_t queue_id)
+{
+#ifdef OSAL_CONFIG_QUEUE_STATS
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    uint32                      depth;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        /* the depth reflects the content of the queue, so it is preserved */
+        depth = __atomic_load_n(&queue->stats.depth, __ATOMIC_RELAXED);
+        memset(&queue->stats, 0, sizeof(queue->stats));
+        queue->stats.depth           = depth;
+        queue->stats.high_water_mark = depth;
+    }
+
+    return return_code;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
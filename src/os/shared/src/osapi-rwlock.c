@@ -61,7 +61,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_RWLOCK
 };
 
-OS_rwlock_internal_record_t OS_rwlock_table[LOCAL_NUM_OBJECTS];
+OS_rwlock_internal_record_t *OS_rwlock_table;
 
 /****************************************************************************************
                                   RWLOCK API
@@ -75,8 +75,7 @@ OS_rwlock_internal_record_t OS_rwlock_table[LOCAL_NUM_OBJECTS];
  *-----------------------------------------------------------------*/
 int32 OS_RwLockAPI_Init(void)
 {
-    memset(OS_rwlock_table, 0, sizeof(OS_rwlock_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_rwlock_table);
 }
 
 /*----------------------------------------------------------------
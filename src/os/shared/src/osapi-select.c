@@ -42,6 +42,29 @@
 #include "os-shared-idmap.h"
 #include "os-shared-select.h"
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *           Determines whether the given ID is a queue or a stream, and its
+ *           index within the OS_FdSet bitmap for that type.  Queue IDs are held
+ *           separately from stream IDs, as they have their own index space.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_SelectFdLocate(osal_id_t objid, bool *is_queue, osal_index_t *local_id)
+{
+    osal_objtype_t objtype;
+
+    objtype   = OS_IdentifyObject(objid);
+    *is_queue = (objtype == OS_OBJECT_TYPE_OS_QUEUE);
+    if (!*is_queue)
+    {
+        objtype = OS_OBJECT_TYPE_OS_STREAM;
+    }
+
+    return OS_ObjectIdToArrayIndex(objtype, objid, local_id);
+}
+
 /*
  *********************************************************************************
  *          SELECT API
@@ -146,19 +169,22 @@ int32 OS_SelectFdAdd(OS_FdSet *Set, osal_id_t objid)
 {
     int32        return_code;
     osal_index_t local_id;
+    bool         is_queue;
+    uint8 *      bitmap;
 
     /* check parameters */
     OS_CHECK_POINTER(Set);
 
-    return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+    return_code = OS_SelectFdLocate(objid, &is_queue, &local_id);
     if (return_code == OS_SUCCESS)
     {
         /*
-         * Sets the bit in the uint8 object_ids array that corresponds
+         * Sets the bit in the uint8 bitmap array that corresponds
          * to the local_id where local_id >> 3 determines the array element,
          * and the mask/shift sets the bit within that element.
          */
-        Set->object_ids[local_id >> 3] |= 1 << (local_id & 0x7);
+        bitmap = is_queue ? Set->queue_ids : Set->object_ids;
+        bitmap[local_id >> 3] |= 1 << (local_id & 0x7);
     }
 
     return return_code;
@@ -174,19 +200,22 @@ int32 OS_SelectFdClear(OS_FdSet *Set, osal_id_t objid)
 {
     int32        return_code;
     osal_index_t local_id;
+    bool         is_queue;
+    uint8 *      bitmap;
 
     /* check parameters */
     OS_CHECK_POINTER(Set);
 
-    return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+    return_code = OS_SelectFdLocate(objid, &is_queue, &local_id);
     if (return_code == OS_SUCCESS)
     {
         /*
-         * Clears the bit in the uint8 object_ids array that corresponds
+         * Clears the bit in the uint8 bitmap array that corresponds
          * to the local_id where local_id >> 3 determines the array element,
          * and the mask/shift clears the bit within that element.
          */
-        Set->object_ids[local_id >> 3] &= ~(1 << (local_id & 0x7));
+        bitmap = is_queue ? Set->queue_ids : Set->object_ids;
+        bitmap[local_id >> 3] &= ~(1 << (local_id & 0x7));
     }
 
     return return_code;
@@ -202,20 +231,23 @@ bool OS_SelectFdIsSet(const OS_FdSet *Set, osal_id_t objid)
 {
     int32        return_code;
     osal_index_t local_id;
+    bool         is_queue;
+    const uint8 *bitmap;
 
     /* check parameters */
     BUGCHECK(Set != NULL, false);
 
-    return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &local_id);
+    return_code = OS_SelectFdLocate(objid, &is_queue, &local_id);
     if (return_code != OS_SUCCESS)
     {
         return false;
     }
 
     /*
-     * Returns boolean for if the bit in the uint8 object_ids array that corresponds
+     * Returns boolean for if the bit in the uint8 bitmap array that corresponds
      * to the local_id is set where local_id >> 3 determines the array element,
      * and the mask/shift checks the bit within that element.
      */
-    return ((Set->object_ids[local_id >> 3] >> (local_id & 0x7)) & 0x1);
+    bitmap = is_queue ? Set->queue_ids : Set->object_ids;
+    return ((bitmap[local_id >> 3] >> (local_id & 0x7)) & 0x1);
 }
@@ -59,7 +59,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_TASK
 };
 
-OS_task_internal_record_t OS_task_table[LOCAL_NUM_OBJECTS];
+OS_task_internal_record_t *OS_task_table;
 
 /*----------------------------------------------------------------
  *
@@ -151,8 +151,7 @@ void OS_TaskEntryPoint(osal_id_t task_id)
  *-----------------------------------------------------------------*/
 int32 OS_TaskAPI_Init(void)
 {
-    memset(OS_task_table, 0, sizeof(OS_task_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_task_table);
 }
 
 /*----------------------------------------------------------------
@@ -52,7 +52,7 @@
 #error "osconfig.h must define OS_MAX_TIMERS to a valid value"
 #endif
 
-OS_timecb_internal_record_t OS_timecb_table[OS_MAX_TIMERS];
+OS_timecb_internal_record_t *OS_timecb_table;
 
 typedef union
 {
@@ -72,8 +72,7 @@ typedef union
  *-----------------------------------------------------------------*/
 int32 OS_TimerCbAPI_Init(void)
 {
-    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TIMECB, OS_timecb_table);
 }
 
 /*----------------------------------------------------------------
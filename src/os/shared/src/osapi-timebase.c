@@ -60,7 +60,7 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_TIMEBASE
 };
 
-OS_timebase_internal_record_t OS_timebase_table[OS_MAX_TIMEBASES];
+OS_timebase_internal_record_t *OS_timebase_table;
 
 /*
  * Limit to the number of times that the OS timebase servicing thread
@@ -80,8 +80,7 @@ OS_timebase_internal_record_t OS_timebase_table[OS_MAX_TIMEBASES];
  *-----------------------------------------------------------------*/
 int32 OS_TimeBaseAPI_Init(void)
 {
-    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(LOCAL_OBJID_TYPE, OS_timebase_table);
 }
 
 /*----------------------------------------------------------------
@@ -39,6 +39,6 @@ typedef struct
     TASK_ID taskid;
 } OS_impl_console_internal_record_t;
 
-extern OS_impl_console_internal_record_t OS_impl_console_table[OS_MAX_CONSOLES];
+extern OS_impl_console_internal_record_t *OS_impl_console_table;
 
 #endif /* OS_IMPL_CONSOLE_H */
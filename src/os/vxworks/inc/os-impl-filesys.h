@@ -38,6 +38,6 @@ typedef struct
     uint32   xbdMaxPartitions;
 } OS_impl_filesys_internal_record_t;
 
-extern OS_impl_filesys_internal_record_t OS_impl_filesys_table[OS_MAX_FILE_SYSTEMS];
+extern OS_impl_filesys_internal_record_t *OS_impl_filesys_table;
 
 #endif /* OS_IMPL_FILESYS_H */
@@ -44,7 +44,7 @@ typedef struct
  * This table is shared across multiple units (files, sockets, etc) and they will share
  * the same file handle table from the basic file I/O.
  */
-extern OS_impl_file_internal_record_t OS_impl_filehandle_table[OS_MAX_NUM_OPEN_FILES];
+extern OS_impl_file_internal_record_t *OS_impl_filehandle_table;
 
 /*
  * VxWorks needs to cast the argument to "write()" to avoid a warning.
@@ -47,6 +47,6 @@ typedef struct
  * If neither loading nor symbol lookups are desired then this file
  * shouldn't be used at all -- a no-op version should be used instead.
  */
-extern OS_impl_module_internal_record_t OS_impl_module_table[OS_MAX_MODULES];
+extern OS_impl_module_internal_record_t *OS_impl_module_table;
 
 #endif /* OS_IMPL_LOADER_H */
@@ -35,6 +35,6 @@ typedef struct
 } OS_impl_queue_internal_record_t;
 
 /* Tables where the OS object information is stored */
-extern OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
+extern OS_impl_queue_internal_record_t *OS_impl_queue_table;
 
 #endif /* OS_IMPL_QUEUES_H */
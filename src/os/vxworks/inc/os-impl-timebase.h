@@ -57,6 +57,6 @@ typedef struct
                                    GLOBAL DATA
  ***************************************************************************************/
 
-extern OS_impl_timebase_internal_record_t OS_impl_timebase_table[OS_MAX_TIMEBASES];
+extern OS_impl_timebase_internal_record_t *OS_impl_timebase_table;
 
 #endif /* OS_IMPL_TIMEBASE_H */
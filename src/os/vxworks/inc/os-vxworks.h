@@ -66,6 +66,8 @@ int32 OS_VxWorks_TimeBaseAPI_Impl_Init(void);
 int32 OS_VxWorks_ModuleAPI_Impl_Init(void);
 int32 OS_VxWorks_StreamAPI_Impl_Init(void);
 int32 OS_VxWorks_DirAPI_Impl_Init(void);
+int32 OS_VxWorks_FileSysAPI_Impl_Init(void);
+int32 OS_VxWorks_ConsoleAPI_Impl_Init(void);
 
 int OS_VxWorks_TaskEntry(int arg);
 int OS_VxWorks_ConsoleTask_Entry(int arg);
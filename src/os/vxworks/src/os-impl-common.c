@@ -96,6 +96,12 @@ int32 OS_API_Impl_Init(osal_objtype_t idtype)
         case OS_OBJECT_TYPE_OS_DIR:
             return_code = OS_VxWorks_DirAPI_Impl_Init();
             break;
+        case OS_OBJECT_TYPE_OS_FILESYS:
+            return_code = OS_VxWorks_FileSysAPI_Impl_Init();
+            break;
+        case OS_OBJECT_TYPE_OS_CONSOLE:
+            return_code = OS_VxWorks_ConsoleAPI_Impl_Init();
+            break;
         default:
             break;
     }
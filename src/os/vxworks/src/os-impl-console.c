@@ -52,12 +52,22 @@
 ****************************************************************************************/
 
 /* Tables where the OS object information is stored */
-OS_impl_console_internal_record_t OS_impl_console_table[OS_MAX_CONSOLES];
+OS_impl_console_internal_record_t *OS_impl_console_table;
 
 /********************************************************************/
 /*                 CONSOLE OUTPUT                                   */
 /********************************************************************/
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_VxWorks_ConsoleAPI_Impl_Init(void)
+{
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_CONSOLE, OS_impl_console_table);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
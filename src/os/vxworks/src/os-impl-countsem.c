@@ -41,7 +41,7 @@
 ****************************************************************************************/
 
 /* Tables where the OS object information is stored */
-OS_impl_countsem_internal_record_t OS_impl_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
+OS_impl_countsem_internal_record_t *OS_impl_count_sem_table;
 
 /****************************************************************************************
                              COUNTING SEMAPHORE API
@@ -54,8 +54,7 @@ OS_impl_countsem_internal_record_t OS_impl_count_sem_table[OS_MAX_COUNT_SEMAPHOR
  *-----------------------------------------------------------------*/
 int32 OS_VxWorks_CountSemAPI_Impl_Init(void)
 {
-    memset(OS_impl_count_sem_table, 0, sizeof(OS_impl_count_sem_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_COUNTSEM, OS_impl_count_sem_table);
 }
 
 /*----------------------------------------------------------------
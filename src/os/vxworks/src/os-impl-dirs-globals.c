@@ -30,11 +30,12 @@
 #include "os-vxworks.h"
 #include "os-impl-dirs.h"
 #include "os-shared-dir.h"
+#include "os-shared-idmap.h"
 
 /*
  * The directory handle table.
  */
-OS_impl_dir_internal_record_t OS_impl_dir_table[OS_MAX_NUM_OPEN_DIRS];
+OS_impl_dir_internal_record_t *OS_impl_dir_table;
 
 /*----------------------------------------------------------------
  *
@@ -43,6 +44,5 @@ OS_impl_dir_internal_record_t OS_impl_dir_table[OS_MAX_NUM_OPEN_DIRS];
  *-----------------------------------------------------------------*/
 int32 OS_VxWorks_DirAPI_Impl_Init(void)
 {
-    memset(OS_impl_dir_table, 0, sizeof(OS_impl_dir_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_DIR, OS_impl_dir_table);
 }
@@ -61,12 +61,22 @@
                                    GLOBAL DATA
  ***************************************************************************************/
 
-OS_impl_filesys_internal_record_t OS_impl_filesys_table[OS_MAX_FILE_SYSTEMS];
+OS_impl_filesys_internal_record_t *OS_impl_filesys_table;
 
 /****************************************************************************************
                                     Filesys API
 ****************************************************************************************/
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_VxWorks_FileSysAPI_Impl_Init(void)
+{
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_FILESYS, OS_impl_filesys_table);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
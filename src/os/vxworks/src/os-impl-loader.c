@@ -39,7 +39,7 @@
 #include <unistd.h>
 #include <fcntl.h>
 
-OS_impl_module_internal_record_t OS_impl_module_table[OS_MAX_MODULES];
+OS_impl_module_internal_record_t *OS_impl_module_table;
 
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
@@ -52,8 +52,7 @@ OS_impl_module_internal_record_t OS_impl_module_table[OS_MAX_MODULES];
  *-----------------------------------------------------------------*/
 int32 OS_VxWorks_ModuleAPI_Impl_Init(void)
 {
-    memset(&OS_impl_module_table, 0, sizeof(OS_impl_module_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_MODULE, OS_impl_module_table);
 }
 
 /****************************************************************************************
@@ -39,7 +39,7 @@
 ****************************************************************************************/
 
 /* Console device */
-OS_impl_mutsem_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
+OS_impl_mutsem_internal_record_t *OS_impl_mutex_table;
 
 /****************************************************************************************
                                   MUTEX API
@@ -52,8 +52,7 @@ OS_impl_mutsem_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
  *-----------------------------------------------------------------*/
 int32 OS_VxWorks_MutexAPI_Impl_Init(void)
 {
-    memset(OS_impl_mutex_table, 0, sizeof(OS_impl_mutex_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_MUTEX, OS_impl_mutex_table);
 }
 
 /*----------------------------------------------------------------
@@ -35,7 +35,7 @@
 /****************************************************************************************
                                    GLOBAL DATA
 ****************************************************************************************/
-OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
+OS_impl_queue_internal_record_t *OS_impl_queue_table;
 
 /****************************************************************************************
                                 MESSAGE QUEUE API
@@ -48,8 +48,7 @@ OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
  *-----------------------------------------------------------------*/
 int32 OS_VxWorks_QueueAPI_Impl_Init(void)
 {
-    memset(OS_impl_queue_table, 0, sizeof(OS_impl_queue_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_QUEUE, OS_impl_queue_table);
 }
 
 /*----------------------------------------------------------------
@@ -109,6 +108,18 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueDeletePending_Impl(const OS_object_token_t *token, bool pending)
+{
+    /* Deleting the message queue wakes the tasks waiting on it, so nothing is needed beforehand */
+    return OS_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -170,6 +181,21 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetWithPriority_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied,
+                                   uint32 *priority, int32 timeout)
+{
+    /* The priority of a message is not recorded by the OS */
+    *priority = 0;
+
+    return OS_QueueGet_Impl(token, data, size, size_copied, timeout);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -177,16 +203,61 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
  *
  *-----------------------------------------------------------------*/
 int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags)
+{
+    return OS_QueuePutTimed_Impl(token, data, size, flags, OS_CHECK);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutTimed_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags,
+                            int32 timeout)
 {
     int32                            return_code;
+    int                              ticks;
+    int                              msg_pri;
     OS_impl_queue_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
-    if (msgQSend(impl->vxid, (void *)data, size, NO_WAIT, MSG_PRI_NORMAL) == OK)
+    /* Only normal and urgent messages are distinguished, urgent ones go to the front of the queue */
+    if (OS_QUEUE_FLAGS_PRIORITY(flags) != 0)
+    {
+        msg_pri = MSG_PRI_URGENT;
+    }
+    else
+    {
+        msg_pri = MSG_PRI_NORMAL;
+    }
+
+    if (timeout == OS_PEND)
+    {
+        ticks = WAIT_FOREVER;
+    }
+    else if (timeout == OS_CHECK)
+    {
+        ticks = NO_WAIT;
+    }
+    else
+    {
+        /* msecs rounded to the closest system tick count if possible */
+        if (OS_Milli2Ticks(timeout, &ticks) != OS_SUCCESS)
+        {
+            return OS_ERROR;
+        }
+    }
+
+    if (msgQSend(impl->vxid, (void *)data, size, ticks, msg_pri) == OK)
     {
         return_code = OS_SUCCESS;
     }
+    else if (errno == S_objLib_OBJ_TIMEOUT)
+    {
+        return_code = OS_QUEUE_TIMEOUT;
+    }
     else if (errno == S_objLib_OBJ_UNAVAILABLE)
     {
         return_code = OS_QUEUE_FULL;
@@ -200,6 +271,71 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePutMultiple_Impl(const OS_object_token_t *token, const void *data, size_t size, const size_t *sizes,
+                               uint32 count, uint32 flags, uint32 *count_put)
+{
+    int32  return_code;
+    uint32 i;
+
+    /* The OS queue can only accept one message per call */
+    return_code = OS_SUCCESS;
+    for (i = 0; i < count; ++i)
+    {
+        return_code = OS_QueuePut_Impl(token, (const uint8 *)data + (i * size), sizes[i], flags);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    *count_put = i;
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetMultiple_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *sizes,
+                               uint32 max_count, uint32 *count_copied, int32 timeout)
+{
+    int32  return_code;
+    uint32 i;
+
+    /* The OS queue can only deliver one message per call, only the first may wait */
+    i           = 0;
+    return_code = OS_QueueGet_Impl(token, data, size, &sizes[0], timeout);
+    while (return_code == OS_SUCCESS)
+    {
+        ++i;
+        if (i >= max_count)
+        {
+            break;
+        }
+
+        return_code = OS_QueueGet_Impl(token, (uint8 *)data + (i * size), size, &sizes[i], OS_CHECK);
+    }
+
+    *count_copied = i;
+
+    /* Running out of messages after the first one is not an error */
+    if (i > 0)
+    {
+        return_code = OS_SUCCESS;
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -70,7 +70,7 @@
 ****************************************************************************************/
 
 /* Tables where the OS object information is stored */
-OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
+OS_impl_task_internal_record_t *OS_impl_task_table;
 
 /*---------------------------------------------------------------------------------------
    Name: OS_VxWorksEntry
@@ -98,8 +98,7 @@ int OS_VxWorks_TaskEntry(int arg)
  *-----------------------------------------------------------------*/
 int32 OS_VxWorks_TaskAPI_Impl_Init(void)
 {
-    memset(OS_impl_task_table, 0, sizeof(OS_impl_task_table));
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TASK, OS_impl_task_table);
 }
 
 /*----------------------------------------------------------------
@@ -399,7 +398,7 @@ osal_id_t OS_TaskGetId_Impl(void)
     if (lrec != NULL)
     {
         idx = (OS_impl_task_internal_record_t *)lrec - &OS_impl_task_table[0];
-        if (idx < OS_MAX_TASKS)
+        if (idx < OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_TASK))
         {
             id = OS_global_task_table[idx].active_id;
         }
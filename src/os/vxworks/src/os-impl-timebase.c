@@ -77,7 +77,7 @@
                                    GLOBAL DATA
 ****************************************************************************************/
 
-OS_impl_timebase_internal_record_t OS_impl_timebase_table[OS_MAX_TIMEBASES];
+OS_impl_timebase_internal_record_t *OS_impl_timebase_table;
 
 static uint32 OS_ClockAccuracyNsec;
 
@@ -317,7 +317,7 @@ int32 OS_VxWorks_TimeBaseAPI_Impl_Init(void)
      */
     OS_SharedGlobalVars.MicroSecPerTick = (OS_ClockAccuracyNsec + 500) / 1000;
 
-    return OS_SUCCESS;
+    return OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TIMEBASE, OS_impl_timebase_table);
 }
 
 /****************************************************************************************
@@ -375,7 +375,7 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
          */
         sigemptyset(&inuse);
 
-        for (idx = 0; idx < OS_MAX_TIMEBASES; ++idx)
+        for (idx = 0; idx < OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_TIMEBASE); ++idx)
         {
             if (OS_ObjectIdIsValid(OS_global_timebase_table[idx].active_id) &&
                 OS_impl_timebase_table[idx].assigned_signal > 0)
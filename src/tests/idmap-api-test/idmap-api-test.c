@@ -332,6 +332,25 @@ void Test_OS_ForEachObject(void)
     UtAssert_True(Count.TimeBaseCount == 0, "OS_ForEachObject() TimeBaseCount (%lu) == 1",
                   (unsigned long)Count.TimeBaseCount);
 
+    /* The non-blocking variants should find the same objects */
+    memset(&Count, 0, sizeof(Count));
+    OS_ForEachObjectNonBlocking(OS_OBJECT_CREATOR_ANY, &ObjTypeCounter, &Count);
+    UtAssert_UINT32_EQ(Count.TaskCount, 0);
+    UtAssert_UINT32_EQ(Count.QueueCount, 1);
+    UtAssert_UINT32_EQ(Count.CountSemCount, 1);
+    UtAssert_UINT32_EQ(Count.BinSemCount, 2);
+    UtAssert_UINT32_EQ(Count.MutexCount, 3);
+    UtAssert_UINT32_EQ(Count.TimeBaseCount, 1);
+
+    memset(&Count, 0, sizeof(Count));
+    OS_ForEachObjectOfTypeNonBlocking(OS_OBJECT_TYPE_OS_MUTEX, OS_OBJECT_CREATOR_ANY, &ObjTypeCounter, &Count);
+    UtAssert_UINT32_EQ(Count.BinSemCount, 0);
+    UtAssert_UINT32_EQ(Count.MutexCount, 3);
+
+    memset(&Count, 0, sizeof(Count));
+    OS_ForEachObjectNonBlocking(task_id, &ObjTypeCounter, &Count);
+    UtAssert_UINT32_EQ(Count.BinSemCount, 1);
+
     /*
      * Pass an invalid input, and verify that object counts are not increased
      */
@@ -419,6 +438,38 @@ void Test_OS_GetResourceName(void)
     UtAssert_INT32_EQ(OS_GetResourceName(queue_id, name, 0), OS_ERR_INVALID_SIZE);
 }
 
+void Test_OS_GetObjectTypeLockStats(void)
+{
+    /*
+     * Test case for:
+     * int32 OS_GetObjectTypeLockStats(osal_objtype_t objtype, OS_lock_stats_t *stats)
+     */
+    OS_lock_stats_t stats;
+    int32           status;
+
+    memset(&stats, 0, sizeof(stats));
+
+    status = OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_OS_MUTEX, &stats);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Object lock statistics not enabled in this build");
+        return;
+    }
+
+    /* Nominal case - the mutexes created during setup must have locked the table */
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_True(stats.acquisitions > 0, "acquisitions (%lu) > 0", (unsigned long)stats.acquisitions);
+    UtAssert_True(stats.contended_acquisitions <= stats.acquisitions, "contended (%lu) <= acquisitions (%lu)",
+                  (unsigned long)stats.contended_acquisitions, (unsigned long)stats.acquisitions);
+    UtAssert_True(OS_TimeCompare(stats.max_wait_time, stats.total_wait_time) <= 0, "max wait <= total wait");
+    UtAssert_True(OS_TimeCompare(stats.max_hold_time, stats.total_hold_time) <= 0, "max hold <= total hold");
+
+    /* Error cases */
+    UtAssert_INT32_EQ(OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_OS_MUTEX, NULL), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_UNDEFINED, &stats), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_USER, &stats), OS_ERR_INVALID_ID);
+}
+
 void UtTest_Setup(void)
 {
     if (OS_API_Init() != OS_SUCCESS)
@@ -438,4 +489,5 @@ void UtTest_Setup(void)
     UtTest_Add(Test_OS_ObjectIdToArrayIndex, NULL, NULL, "OS_ObjectIdToArrayIndex");
     UtTest_Add(Test_OS_GetResourceName, NULL, NULL, "OS_GetResourceName");
     UtTest_Add(Test_OS_ForEachObject, NULL, NULL, "OS_ForEachObject");
+    UtTest_Add(Test_OS_GetObjectTypeLockStats, NULL, NULL, "OS_GetObjectTypeLockStats");
 }
@@ -0,0 +1,214 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** I/O Speed Test
+**
+** This is a simple way to gauge the overhead of the OSAL
+** object table on I/O calls made concurrently by several
+** tasks, which may be running on different processors.
+**
+** Each task opens its own file and repeatedly seeks it,
+** which is about the lightest call that still has to look
+** up and hold a reference on the file object.  The files are
+** opened consecutively, so their object records are adjacent
+** in the common table.  No data is shared between the tasks,
+** so any scaling limits are due to contention within OSAL.
+**
+** The tasks run continuously for 2 seconds.
+**
+** At the end of the test, the number of calls made by each
+** task is indicated.  Higher numbers indicate better performance.
+** Comparing a build with OSAL_CONFIG_CACHE_ALIGNED_OBJECTS enabled
+** against one without shows the effect of false sharing between
+** the records.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Note the worker priority must be lower than that of
+ * the executive (init) task.  Otherwise, the IoRun()
+ * function may never get CPU time to stop the test.
+ */
+#define IOTEST_TASK_PRIORITY 150
+
+/* The number of concurrent workers */
+#define IOTEST_NUM_TASKS 4
+
+/* The duration of the test */
+#define IOTEST_RUN_MSEC 2000
+
+/*
+ * A limit for the maximum amount of iterations that
+ * each task will perform.  This prevents the test from
+ * running infinitely in case the stop flag is not seen.
+ */
+#define IOTEST_WORK_LIMIT 0x7FFFFFFF
+
+/* Define setup and test functions for UT assert */
+void IoSetup(void);
+void IoRun(void);
+
+typedef struct
+{
+    osal_id_t task_id;
+    osal_id_t fd;
+    uint32    work;
+    bool      done;
+} iotest_task_state_t;
+
+iotest_task_state_t task_states[IOTEST_NUM_TASKS];
+
+volatile bool iotest_stop;
+
+void io_worker(uint32 my_num)
+{
+    iotest_task_state_t *my_state;
+    uint32               work;
+    int32                status;
+
+    my_state = &task_states[my_num];
+    work     = 0;
+
+    OS_printf("Starting task %u\n", (unsigned int)(my_num + 1));
+
+    /* the count is kept locally, so the tasks do not share any data while running */
+    while (!iotest_stop && work < IOTEST_WORK_LIMIT)
+    {
+        status = OS_lseek(my_state->fd, 0, OS_SEEK_SET);
+        if (status < OS_SUCCESS)
+        {
+            OS_printf("TASK %u: Error calling OS_lseek: %d\n", (unsigned int)(my_num + 1), (int)status);
+            break;
+        }
+
+        ++work;
+    }
+
+    my_state->work = work;
+    my_state->done = true;
+}
+
+void task_1(void)
+{
+    io_worker(0);
+}
+
+void task_2(void)
+{
+    io_worker(1);
+}
+
+void task_3(void)
+{
+    io_worker(2);
+}
+
+void task_4(void)
+{
+    io_worker(3);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(IoRun, IoSetup, NULL, "IoSpeedTest");
+}
+
+void IoSetup(void)
+{
+    osal_task_entry task_entry_points[IOTEST_NUM_TASKS] = {task_1, task_2, task_3, task_4};
+    char            name[OS_MAX_PATH_LEN];
+    uint32          i;
+
+    memset(task_states, 0, sizeof(task_states));
+    iotest_stop = false;
+
+    UtAssert_INT32_EQ(OS_mkfs(0, "/ramdev0", "RAM", OSAL_SIZE_C(512), OSAL_BLOCKCOUNT_C(200)), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_mount("/ramdev0", "/drive0"), OS_SUCCESS);
+
+    /*
+    ** Open a file for each task
+    */
+    for (i = 0; i < IOTEST_NUM_TASKS; ++i)
+    {
+        snprintf(name, sizeof(name), "/drive0/io%u", (unsigned int)(i + 1));
+        UtAssert_INT32_EQ(OS_OpenCreate(&task_states[i].fd, name, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                                        OS_READ_WRITE),
+                          OS_SUCCESS);
+    }
+
+    /*
+    ** Create the tasks
+    */
+    for (i = 0; i < IOTEST_NUM_TASKS; ++i)
+    {
+        snprintf(name, sizeof(name), "Task %u", (unsigned int)(i + 1));
+        UtAssert_INT32_EQ(OS_TaskCreate(&task_states[i].task_id, name, task_entry_points[i], OSAL_TASK_STACK_ALLOCATE,
+                                        OSAL_SIZE_C(4096), OSAL_PRIORITY_C(IOTEST_TASK_PRIORITY), 0),
+                          OS_SUCCESS);
+    }
+}
+
+void IoRun(void)
+{
+    uint32 total;
+    uint32 i;
+
+    /* Time Limited Execution */
+    OS_TaskDelay(IOTEST_RUN_MSEC);
+
+    /* Ask the tasks to stop, and allow them time to do so */
+    iotest_stop = true;
+    OS_TaskDelay(100);
+
+    total = 0;
+    for (i = 0; i < IOTEST_NUM_TASKS; ++i)
+    {
+        UtAssert_True(task_states[i].done, "Task %u finished", (unsigned int)(i + 1));
+
+        /* each task should have executed */
+        UtAssert_True(task_states[i].work != 0, "Task %u work counter = %u", (unsigned int)(i + 1),
+                      (unsigned int)task_states[i].work);
+        total += task_states[i].work;
+
+        UtAssert_INT32_EQ(OS_close(task_states[i].fd), OS_SUCCESS);
+    }
+
+    UtPrintf("Total calls = %u, %u per second\n", (unsigned int)total,
+             (unsigned int)(total / (IOTEST_RUN_MSEC / 1000)));
+
+    UtAssert_INT32_EQ(OS_unmount("/drive0"), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_rmfs("/ramdev0"), OS_SUCCESS);
+}
@@ -0,0 +1,215 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Queue Speed Test
+**
+** This is a simple way to gauge the performance of the
+** OSAL message queue implementation on a given machine.
+**
+** This implements a flip-flop between two tasks using
+** two queues.  Task 1 gets a message from queue 1 and
+** puts it on queue 2, while task 2 gets a message from
+** queue 2 and puts it on queue 1.  Several messages are
+** in circulation, so a task does not always need to
+** pend for the next one to arrive.
+**
+** The two tasks will run continuously, passing messages
+** between them, for 2 seconds.
+**
+** At the end of the test, the total number of "work"
+** cycles for each task is indicated.  Higher numbers
+** indicate better performance.  Setting QTEST_FLAGS to
+** OS_QUEUE_FLAG_LOCAL in a build where the default is
+** the system queue compares the two implementations.
+** Each queue has a single producer and consumer, so
+** OS_QUEUE_FLAG_SPSC may also be used.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Note the worker priority must be lower than that of
+ * the executive (init) task.  Otherwise, the QueueRun()
+ * function may never get CPU time to stop the test.
+ */
+#define QTEST_TASK_PRIORITY 150
+
+/*
+ * A limit for the maximum amount
+ * of iterations that this test will
+ * perform.  This prevents the test
+ * from running infinitely in case the
+ * time-based stop routine does not
+ * work correctly.  See note above
+ * about priority requirements.
+ */
+#define QTEST_WORK_LIMIT 100000000
+
+/* The duration of the test */
+#define QTEST_RUN_MSEC 2000
+
+/* The number of messages passed back and forth */
+#define QTEST_NUM_MESSAGES 4
+
+/* The flags passed to OS_QueueCreate() */
+#define QTEST_FLAGS 0
+
+/* Define setup and test functions for UT assert */
+void QueueSetup(void);
+void QueueRun(void);
+
+typedef struct
+{
+    uint32 seq;
+    uint32 payload[3];
+} qtest_message_t;
+
+osal_id_t task_1_id;
+uint32    task_1_work;
+
+osal_id_t task_2_id;
+uint32    task_2_work;
+
+osal_id_t queue_id_1;
+osal_id_t queue_id_2;
+
+void queue_worker(const char *name, osal_id_t get_id, osal_id_t put_id, uint32 *work)
+{
+    qtest_message_t msg;
+    size_t          size;
+    int32           status;
+
+    OS_printf("Starting %s\n", name);
+
+    while (*work < QTEST_WORK_LIMIT)
+    {
+        status = OS_QueueGet(get_id, &msg, sizeof(msg), &size, OS_PEND);
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("%s: Error calling OS_QueueGet: %d\n", name, (int)status);
+            break;
+        }
+
+        ++(*work);
+        ++msg.seq;
+
+        status = OS_QueuePut(put_id, &msg, sizeof(msg), 0);
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("%s: Error calling OS_QueuePut: %d\n", name, (int)status);
+            break;
+        }
+    }
+}
+
+void task_1(void)
+{
+    queue_worker("TASK 1", queue_id_1, queue_id_2, &task_1_work);
+}
+
+void task_2(void)
+{
+    queue_worker("TASK 2", queue_id_2, queue_id_1, &task_2_work);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(QueueRun, QueueSetup, NULL, "QueueSpeedTest");
+}
+
+void QueueSetup(void)
+{
+    task_1_work = 0;
+    task_2_work = 0;
+
+    /*
+    ** Create the queues, each deep enough to hold all the messages
+    */
+    UtAssert_INT32_EQ(OS_QueueCreate(&queue_id_1, "Queue1", OSAL_BLOCKCOUNT_C(QTEST_NUM_MESSAGES),
+                                     sizeof(qtest_message_t), QTEST_FLAGS),
+                      OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_QueueCreate(&queue_id_2, "Queue2", OSAL_BLOCKCOUNT_C(QTEST_NUM_MESSAGES),
+                                     sizeof(qtest_message_t), QTEST_FLAGS),
+                      OS_SUCCESS);
+
+    /*
+    ** Create the tasks
+    */
+    UtAssert_INT32_EQ(OS_TaskCreate(&task_1_id, "Task 1", task_1, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                                    OSAL_PRIORITY_C(QTEST_TASK_PRIORITY), 0),
+                      OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TaskCreate(&task_2_id, "Task 2", task_2, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                                    OSAL_PRIORITY_C(QTEST_TASK_PRIORITY), 0),
+                      OS_SUCCESS);
+
+    /* A small delay just to allow the tasks
+     * to start and pend on the queues */
+    OS_TaskDelay(10);
+}
+
+void QueueRun(void)
+{
+    qtest_message_t msg;
+    uint32          i;
+
+    /* Put the initial messages that start the loop */
+    memset(&msg, 0, sizeof(msg));
+    for (i = 0; i < QTEST_NUM_MESSAGES; ++i)
+    {
+        UtAssert_INT32_EQ(OS_QueuePut(queue_id_1, &msg, sizeof(msg), 0), OS_SUCCESS);
+    }
+
+    /* Time Limited Execution */
+    OS_TaskDelay(QTEST_RUN_MSEC);
+
+    /*
+    ** Delete resources
+    **
+    ** NOTE: if the work limit was reached, the
+    ** OS_TaskDelete calls may return non-success.
+    */
+    UtAssert_INT32_EQ(OS_TaskDelete(task_1_id), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TaskDelete(task_2_id), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_QueueDelete(queue_id_1), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_QueueDelete(queue_id_2), OS_SUCCESS);
+
+    /* Task 1 and 2 should have both executed */
+    UtAssert_True(task_1_work != 0, "Task 1 work counter = %u", (unsigned int)task_1_work);
+    UtAssert_True(task_2_work != 0, "Task 2 work counter = %u", (unsigned int)task_2_work);
+
+    UtPrintf("Total messages = %u, %u per second\n", (unsigned int)(task_1_work + task_2_work),
+             (unsigned int)((task_1_work + task_2_work) / (QTEST_RUN_MSEC / 1000)));
+}
@@ -35,6 +35,9 @@ void QueueTimeoutCheck(void);
 #define MSGQ_TOTAL 10
 #define MSGQ_BURST 3
 
+/* Number of times the queue is deleted while in use */
+#define MSGQ_DELETE_ROUNDS 50
+
 /* Task 1 */
 #define TASK_1_STACK_SIZE 4096
 #define TASK_1_PRIORITY   101
@@ -48,7 +51,10 @@ uint32    task_1_timeouts;
 uint32    task_1_messages;
 uint32    task_2_stack[TASK_2_STACK_SIZE];
 osal_id_t task_2_id;
+uint32    task_2_failures;
+uint32    task_2_messages;
 osal_id_t msgq_id;
+bool      msgq_delete_done;
 
 uint32    timer_counter;
 osal_id_t timer_id;
@@ -100,6 +106,120 @@ void task_1(void)
     }
 }
 
+/*
+ * Producer and consumer for the delete test, which keep using the queue while it
+ * is deleted and created again.  Any error other than the queue having gone
+ * away (or being full) is a failure.
+ */
+void task_2_put(void)
+{
+    int32  status;
+    uint32 data = 0;
+
+    while (!msgq_delete_done && task_2_failures < 20)
+    {
+        status = OS_QueuePut(msgq_id, &data, sizeof(data), 0);
+        if (status == OS_SUCCESS)
+        {
+            ++data;
+        }
+        else if (status == OS_ERR_INVALID_ID || status == OS_QUEUE_FULL)
+        {
+            OS_TaskDelay(1);
+        }
+        else
+        {
+            ++task_2_failures;
+            OS_printf("TASK 2: Queue Put error: %d!\n", (int)status);
+        }
+    }
+}
+
+void task_1_get(void)
+{
+    int32  status;
+    size_t data_size;
+    uint32 data_received;
+
+    while (!msgq_delete_done && task_1_failures < 20)
+    {
+        status = OS_QueueGet(msgq_id, &data_received, sizeof(data_received), &data_size, OS_PEND);
+        if (status == OS_SUCCESS)
+        {
+            ++task_1_messages;
+        }
+        else if (status == OS_ERR_INVALID_ID)
+        {
+            OS_TaskDelay(1);
+        }
+        else
+        {
+            ++task_1_failures;
+            OS_printf("TASK 1: Queue Get error: %d!\n", (int)status);
+        }
+    }
+}
+
+void QueueDeleteCheck(void)
+{
+    int32  status;
+    uint32 i;
+
+    /*
+     * Each time, the consumer may be waiting on the queue or in the middle of
+     * getting a message, as may the producer putting one.  Deleting the queue
+     * must neither fail nor pull it out from under them.
+     */
+    for (i = 0; i < MSGQ_DELETE_ROUNDS; ++i)
+    {
+        OS_TaskDelay(5);
+
+        status = OS_QueueDelete(msgq_id);
+        UtAssert_True(status == OS_SUCCESS, "Queue delete %u Rc=%d", (unsigned int)i, (int)status);
+
+        status = OS_QueueCreate(&msgq_id, "MsgQ", OSAL_BLOCKCOUNT_C(MSGQ_DEPTH), OSAL_SIZE_C(MSGQ_SIZE), 0);
+        UtAssert_True(status == OS_SUCCESS, "MsgQ create %u Rc=%d", (unsigned int)i, (int)status);
+    }
+
+    /* The last queue is deleted with the consumer waiting on it, which wakes it up */
+    msgq_delete_done = true;
+    OS_TaskDelay(10);
+    status = OS_QueueDelete(msgq_id);
+    UtAssert_True(status == OS_SUCCESS, "Queue 1 delete Rc=%d", (int)status);
+    OS_TaskDelay(10);
+
+    status = OS_TaskDelete(task_1_id);
+    UtAssert_True(status == OS_SUCCESS || status == OS_ERR_INVALID_ID, "Task 1 delete Rc=%d", (int)status);
+    status = OS_TaskDelete(task_2_id);
+    UtAssert_True(status == OS_SUCCESS || status == OS_ERR_INVALID_ID, "Task 2 delete Rc=%d", (int)status);
+
+    /* None of the tasks should have any failures in their own counters */
+    UtAssert_True(task_1_failures == 0, "Task 1 failures = %u", (unsigned int)task_1_failures);
+    UtAssert_True(task_2_failures == 0, "Task 2 failures = %u", (unsigned int)task_2_failures);
+    UtAssert_True(task_1_messages != 0, "Task 1 messages = %u", (unsigned int)task_1_messages);
+}
+
+void QueueDeleteSetup(void)
+{
+    int32 status;
+
+    task_1_failures  = 0;
+    task_1_messages  = 0;
+    task_2_failures  = 0;
+    msgq_delete_done = false;
+
+    status = OS_QueueCreate(&msgq_id, "MsgQ", OSAL_BLOCKCOUNT_C(MSGQ_DEPTH), OSAL_SIZE_C(MSGQ_SIZE), 0);
+    UtAssert_True(status == OS_SUCCESS, "MsgQ create Id=%lx Rc=%d", OS_ObjectIdToInteger(msgq_id), (int)status);
+
+    status = OS_TaskCreate(&task_1_id, "Task 1", task_1_get, OSAL_STACKPTR_C(task_1_stack), sizeof(task_1_stack),
+                           OSAL_PRIORITY_C(TASK_1_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Task 1 create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_1_id), (int)status);
+
+    status = OS_TaskCreate(&task_2_id, "Task 2", task_2_put, OSAL_STACKPTR_C(task_2_stack), sizeof(task_2_stack),
+                           OSAL_PRIORITY_C(TASK_2_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Task 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_2_id), (int)status);
+}
+
 void QueueTimeoutCheck(void)
 {
     int32  status;
@@ -252,4 +372,5 @@ void UtTest_Setup(void)
      */
     UtTest_Add(QueueTimeoutCheck, QueueTimeoutSetup, NULL, "QueueTimeoutTest");
     UtTest_Add(QueueMessageCheck, QueueMessageSetup, NULL, "QueueMessageCheck");
+    UtTest_Add(QueueDeleteCheck, QueueDeleteSetup, NULL, "QueueDeleteCheck");
 }
@@ -54,6 +54,7 @@ osal_id_t s2_socket_id;
 osal_id_t c1_socket_id;
 osal_id_t c2_socket_id;
 osal_id_t bin_sem_id;
+osal_id_t queue_id;
 bool      networkImplemented = true;
 
 char filldata[16834];
@@ -186,6 +187,33 @@ void Server_Fn2(void)
     UtAssert_INT32_EQ(OS_close(connsock_id), OS_SUCCESS);
 }
 
+void Queue_Put_Fn(void)
+{
+    uint32 msg = 1;
+
+    /* Give the main task time to start waiting on the queue */
+    OS_TaskDelay(50);
+    UtAssert_INT32_EQ(OS_QueuePut(queue_id, &msg, sizeof(msg), 0), OS_SUCCESS);
+}
+
+void Queue_Select_Fn(void)
+{
+    OS_FdSet ReadSet;
+
+    /* Waits alongside the main task, so both must be woken by a single put */
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, queue_id);
+    UtAssert_INT32_EQ(OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT * 10), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, queue_id), true);
+}
+
+void Queue_Delete_Fn(void)
+{
+    /* Give the main task time to start waiting on the queue */
+    OS_TaskDelay(50);
+    UtAssert_INT32_EQ(OS_QueueDelete(queue_id), OS_SUCCESS);
+}
+
 void Setup_Single(void)
 {
     BinSemSetup();
@@ -408,6 +436,147 @@ void TestSelectMultipleWrite(void)
     UtAssert_INT32_EQ(OS_SelectFdIsSet(&WriteSet, c2_socket_id), true);
 }
 
+void TestSelectMultipleQueue(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectMultiple(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
+     * with a queue in the sets
+     */
+    OS_FdSet       ReadSet;
+    OS_FdSet       WriteSet;
+    osal_id_t      task_id;
+    osal_id_t      select_task_id;
+    OS_task_prop_t task_prop;
+    uint32         msg;
+    size_t         size_copied;
+    int32          status;
+    int32          delay;
+
+    UtAssert_INT32_EQ(OS_QueueCreate(&queue_id, "SelectQueue", OSAL_BLOCKCOUNT_C(2), sizeof(msg), 0), OS_SUCCESS);
+
+    OS_SelectFdZero(&WriteSet);
+    UtAssert_INT32_EQ(OS_SelectFdAdd(&WriteSet, queue_id), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectFdIsSet(&WriteSet, queue_id), true);
+
+    /* Check if queues are supported by this implementation */
+    status = OS_SelectMultiple(NULL, &WriteSet, UT_TIMEOUT);
+    if (status == OS_ERR_OPERATION_NOT_SUPPORTED)
+    {
+        UtAssert_NA("Queues not supported by OS_SelectMultiple");
+        UtAssert_INT32_EQ(OS_QueueDelete(queue_id), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_BinSemGive(bin_sem_id), OS_SUCCESS);
+        return;
+    }
+
+    /* An empty queue is writable */
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectFdIsSet(&WriteSet, queue_id), true);
+
+    /* An empty queue is not readable, nor is the socket while the server waits on the sem */
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, queue_id);
+    if (networkImplemented)
+    {
+        OS_SelectFdAdd(&ReadSet, c1_socket_id);
+    }
+    UtAssert_INT32_EQ(OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT), OS_ERROR_TIMEOUT);
+
+    /* A put from another task wakes the select */
+    UtAssert_INT32_EQ(OS_TaskCreate(&task_id, "QueuePut", Queue_Put_Fn, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(16384),
+                                    OSAL_PRIORITY_C(50), 0),
+                      OS_SUCCESS);
+
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, queue_id);
+    if (networkImplemented)
+    {
+        OS_SelectFdAdd(&ReadSet, c1_socket_id);
+    }
+    UtAssert_INT32_EQ(OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, queue_id), true);
+    if (networkImplemented)
+    {
+        UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, c1_socket_id), false);
+    }
+
+    while (OS_TaskGetInfo(task_id, &task_prop) == OS_SUCCESS)
+    {
+        OS_TaskDelay(10);
+    }
+
+    /* A full queue is not writable */
+    msg = 2;
+    UtAssert_INT32_EQ(OS_QueuePut(queue_id, &msg, sizeof(msg), 0), OS_SUCCESS);
+    OS_SelectFdZero(&WriteSet);
+    OS_SelectFdAdd(&WriteSet, queue_id);
+    UtAssert_INT32_EQ(OS_SelectMultiple(NULL, &WriteSet, UT_TIMEOUT), OS_ERROR_TIMEOUT);
+
+    UtAssert_INT32_EQ(OS_QueueGet(queue_id, &msg, sizeof(msg), &size_copied, OS_CHECK), OS_SUCCESS);
+    UtAssert_UINT32_EQ(msg, 1);
+    UtAssert_INT32_EQ(OS_QueueGet(queue_id, &msg, sizeof(msg), &size_copied, OS_CHECK), OS_SUCCESS);
+    UtAssert_UINT32_EQ(msg, 2);
+
+    UtAssert_INT32_EQ(OS_SelectFdClear(&WriteSet, queue_id), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectFdIsSet(&WriteSet, queue_id), false);
+
+    /* Two tasks waiting on the same queue are both woken by a put */
+    UtAssert_INT32_EQ(OS_TaskCreate(&select_task_id, "QueueSelect", Queue_Select_Fn, OSAL_TASK_STACK_ALLOCATE,
+                                    OSAL_SIZE_C(16384), OSAL_PRIORITY_C(50), 0),
+                      OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TaskCreate(&task_id, "QueuePut", Queue_Put_Fn, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(16384),
+                                    OSAL_PRIORITY_C(50), 0),
+                      OS_SUCCESS);
+
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, queue_id);
+    UtAssert_INT32_EQ(OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT * 10), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, queue_id), true);
+
+    /* The other task must not be left waiting until its timeout */
+    for (delay = 0; delay < UT_TIMEOUT && OS_TaskGetInfo(select_task_id, &task_prop) == OS_SUCCESS; delay += 10)
+    {
+        OS_TaskDelay(10);
+    }
+    UtAssert_True(OS_TaskGetInfo(select_task_id, &task_prop) != OS_SUCCESS, "Other selecting task woken");
+
+    while (OS_TaskGetInfo(select_task_id, &task_prop) == OS_SUCCESS ||
+           OS_TaskGetInfo(task_id, &task_prop) == OS_SUCCESS)
+    {
+        OS_TaskDelay(10);
+    }
+
+    UtAssert_INT32_EQ(OS_QueueGet(queue_id, &msg, sizeof(msg), &size_copied, OS_CHECK), OS_SUCCESS);
+    UtAssert_UINT32_EQ(msg, 1);
+
+    /* Deleting the queue wakes a task waiting on it, which then finds it gone */
+    UtAssert_INT32_EQ(OS_TaskCreate(&task_id, "QueueDelete", Queue_Delete_Fn, OSAL_TASK_STACK_ALLOCATE,
+                                    OSAL_SIZE_C(16384), OSAL_PRIORITY_C(50), 0),
+                      OS_SUCCESS);
+
+    OS_SelectFdZero(&ReadSet);
+    OS_SelectFdAdd(&ReadSet, queue_id);
+    status = OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT);
+
+    while (OS_TaskGetInfo(task_id, &task_prop) == OS_SUCCESS)
+    {
+        OS_TaskDelay(10);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, queue_id), true);
+        UtAssert_INT32_EQ(OS_QueueGet(queue_id, &msg, sizeof(msg), &size_copied, OS_CHECK), OS_ERR_INVALID_ID);
+    }
+    else
+    {
+        UtAssert_NA("Task waiting on a deleted queue is not woken by this implementation");
+    }
+
+    /* Let the server close the socket */
+    UtAssert_INT32_EQ(OS_BinSemGive(bin_sem_id), OS_SUCCESS);
+}
+
 void UtTest_Setup(void)
 {
     if (OS_API_Init() != OS_SUCCESS)
@@ -426,4 +595,5 @@ void UtTest_Setup(void)
     UtTest_Add(TestSelectMultipleRead, Setup_Multi, Teardown_Multi, "TestSelectMultipleRead");
     UtTest_Add(TestSelectSingleWrite, Setup_Single, Teardown_Single, "TestSelectSingleWrite");
     UtTest_Add(TestSelectMultipleWrite, Setup_Multi, Teardown_Multi, "TestSelectMultipleWrite");
+    UtTest_Add(TestSelectMultipleQueue, Setup_Single, Teardown_Single, "TestSelectMultipleQueue");
 }
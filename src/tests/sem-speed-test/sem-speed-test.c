@@ -29,11 +29,15 @@
 ** and gives semaphore 1.
 **
 ** The two tasks will run continuously, each pending
-** on each other and swapping between them, for 5 seconds.
+** on each other and swapping between them, for 2 seconds.
+** This is done first with binary semaphores and then
+** with counting semaphores.
 **
-** At the end of the test, the total number of "work"
+** At the end of each run, the total number of "work"
 ** cycles for each task is indicated.  Higher numbers
-** indicate better performance.
+** indicate better performance.  Building with the
+** OSAL_CONFIG_BINSEM_FUTEX option set each way compares
+** the two binary semaphore implementations on Linux.
 **
 **
 */
@@ -60,25 +64,32 @@
  * work correctly.  See note above
  * about priority requirements.
  */
-#define SEMTEST_WORK_LIMIT 10000000
+#define SEMTEST_WORK_LIMIT 100000000
 
-/* Define setup and test functions for UT assert */
-void SemSetup(void);
-void SemRun(void);
+/* The duration of each run */
+#define SEMTEST_RUN_MSEC 2000
 
 /*
- * A macro for semaphore operation depending on type.
- *
- * This resolves to a function name like e.g. OS_BinSemTake.
+ * The semaphore operations used in a run.  Binary and
+ * counting semaphores have the same function signatures.
  */
-#define SEMCALL(type, op) OS_##type##Sem##op
+typedef struct
+{
+    int32 (*Create)(osal_id_t *sem_id, const char *sem_name, uint32 sem_initial_value, uint32 options);
+    int32 (*Delete)(osal_id_t sem_id);
+    int32 (*Give)(osal_id_t sem_id);
+    int32 (*Take)(osal_id_t sem_id);
+} semtest_ops_t;
 
-/*
- * This test works with either binary or counting
- * semaphores.  To switch between them, set this
- * to either "Bin" or "Count" without quotes.
- */
-#define SEMOP(op) SEMCALL(Count, op)
+const semtest_ops_t SEMTEST_BIN_OPS   = {OS_BinSemCreate, OS_BinSemDelete, OS_BinSemGive, OS_BinSemTake};
+const semtest_ops_t SEMTEST_COUNT_OPS = {OS_CountSemCreate, OS_CountSemDelete, OS_CountSemGive, OS_CountSemTake};
+
+/* Define setup and test functions for UT assert */
+void SemSetup(void);
+void SemRun(void);
+
+/* The operations of the current run, set by the setup function */
+const semtest_ops_t *SEMOP;
 
 osal_id_t task_1_id;
 uint32    task_1_work;
@@ -89,56 +100,52 @@ uint32    task_2_work;
 osal_id_t sem_id_1;
 osal_id_t sem_id_2;
 
-void task_1(void)
+void sem_worker(const char *name, osal_id_t take_id, osal_id_t give_id, uint32 *work)
 {
-    uint32 status;
+    int32 status;
 
-    OS_printf("Starting task 1\n");
+    OS_printf("Starting %s\n", name);
 
-    while (task_1_work < SEMTEST_WORK_LIMIT)
+    while (*work < SEMTEST_WORK_LIMIT)
     {
-        status = SEMOP(Take)(sem_id_1);
+        status = SEMOP->Take(take_id);
         if (status != OS_SUCCESS)
         {
-            OS_printf("TASK 1: Error calling SemTake 1: %d\n", (int)status);
+            OS_printf("%s: Error calling SemTake: %d\n", name, (int)status);
             break;
         }
 
-        ++task_1_work;
+        ++(*work);
 
-        status = SEMOP(Give)(sem_id_2);
+        status = SEMOP->Give(give_id);
         if (status != OS_SUCCESS)
         {
-            OS_printf("TASK 1: Error calling SemGive 2: %d\n", (int)status);
+            OS_printf("%s: Error calling SemGive: %d\n", name, (int)status);
             break;
         }
     }
 }
 
-void task_2(void)
+void task_1(void)
 {
-    uint32 status;
-
-    OS_printf("Starting task 2\n");
+    sem_worker("TASK 1", sem_id_1, sem_id_2, &task_1_work);
+}
 
-    while (task_2_work < SEMTEST_WORK_LIMIT)
-    {
-        status = SEMOP(Take)(sem_id_2);
-        if (status != OS_SUCCESS)
-        {
-            OS_printf("TASK 2: Error calling SemTake 2: %d\n", (int)status);
-            break;
-        }
+void task_2(void)
+{
+    sem_worker("TASK 2", sem_id_2, sem_id_1, &task_2_work);
+}
 
-        ++task_2_work;
+void BinSemSetup(void)
+{
+    SEMOP = &SEMTEST_BIN_OPS;
+    SemSetup();
+}
 
-        status = SEMOP(Give)(sem_id_1);
-        if (status != OS_SUCCESS)
-        {
-            OS_printf("TASK 2: Error calling SemGive 1: %d\n", (int)status);
-            break;
-        }
-    }
+void CountSemSetup(void)
+{
+    SEMOP = &SEMTEST_COUNT_OPS;
+    SemSetup();
 }
 
 void UtTest_Setup(void)
@@ -154,7 +161,8 @@ void UtTest_Setup(void)
     /*
      * Register the test setup and check routines in UT assert
      */
-    UtTest_Add(SemRun, SemSetup, NULL, "SemSpeedTest");
+    UtTest_Add(SemRun, BinSemSetup, NULL, "BinSemSpeedTest");
+    UtTest_Add(SemRun, CountSemSetup, NULL, "CountSemSpeedTest");
 }
 
 void SemSetup(void)
@@ -165,11 +173,11 @@ void SemSetup(void)
     task_2_work = 0;
 
     /*
-    ** Create the Bin semaphore
+    ** Create the semaphores
     */
-    status = SEMOP(Create)(&sem_id_1, "Sem1", 0, 0);
+    status = SEMOP->Create(&sem_id_1, "Sem1", 0, 0);
     UtAssert_True(status == OS_SUCCESS, "Sem 1 create Id=%lx Rc=%d", OS_ObjectIdToInteger(sem_id_1), (int)status);
-    status = SEMOP(Create)(&sem_id_2, "Sem2", 0, 0);
+    status = SEMOP->Create(&sem_id_2, "Sem2", 0, 0);
     UtAssert_True(status == OS_SUCCESS, "Sem 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(sem_id_2), (int)status);
 
     /*
@@ -193,10 +201,10 @@ void SemRun(void)
     int32 status;
 
     /* Give the initial sem that starts the loop */
-    SEMOP(Give)(sem_id_1);
+    SEMOP->Give(sem_id_1);
 
     /* Time Limited Execution */
-    OS_TaskDelay(5000);
+    OS_TaskDelay(SEMTEST_RUN_MSEC);
 
     /*
     ** Delete resources
@@ -210,12 +218,15 @@ void SemRun(void)
     status = OS_TaskDelete(task_2_id);
     UtAssert_True(status == OS_SUCCESS, "Task 2 delete Rc=%d", (int)status);
 
-    status = SEMOP(Delete)(sem_id_1);
+    status = SEMOP->Delete(sem_id_1);
     UtAssert_True(status == OS_SUCCESS, "Sem 1 delete Rc=%d", (int)status);
-    status = SEMOP(Delete)(sem_id_2);
+    status = SEMOP->Delete(sem_id_2);
     UtAssert_True(status == OS_SUCCESS, "Sem 2 delete Rc=%d", (int)status);
 
     /* Task 1 and 2 should have both executed */
     UtAssert_True(task_1_work != 0, "Task 1 work counter = %u", (unsigned int)task_1_work);
     UtAssert_True(task_2_work != 0, "Task 2 work counter = %u", (unsigned int)task_2_work);
+
+    UtPrintf("Total cycles = %u, %u per second\n", (unsigned int)(task_1_work + task_2_work),
+             (unsigned int)((task_1_work + task_2_work) / (SEMTEST_RUN_MSEC / 1000)));
 }
@@ -25,11 +25,44 @@
 #include "ut-adaptor-portable-posix-io.h"
 #include "os-shared-clock.h"
 #include "os-shared-select.h"
+#include "os-shared-queue.h"
 #include "os-shared-idmap.h"
 
 #include "OCS_sys_select.h"
 #include "OCS_errno.h"
 
+/*
+ * Outputs a descriptor to wait on from OS_QueueSelectBegin_Impl(), with the queue not yet ready
+ */
+static void UT_Handler_QueueSelectBegin(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *SelectFlags = UT_Hook_GetArgValueByName(Context, "SelectFlags", uint32 *);
+    int *   os_fd       = UT_Hook_GetArgValueByName(Context, "os_fd", int *);
+    uint32 *fd_flags    = UT_Hook_GetArgValueByName(Context, "fd_flags", uint32 *);
+    int32   status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+    if (status == OS_SUCCESS)
+    {
+        *os_fd       = *((int *)UserObj);
+        *fd_flags    = OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE;
+        *SelectFlags = 0;
+    }
+}
+
+/*
+ * Reports the queue as not ready from the first call to OS_QueueSelectEnd_Impl() only
+ */
+static void UT_Handler_QueueSelectEndOnce(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *SelectFlags = UT_Hook_GetArgValueByName(Context, "SelectFlags", uint32 *);
+
+    if (UT_GetStubCount(FuncKey) == 1)
+    {
+        *SelectFlags = 0;
+    }
+}
+
 void Test_OS_SelectSingle_Impl(void)
 {
     /* Test Case For:
@@ -180,6 +213,126 @@ void Test_OS_SelectMultiple_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, &WriteSet, OS_TIME_MIN), OS_SUCCESS);
 }
 
+void Test_OS_SelectMultiple_Impl_Queues(void)
+{
+    /* Test Case For:
+     * int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, OS_time_t abs_timeout)
+     * with queue IDs in the sets
+     */
+    OS_FdSet ReadSet;
+    OS_FdSet WriteSet;
+    int      queue_fd;
+    int      i;
+
+    for (i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    {
+        UT_PortablePosixIOTest_Set_FD(OSAL_INDEX_C(i), -1);
+    }
+    OS_global_queue_table[0].active_id = OS_ObjectIdFromInteger(0x10000);
+    OS_global_queue_table[2].active_id = OS_ObjectIdFromInteger(0x10002);
+
+    /* Queue which does not exist is ignored */
+    memset(&ReadSet, 0, sizeof(ReadSet));
+    ReadSet.queue_ids[0] = 0x02;
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MIN), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_QueueSelectBegin_Impl, 0);
+
+    /* Queue which is deleted before it can be referenced is ignored */
+    ReadSet.queue_ids[0] = 0x01;
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MIN), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_QueueSelectBegin_Impl, 0);
+
+    /* Queue which is already ready, nothing to wait on, and the reference to it is released */
+    ReadSet.queue_ids[0]         = 0x01;
+    OS_queue_table[0].referenced = true;
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MAX), OS_SUCCESS);
+    UtAssert_UINT32_EQ(ReadSet.queue_ids[0], 0x01);
+    UtAssert_STUB_COUNT(OS_QueueSelectEnd_Impl, 1);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+    UtAssert_STUB_COUNT(OCS_select, 0);
+    OS_queue_table[0].referenced = false;
+
+    /* Queue which is already ready along with a stream, select only polls and times out */
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_0, 0);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    ReadSet.object_ids[0] = 0x01;
+    UT_SetDeferredRetcode(UT_KEY(OCS_select), 1, 0);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MAX), OS_SUCCESS);
+    UtAssert_UINT32_EQ(ReadSet.queue_ids[0], 0x01);
+    UtAssert_ZERO(ReadSet.object_ids[0]);
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_0, -1);
+
+    /* Queue which must be waited on in both sets */
+    UT_ResetState(0);
+    queue_fd = 1;
+    UT_SetHandlerFunction(UT_KEY(OS_QueueSelectBegin_Impl), UT_Handler_QueueSelectBegin, &queue_fd);
+    memset(&ReadSet, 0, sizeof(ReadSet));
+    memset(&WriteSet, 0, sizeof(WriteSet));
+    ReadSet.queue_ids[0]  = 0x01;
+    WriteSet.queue_ids[0] = 0x01;
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, &WriteSet, OS_TIME_MAX), OS_SUCCESS);
+    UtAssert_UINT32_EQ(ReadSet.queue_ids[0], 0x01);
+    UtAssert_UINT32_EQ(WriteSet.queue_ids[0], 0x01);
+    UtAssert_STUB_COUNT(OCS_FD_SET, 2);
+    UtAssert_STUB_COUNT(OCS_FD_CLR, 2);
+
+    /* Woken, but another task took the message first, so it waits again */
+    UT_ResetState(UT_KEY(OS_QueueSelectEnd_Impl));
+    UT_SetHandlerFunction(UT_KEY(OS_QueueSelectEnd_Impl), UT_Handler_QueueSelectEndOnce, NULL);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MAX), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OCS_select, 3);
+    UtAssert_UINT32_EQ(ReadSet.queue_ids[0], 0x01);
+
+    /* Woken by a stream while the queue is not ready */
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_0, 0);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    ReadSet.object_ids[0] = 0x01;
+    UT_ResetState(UT_KEY(OS_QueueSelectEnd_Impl));
+    UT_SetHandlerFunction(UT_KEY(OS_QueueSelectEnd_Impl), UT_Handler_QueueSelectEndOnce, NULL);
+    UT_SetDeferredRetcode(UT_KEY(OCS_FD_ISSET), 1, true);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MAX), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OCS_select, 4);
+    UtAssert_ZERO(ReadSet.queue_ids[0]);
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_0, -1);
+    ReadSet.object_ids[0] = 0;
+    ReadSet.queue_ids[0]  = 0x01;
+
+    /* Timeout */
+    UT_ResetState(UT_KEY(OS_QueueSelectEnd_Impl));
+    UT_SetHandlerFunction(UT_KEY(OS_QueueSelectEnd_Impl), UT_Handler_QueueSelectEndOnce, NULL);
+    UT_SetDeferredRetcode(UT_KEY(OCS_select), 1, 0);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MAX), OS_ERROR_TIMEOUT);
+
+    /* Queue descriptor out of range of select() */
+    queue_fd = OCS_FD_SETSIZE;
+    UT_ResetState(UT_KEY(OS_QueueSelectEnd_Impl));
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MAX), OS_ERR_OPERATION_NOT_SUPPORTED);
+    UtAssert_STUB_COUNT(OS_QueueSelectEnd_Impl, 1);
+
+    /* Error from a second queue, the first must still be ended */
+    queue_fd             = 1;
+    ReadSet.queue_ids[0] = 0x05;
+    UT_ResetState(UT_KEY(OS_QueueSelectEnd_Impl));
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueSelectBegin_Impl), 2, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MAX), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_QueueSelectEnd_Impl, 1);
+
+    /* Only the queues within the limit set at startup are checked, the others cannot exist */
+    UT_ResetState(0);
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetMaxForObjectType), 1);
+    memset(&ReadSet, 0, sizeof(ReadSet));
+    ReadSet.queue_ids[0]                             = 0x05;
+    ReadSet.queue_ids[sizeof(ReadSet.queue_ids) - 1] = 0x80;
+    OSAPI_TEST_FUNCTION_RC(OS_SelectMultiple_Impl, (&ReadSet, NULL, OS_TIME_MAX), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueSelectBegin_Impl, 1);
+    UtAssert_UINT32_EQ(ReadSet.queue_ids[0], 0x01);
+    UtAssert_ZERO(ReadSet.queue_ids[sizeof(ReadSet.queue_ids) - 1]);
+
+    memset(&OS_global_queue_table[0], 0, sizeof(OS_global_queue_table[0]));
+    memset(&OS_global_queue_table[2], 0, sizeof(OS_global_queue_table[2]));
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -209,4 +362,5 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_SelectSingle_Impl);
     ADD_TEST(OS_SelectMultiple_Impl);
+    ADD_TEST(OS_SelectMultiple_Impl_Queues);
 }
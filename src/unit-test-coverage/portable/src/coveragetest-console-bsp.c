@@ -70,7 +70,7 @@ void Test_OS_ConsoleOutput_Impl(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
-    memset(OS_console_table, 0, sizeof(OS_console_table));
+    memset(OS_console_table, 0, sizeof(*OS_console_table) * OS_MAX_CONSOLES);
 }
 
 /*
@@ -0,0 +1,84 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-queue.h"
+#include "os-shared-select.h"
+
+void Test_OS_QueueSelectBegin_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueSelectBegin_Impl(const OS_object_token_t *token, uint32 *SelectFlags, int *os_fd,
+     *                                uint32 *fd_flags)
+     */
+    uint32 flags = OS_STREAM_STATE_READABLE;
+    uint32 fd_flags;
+    int    os_fd;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueSelectBegin_Impl, (UT_INDEX_0, &flags, &os_fd, &fd_flags),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+}
+
+void Test_OS_QueueSelectEnd_Impl(void)
+{
+    /* Test Case For:
+     * void OS_QueueSelectEnd_Impl(const OS_object_token_t *token, uint32 *SelectFlags)
+     */
+    uint32 flags = OS_STREAM_STATE_READABLE;
+
+    OS_QueueSelectEnd_Impl(UT_INDEX_0, &flags);
+    UtAssert_ZERO(flags);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_QueueSelectBegin_Impl);
+    ADD_TEST(OS_QueueSelectEnd_Impl);
+}
@@ -0,0 +1,103 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-queue.h"
+
+void Test_OS_QueueReserve_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data_ptr)
+     */
+    void *data_ptr;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve_Impl, (UT_INDEX_0, &data_ptr), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueCommit_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data_ptr, size_t size, uint32 flags)
+     */
+    uint32 data = 0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit_Impl, (UT_INDEX_0, &data, sizeof(data), 0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueGetRef_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueGetRef_Impl(const OS_object_token_t *token, const void **data_ptr, size_t *size_copied,
+     *                           int32 timeout)
+     */
+    const void *data_ptr;
+    size_t      size_copied;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetRef_Impl, (UT_INDEX_0, &data_ptr, &size_copied, OS_PEND),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_QueueRelease_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *data_ptr)
+     */
+    uint32 data = 0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease_Impl, (UT_INDEX_0, &data), OS_ERR_NOT_IMPLEMENTED);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_QueueReserve_Impl);
+    ADD_TEST(OS_QueueCommit_Impl);
+    ADD_TEST(OS_QueueGetRef_Impl);
+    ADD_TEST(OS_QueueRelease_Impl);
+}
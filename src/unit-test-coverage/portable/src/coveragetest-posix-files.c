@@ -224,7 +224,7 @@ void Test_OS_FileRename_Impl(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
-    memset(OS_stream_table, 0, sizeof(OS_stream_table));
+    memset(OS_stream_table, 0, sizeof(*OS_stream_table) * OS_MAX_NUM_OPEN_FILES);
 }
 
 /*
@@ -75,6 +75,93 @@ void Test_OS_BinSemDelete(void)
     OSAPI_TEST_FUNCTION_RC(OS_BinSemDelete(UT_OBJID_1), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_BinSemCreateBatch(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_BinSemCreateBatch(osal_id_t *sem_ids, const char *const *sem_names, uint32 count,
+     *          uint32 sem_initial_value, uint32 options)
+     */
+    osal_id_t   objids[OS_OBJECT_BATCH_SIZE + 2];
+    const char *names[OS_OBJECT_BATCH_SIZE + 2];
+    uint32      i;
+
+    for (i = 0; i < OS_OBJECT_BATCH_SIZE + 2; ++i)
+    {
+        names[i] = "UT";
+    }
+
+    /* this requires more than one group */
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(objids, names, OS_OBJECT_BATCH_SIZE + 2, 0, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_ObjectIdAllocateNewBatch, 2);
+    UtAssert_STUB_COUNT(OS_BinSemCreate_Impl, OS_OBJECT_BATCH_SIZE + 2);
+    OSAPI_TEST_OBJID(objids[0], !=, OS_OBJECT_ID_UNDEFINED);
+    OSAPI_TEST_OBJID(objids[OS_OBJECT_BATCH_SIZE + 1], !=, OS_OBJECT_ID_UNDEFINED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(NULL, names, 2, 0, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(objids, NULL, 2, 0, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(objids, names, 0, 0, 0), OS_ERR_INVALID_SIZE);
+    names[1] = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(objids, names, 2, 0, 0), OS_INVALID_POINTER);
+    names[1] = "UT";
+    UT_SetDeferredRetcode(UT_KEY(OCS_memchr), 2, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(objids, names, 2, 0, 0), OS_ERR_NAME_TOO_LONG);
+
+    /* failure in the first group */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdAllocateNewBatch), 1, OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(objids, names, 2, 0, 0), OS_ERR_NO_FREE_IDS);
+    UtAssert_STUB_COUNT(OS_ObjectIdGetByIdBatch, 0);
+    OSAPI_TEST_OBJID(objids[0], ==, OS_OBJECT_ID_UNDEFINED);
+
+    /* failure in the second group must delete the semaphores from the first */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdAllocateNewBatch), 2, OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(objids, names, OS_OBJECT_BATCH_SIZE + 2, 0, 0), OS_ERR_NO_FREE_IDS);
+    UtAssert_STUB_COUNT(OS_ObjectIdGetByIdBatch, 1);
+    UtAssert_STUB_COUNT(OS_BinSemDelete_Impl, OS_OBJECT_BATCH_SIZE);
+    for (i = 0; i < OS_OBJECT_BATCH_SIZE + 2; ++i)
+    {
+        OSAPI_TEST_OBJID(objids[i], ==, OS_OBJECT_ID_UNDEFINED);
+    }
+
+    /* failure of an implementation call must delete the others in the same group */
+    UT_ResetState(UT_KEY(OS_BinSemDelete_Impl));
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate_Impl), 3, OS_SEM_FAILURE);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemCreateBatch(objids, names, 4, 0, 0), OS_SEM_FAILURE);
+    UtAssert_STUB_COUNT(OS_BinSemDelete_Impl, 2);
+    OSAPI_TEST_OBJID(objids[0], ==, OS_OBJECT_ID_UNDEFINED);
+}
+
+void Test_OS_BinSemDeleteBatch(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_BinSemDeleteBatch(const osal_id_t *sem_ids, uint32 count)
+     */
+    osal_id_t objids[OS_OBJECT_BATCH_SIZE + 1];
+    uint32    i;
+
+    for (i = 0; i < OS_OBJECT_BATCH_SIZE + 1; ++i)
+    {
+        objids[i] = UT_OBJID_1;
+    }
+
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemDeleteBatch(objids, OS_OBJECT_BATCH_SIZE + 1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_ObjectIdGetByIdBatch, 2);
+    UtAssert_STUB_COUNT(OS_BinSemDelete_Impl, OS_OBJECT_BATCH_SIZE + 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemDeleteBatch(NULL, 1), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemDeleteBatch(objids, 0), OS_ERR_INVALID_SIZE);
+
+    /* an invalid ID is reported but the rest are still deleted */
+    UT_ResetState(UT_KEY(OS_BinSemDelete_Impl));
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetByIdBatch), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemDeleteBatch(objids, OS_OBJECT_BATCH_SIZE + 1), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_BinSemDelete_Impl, OS_OBJECT_BATCH_SIZE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemDelete_Impl), 1, OS_SEM_FAILURE);
+    OSAPI_TEST_FUNCTION_RC(OS_BinSemDeleteBatch(objids, 3), OS_SEM_FAILURE);
+}
+
 void Test_OS_BinSemGive(void)
 {
     /*
@@ -199,6 +286,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_BinSemAPI_Init);
     ADD_TEST(OS_BinSemCreate);
     ADD_TEST(OS_BinSemDelete);
+    ADD_TEST(OS_BinSemCreateBatch);
+    ADD_TEST(OS_BinSemDeleteBatch);
     ADD_TEST(OS_BinSemGive);
     ADD_TEST(OS_BinSemTake);
     ADD_TEST(OS_BinSemFlush);
@@ -111,6 +111,57 @@ void Test_OS_CountSemTimedWait(void)
     OSAPI_TEST_FUNCTION_RC(OS_CountSemTimedWait(UT_OBJID_1, 1), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_CountSemGiveN(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_CountSemGiveN(osal_id_t sem_id, uint32 count)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemGiveN(UT_OBJID_1, 2), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_CountSemGiveN_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemGiveN(UT_OBJID_1, 0), OS_INVALID_SEM_VALUE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemGiveN_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemGiveN(UT_OBJID_1, 2), OS_ERR_NOT_IMPLEMENTED);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemGiveN(UT_OBJID_1, 2), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_CountSemTakeN(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_CountSemTakeN(osal_id_t sem_id, uint32 count)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemTakeN(UT_OBJID_1, 2), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_CountSemTakeN_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemTakeN(UT_OBJID_1, 0), OS_INVALID_SEM_VALUE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemTakeN(UT_OBJID_1, 2), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_CountSemTimedWaitN(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_CountSemTimedWaitN(osal_id_t sem_id, uint32 count, uint32 msecs)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemTimedWaitN(UT_OBJID_1, 2, 1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_CountSemTimedWaitN_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemTimedWaitN(UT_OBJID_1, 0, 1), OS_INVALID_SEM_VALUE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTimedWaitN_Impl), OS_SEM_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemTimedWaitN(UT_OBJID_1, 2, 1), OS_SEM_TIMEOUT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_CountSemTimedWaitN(UT_OBJID_1, 2, 1), OS_ERR_INVALID_ID);
+}
+
 void Test_OS_CountSemGetIdByName(void)
 {
     /*
@@ -190,6 +241,9 @@ void UtTest_Setup(void)
     ADD_TEST(OS_CountSemGive);
     ADD_TEST(OS_CountSemTake);
     ADD_TEST(OS_CountSemTimedWait);
+    ADD_TEST(OS_CountSemGiveN);
+    ADD_TEST(OS_CountSemTakeN);
+    ADD_TEST(OS_CountSemTimedWaitN);
     ADD_TEST(OS_CountSemGetIdByName);
     ADD_TEST(OS_CountSemGetInfo);
 }
@@ -411,6 +411,9 @@ void Test_OS_CloseAllFiles(void)
     UtAssert_True(actual == expected, "OS_FileIteratorClose() (%ld) == OS_SUCCESS", (long)actual);
 }
 
+/* Storage for the table that OS_ObjectIdTableAlloc() provides in normal operation */
+static OS_stream_internal_record_t UT_stream_records[OS_MAX_NUM_OPEN_FILES];
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -419,7 +422,8 @@ void Test_OS_CloseAllFiles(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
-    memset(OS_stream_table, 0, sizeof(OS_stream_table));
+    memset(UT_stream_records, 0, sizeof(UT_stream_records));
+    OS_stream_table = UT_stream_records;
     memset(OS_global_stream_table, 0, sizeof(OS_common_record_t) * OS_MAX_NUM_OPEN_FILES);
 }
 
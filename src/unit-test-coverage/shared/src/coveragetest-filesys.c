@@ -375,6 +375,8 @@ void Test_OS_GetFsInfo(void)
     UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdIteratorGetNext), 1);
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdIteratorGetNext), 3, 0);
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdIteratorGetNext), 4, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_GetMaxForObjectType), 1, OS_MAX_NUM_OPEN_FILES);
+    UT_SetDeferredRetcode(UT_KEY(OS_GetMaxForObjectType), 1, OS_MAX_FILE_SYSTEMS);
 
     actual = OS_GetFsInfo(&filesys_info);
 
@@ -539,6 +541,9 @@ void Test_OS_FileSys_FindVirtMountPoint(void)
     UtAssert_True(result, "OS_FileSys_FindVirtMountPoint(%s) (nominal) == true", refstr);
 }
 
+/* Storage for the table that OS_ObjectIdTableAlloc() provides in normal operation */
+static OS_filesys_internal_record_t UT_filesys_records[OS_MAX_FILE_SYSTEMS];
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -547,7 +552,8 @@ void Test_OS_FileSys_FindVirtMountPoint(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
-    memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
+    memset(UT_filesys_records, 0, sizeof(UT_filesys_records));
+    OS_filesys_table = UT_filesys_records;
 }
 
 /*
@@ -26,8 +26,11 @@
 #include "os-shared-idmap.h"
 #include "os-shared-common.h"
 #include "os-shared-task.h"
+#include "os-shared-clock.h"
+#include "osapi-bsp.h"
 
 #include "OCS_string.h"
+#include "OCS_stdlib.h"
 
 typedef struct
 {
@@ -52,6 +55,63 @@ void UT_Handler_OS_TaskGetId_Impl(void *UserObj, UT_EntryKey_t FuncKey, const UT
     UT_Stub_SetReturnValue(FuncKey, objid);
 }
 
+/*
+ * Emulated heap for the object tables allocated by OS_ObjectIdInit(), which
+ * has room for several configurations of the default size in each test.
+ */
+static OS_common_record_t UT_ObjectHeap[16 * OS_MAX_TOTAL_RECORDS];
+
+/* the clock used by default in all tests, see Osapi_Test_Setup() */
+static OS_time_t UT_Setup_Clock;
+
+/* OS_GetMonotonicTime_Impl handler for a clock that advances by 1ms on each read */
+static void UT_Handler_AdvancingClock(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *clock       = UserObj;
+    OS_time_t *time_struct = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    *clock       = OS_TimeAdd(*clock, OS_TimeFromTotalMilliseconds(1));
+    *time_struct = *clock;
+}
+
+/* OS_GetMonotonicTime_Impl handler for a clock that only advances when the caller waits */
+static void UT_Handler_ReadClock(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *clock       = UserObj;
+    OS_time_t *time_struct = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    *time_struct = *clock;
+}
+
+/* a wait hook that advances the clock read by UT_Handler_ReadClock by 1ms */
+static int32 UT_Hook_AdvanceClock(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    OS_time_t *clock = UserObj;
+
+    *clock = OS_TimeAdd(*clock, OS_TimeFromTotalMilliseconds(1));
+    return StubRetcode;
+}
+
+/* a wait hook that simulates another task finishing with the object in the token */
+static int32 UT_Hook_RestoreActiveId(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                     const UT_StubContext_t *Context)
+{
+    OS_object_token_t *token = UserObj;
+
+    OS_ObjectIdGlobalFromToken(token)->active_id = token->obj_id;
+    return StubRetcode;
+}
+
+/* a wait hook that simulates another task releasing its reference to the record */
+static int32 UT_Hook_ReleaseRefcount(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                     const UT_StubContext_t *Context)
+{
+    OS_common_record_t *record = UserObj;
+
+    record->refcount = 0;
+    return StubRetcode;
+}
+
 static void ObjTypeCounter(osal_id_t object_id, void *arg)
 {
     Test_OS_ObjTypeCount_t *count = arg;
@@ -87,6 +147,73 @@ void Test_OS_ObjectIdInit(void)
      * int32 OS_ObjectIdInit(void)
      */
     OSAPI_TEST_FUNCTION_RC(OS_ObjectIdInit(), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_TASK), OS_MAX_TASKS);
+    UtAssert_UINT32_EQ(OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_QUEUE), OS_MAX_QUEUES);
+    UtAssert_UINT32_EQ(OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_QUEUE),
+                       OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_TASK) + OS_MAX_TASKS);
+
+    /*
+     * A BSP-supplied limit reduces the task table, moving the base of all later types,
+     * while a limit exceeding what a type can support is clamped to it.
+     */
+    OS_BSP_SetResourceTypeLimit(OS_OBJECT_TYPE_OS_TASK, 3);
+    OS_BSP_SetResourceTypeLimit(OS_OBJECT_TYPE_OS_QUEUE, OS_MAX_QUEUES + 1);
+    OS_BSP_SetResourceTypeLimit(OS_OBJECT_TYPE_OS_STREAM, OS_MAX_NUM_OPEN_FILES + 1);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdInit(), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_TASK), 3);
+    UtAssert_UINT32_EQ(OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_QUEUE), OS_MAX_QUEUES);
+    UtAssert_UINT32_EQ(OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_STREAM), OS_MAX_NUM_OPEN_FILES);
+    UtAssert_UINT32_EQ(OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_QUEUE),
+                       OS_GetBaseForObjectType(OS_OBJECT_TYPE_OS_TASK) + 3);
+    UtAssert_ADDRESS_EQ(OS_global_queue_table, &OS_global_task_table[3]);
+
+    /* A limit above the build configuration enlarges the table of other types */
+    OS_BSP_SetResourceTypeLimit(OS_OBJECT_TYPE_OS_TASK, OS_MAX_TASKS + 1);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdInit(), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_TASK), OS_MAX_TASKS + 1);
+    UtAssert_ADDRESS_EQ(OS_global_queue_table, &OS_global_task_table[OS_MAX_TASKS + 1]);
+    UtAssert_STUB_COUNT(OCS_free, 3);
+
+    OS_BSP_SetResourceTypeLimit(OS_OBJECT_TYPE_OS_TASK, 0);
+    OS_BSP_SetResourceTypeLimit(OS_OBJECT_TYPE_OS_QUEUE, 0);
+    OS_BSP_SetResourceTypeLimit(OS_OBJECT_TYPE_OS_STREAM, 0);
+
+    /* Failure to allocate the tables leaves no records of any type */
+    UT_SetDeferredRetcode(UT_KEY(OCS_malloc), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdInit(), OS_ERROR);
+    UtAssert_ZERO(OS_GetMaxForObjectType(OS_OBJECT_TYPE_OS_TASK));
+
+    /* Types outside the table have no records */
+    UtAssert_ZERO(OS_GetDefaultMaxForObjectType(OS_OBJECT_TYPE_USER));
+    UtAssert_ZERO(OS_GetMaxForObjectType(OS_OBJECT_TYPE_USER));
+    UtAssert_ZERO(OS_GetBaseForObjectType(OS_OBJECT_TYPE_USER));
+}
+
+void Test_OS_ObjectIdTableAlloc(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ObjectIdTableAlloc(osal_objtype_t idtype, size_t record_size, void **table)
+     */
+    uint32 *table = NULL;
+
+    OSAPI_TEST_FUNCTION_RC(OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TASK, table), OS_SUCCESS);
+    UtAssert_NOT_NULL(table);
+    UtAssert_ZERO(table[OS_MAX_TASKS - 1]);
+    UtAssert_STUB_COUNT(OCS_free, 0);
+
+    /* Allocating again releases the previous table */
+    OSAPI_TEST_FUNCTION_RC(OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TASK, table), OS_SUCCESS);
+    UtAssert_NOT_NULL(table);
+    UtAssert_STUB_COUNT(OCS_free, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OCS_malloc), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_OS_TASK, table), OS_ERROR);
+    UtAssert_NULL(table);
+
+    /* A type without any records needs no table */
+    OSAPI_TEST_FUNCTION_RC(OS_OBJECT_TABLE_ALLOC(OS_OBJECT_TYPE_USER, table), OS_SUCCESS);
+    UtAssert_NULL(table);
 }
 
 void Test_OS_LockUnlockGlobal(void)
@@ -169,6 +296,12 @@ void Test_OS_ObjectIdConvertToken(void)
     OS_object_token_t   token;
     OS_common_record_t *record;
     osal_id_t           objid;
+    OS_time_t           clock;
+
+    clock = OS_TIME_ZERO;
+    UT_SetHandlerFunction(UT_KEY(OS_GetMonotonicTime_Impl), UT_Handler_ReadClock, &clock);
+    UT_SetHookFunction(UT_KEY(OS_WaitForStateChange_Impl), UT_Hook_AdvanceClock, &clock);
+    UT_SetHookFunction(UT_KEY(OS_WaitForHandoff_Impl), UT_Hook_AdvanceClock, &clock);
 
     /* confirm that calling w/invalid token returns OS_ERR_INCORRECT_OBJ_STATE */
     memset(&token, 0, sizeof(token));
@@ -200,13 +333,24 @@ void Test_OS_ObjectIdConvertToken(void)
     /* Global should not be released */
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 1);
 
-    /* object in use, not OS_OBJECT_ID_RESERVED */
+    /* object in use, not OS_OBJECT_ID_RESERVED, waits 1ms at a time until the 5ms timeout expires */
     token.lock_mode   = OS_LOCK_MODE_GLOBAL;
     record->active_id = OS_OBJECT_ID_RESERVED;
-    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdConvertToken(&token), OS_ERR_OBJECT_IN_USE);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdConvertTokenTimed(&token, 5), OS_ERR_OBJECT_IN_USE);
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 1);
-    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 4);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 5);
     UT_ResetState(UT_KEY(OS_WaitForStateChange_Impl));
+
+    /* same, but with no timeout, fails without waiting */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdConvertTokenTimed(&token, OS_CHECK), OS_ERR_OBJECT_IN_USE);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 0);
+
+    /* same, but pending indefinitely until the object becomes available */
+    UT_SetHookFunction(UT_KEY(OS_WaitForStateChange_Impl), UT_Hook_RestoreActiveId, &token);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdConvertTokenTimed(&token, OS_PEND), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 1);
+    UT_ResetState(UT_KEY(OS_WaitForStateChange_Impl));
+    record->refcount  = 5;
     record->active_id = objid;
 
     /* Failure branch for exclusive lock where active id was overwritten (non-reserved expected_id) */
@@ -278,13 +422,14 @@ void Test_OS_ObjectIdConvertToken(void)
      */
     token.lock_mode = OS_LOCK_MODE_EXCLUSIVE;
     token.obj_id    = objid;
-    actual          = OS_ObjectIdConvertToken(&token);
+    actual          = OS_ObjectIdConvertTokenTimed(&token, 4);
     expected        = OS_ERR_OBJECT_IN_USE;
     UtAssert_True(actual == expected, "OS_ObjectIdConvertLock(EXCLUSIVE) (%ld) == OS_ERR_OBJECT_IN_USE (%ld)",
                   (long)actual, (long)expected);
 
-    /* should have delayed 4 times, on the 5th try it returns error */
-    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 4);
+    /* should have waited for handoff 4 times, then the timeout expired */
+    UtAssert_STUB_COUNT(OS_WaitForHandoff_Impl, 4);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 0);
 
     /* Global should not be released */
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 2);
@@ -349,6 +494,11 @@ void Test_OS_ObjectIdGetBySearch(void)
     UtAssert_UINT32_EQ(token.obj_idx, 0);
 
     OS_global_task_table[0].active_id = OS_OBJECT_ID_UNDEFINED;
+
+    /* No match */
+    OSAPI_TEST_FUNCTION_RC(
+        OS_ObjectIdGetBySearch(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TASK, TestAlwaysMatch, NULL, &token),
+        OS_ERR_NAME_NOT_FOUND);
 }
 
 void Test_OS_GetMaxForObjectType(void)
@@ -384,6 +534,19 @@ void Test_OS_GetMaxForObjectType(void)
     }
 }
 
+void Test_OS_GetHighestMaxForObjectType(void)
+{
+    /*
+     * Test Case For:
+     * uint32 OS_GetHighestMaxForObjectType(osal_objtype_t idtype)
+     */
+    UtAssert_UINT32_EQ(OS_GetHighestMaxForObjectType(OS_OBJECT_TYPE_OS_TASK), OS_OBJECT_INDEX_MASK);
+    UtAssert_UINT32_EQ(OS_GetHighestMaxForObjectType(OS_OBJECT_TYPE_OS_QUEUE), OS_MAX_QUEUES);
+    UtAssert_UINT32_EQ(OS_GetHighestMaxForObjectType(OS_OBJECT_TYPE_OS_STREAM), OS_MAX_NUM_OPEN_FILES);
+    UtAssert_ZERO(OS_GetHighestMaxForObjectType(OS_OBJECT_TYPE_UNDEFINED));
+    UtAssert_ZERO(OS_GetHighestMaxForObjectType(OS_OBJECT_TYPE_USER));
+}
+
 void Test_OS_GetBaseForObjectType(void)
 {
     /*
@@ -459,10 +622,11 @@ void Test_OS_ObjectIdFindByName(void)
      * Nominal case (with no additional setup) should return OS_ERR_NAME_NOT_FOUND
      * Setting up a special matching entry should yield OS_SUCCESS
      */
-    char      TaskName[] = "UT_find";
-    osal_id_t objid;
-    int32     expected = OS_ERR_NAME_NOT_FOUND;
-    int32     actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
+    char              TaskName[] = "UT_find";
+    osal_id_t         objid;
+    OS_object_token_t token;
+    int32             expected = OS_ERR_NAME_NOT_FOUND;
+    int32             actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_ERR_NAME_NOT_FOUND", "NULL", (long)actual);
 
     /*
@@ -488,16 +652,95 @@ void Test_OS_ObjectIdFindByName(void)
     /*
      * Set up for the ObjectIdSearch function to return success
      */
+    memset(&token, 0, sizeof(token));
+    token.obj_type                     = OS_OBJECT_TYPE_OS_TASK;
+    token.obj_idx                      = OSAL_INDEX_C(0);
     OS_global_task_table[0].active_id  = UT_OBJID_OTHER;
     OS_global_task_table[0].name_entry = TaskName;
+    OS_ObjectIdNameIndexInsert(&token, TaskName);
     actual                             = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid);
     expected                           = OS_SUCCESS;
     OS_global_task_table[0].active_id  = OS_OBJECT_ID_UNDEFINED;
     OS_global_task_table[0].name_entry = NULL;
+    OS_ObjectIdNameIndexRemove(&token);
 
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_SUCCESS", TaskName, (long)actual);
 }
 
+void Test_OS_ObjectIdNameIndex(void)
+{
+    /*
+     * Test Case For:
+     * uint32 OS_ObjectNameHash(const char *name);
+     * void   OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name);
+     * void   OS_ObjectIdNameIndexRemove(const OS_object_token_t *token);
+     * int32  OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token);
+     */
+    OS_object_token_t token1;
+    OS_object_token_t token2;
+    OS_object_token_t search;
+
+    /* The hash must be deterministic and sensitive to content */
+    UtAssert_UINT32_EQ(OS_ObjectNameHash("UT"), OS_ObjectNameHash("UT"));
+    UtAssert_True(OS_ObjectNameHash("UT1") != OS_ObjectNameHash("UT2"), "OS_ObjectNameHash() differs");
+
+    memset(&token1, 0, sizeof(token1));
+    token1.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    token1.obj_idx  = OSAL_INDEX_C(0);
+    token2          = token1;
+    token2.obj_idx  = OSAL_INDEX_C(1);
+    memset(&search, 0, sizeof(search));
+    search.obj_type = OS_OBJECT_TYPE_OS_TASK;
+
+    /* Removing a record that is not indexed is a no-op */
+    OS_ObjectIdNameIndexRemove(&token1);
+
+    /* Nothing is indexed yet */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_1", &search), OS_ERR_NAME_NOT_FOUND);
+    OSAPI_TEST_OBJID(search.obj_id, ==, OS_OBJECT_ID_UNDEFINED);
+
+    /*
+     * Index both records under the same name, so they are chained in the
+     * same bucket.  Only the one with an active ID should be a match.
+     */
+    OS_global_task_table[0].name_entry = "UT_1";
+    OS_global_task_table[1].name_entry = "UT_1";
+    OS_global_task_table[1].active_id  = UT_OBJID_1;
+    OS_ObjectIdNameIndexInsert(&token2, "UT_1");
+    OS_ObjectIdNameIndexInsert(&token1, "UT_1");
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_1", &search), OS_SUCCESS);
+    UtAssert_UINT32_EQ(search.obj_idx, 1);
+    OSAPI_TEST_OBJID(search.obj_id, ==, UT_OBJID_1);
+
+    /* Re-inserting an already indexed record must not duplicate it */
+    OS_ObjectIdNameIndexInsert(&token2, "UT_1");
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_1", &search), OS_SUCCESS);
+    UtAssert_UINT32_EQ(search.obj_idx, 1);
+
+    /* Remove the record at the end of the chain */
+    OS_ObjectIdNameIndexRemove(&token1);
+    OS_ObjectIdNameIndexRemove(&token2);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_1", &search), OS_ERR_NAME_NOT_FOUND);
+
+    /* A different name in the same table does not match */
+    OS_ObjectIdNameIndexInsert(&token2, "UT_1");
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_2", &search), OS_ERR_NAME_NOT_FOUND);
+
+    /* A record in the same bucket with a different name does not match */
+    OS_global_task_table[1].name_entry = "UT_2";
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_1", &search), OS_ERR_NAME_NOT_FOUND);
+    OS_ObjectIdNameIndexRemove(&token2);
+
+    /* Streams are not indexed, and fall back to a search of the table */
+    search.obj_type = OS_OBJECT_TYPE_OS_STREAM;
+    search.obj_idx  = OSAL_INDEX_C(-1);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_1", &search), OS_ERR_NAME_NOT_FOUND);
+
+    /* An object type with no records */
+    search.obj_type = OS_OBJECT_TYPE_UNDEFINED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNameMatch("UT_1", &search), OS_ERR_NAME_NOT_FOUND);
+}
+
 void Test_OS_ObjectIdGetById(void)
 {
     /*
@@ -537,10 +780,12 @@ void Test_OS_ObjectIdGetById(void)
     expected        = OS_SUCCESS;
     actual          = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1);
 
-    /* Verify Outputs */
+    /* Verify Outputs - a refcount lock should not need the global lock */
     UtAssert_True(actual == expected, "OS_ObjectIdGetById() (%ld) == OS_SUCCESS", (long)actual);
     UtAssert_UINT32_EQ(token1.obj_idx, local_idx);
+    UtAssert_UINT32_EQ(token1.lock_mode, OS_LOCK_MODE_REFCOUNT);
     UtAssert_True(rptr->refcount == 1, "refcount (%u) == 1", (unsigned int)rptr->refcount);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 0);
 
     /* attempting to get an exclusive lock should return IN_USE error */
     expected = OS_ERR_OBJECT_IN_USE;
@@ -567,6 +812,32 @@ void Test_OS_ObjectIdGetById(void)
     actual   = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, 0xFFFF, refobjid, &token1);
     UtAssert_True(actual == expected, "OS_ObjectIdGetById() (%ld) == OS_ERR_INVALID_ID", (long)actual);
 
+    /* refcount lock while the object is being deleted uses the global lock, and should fail */
+    rptr->active_id = OS_OBJECT_ID_RESERVED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_ERR_OBJECT_IN_USE);
+    UtAssert_UINT32_EQ(rptr->refcount, 0);
+    rptr->active_id = refobjid;
+
+    /* refcount lock with a stale ID fails with the global lock */
+    OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1000 + OS_MAX_TASKS, &refobjid);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(rptr->refcount, 0);
+
+    /* refcount lock when not initialized */
+    OS_SharedGlobalVars.GlobalState = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_ERROR);
+    OS_SharedGlobalVars.GlobalState = OS_INIT_MAGIC_NUMBER;
+
+    /* refcount lock with ID of the wrong type or an invalid ID */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_QUEUE, refobjid, &token1),
+                           OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(
+        OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, OS_OBJECT_ID_UNDEFINED, &token1),
+        OS_ERR_INVALID_ID);
+
     /* clear out state entry */
     memset(&OS_global_task_table[local_idx], 0, sizeof(OS_global_task_table[local_idx]));
 }
@@ -692,10 +963,11 @@ void Test_OS_ObjectIdFindNextFree(void)
             break;
         }
 
-        /* clear the entry for re-use */
+        /* clear the entry and return it to the free queue for re-use */
         saved_id = token2.obj_id;
         rec2     = OS_OBJECT_TABLE_GET(OS_global_task_table, token2);
         memset(rec2, 0, sizeof(*rec2));
+        OS_ObjectIdFreeQueueAppend(&token2);
     }
 
     /* verify that the wrap occurred */
@@ -718,6 +990,21 @@ void Test_OS_ObjectIdFindNextFree(void)
     /* Clear the task table */
     memset(OS_global_task_table, 0, sizeof(OS_common_record_t) * OS_MAX_TASKS);
 
+    /*
+     * Returning a record to a free queue which is already full should be ignored,
+     * so exactly OS_MAX_TASKS records should be issued afterward, in FIFO order.
+     */
+    OS_ObjectIdInit();
+    memset(&token2, 0, sizeof(token2));
+    token2.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    OS_ObjectIdFreeQueueAppend(&token2);
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNextFree(&token2), OS_SUCCESS);
+        UtAssert_UINT32_EQ(token2.obj_idx, (i + 1) % OS_MAX_TASKS);
+    }
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNextFree(&token2), OS_ERR_NO_FREE_IDS);
+
     /* Try to allocate an instance of an objtype which is not implemented */
     memset(&token2, 0, sizeof(token2));
     token2.obj_type = 22;
@@ -747,13 +1034,15 @@ void Test_OS_ObjectIdAllocateNew(void)
     UtAssert_UINT32_EQ(token.obj_type, OS_OBJECT_TYPE_OS_TASK);
     UtAssert_Bool(OS_ObjectIdDefined(token.obj_id), "ObjectIdDefined(token.obj_id)");
 
+    /* This would normally be done by OS_OBJECT_INIT() in the caller */
+    OS_ObjectIdGlobalFromToken(&token)->name_entry = "UT_alloc";
+
     /* Passing a NULL name also should work here (used for internal objects) */
     actual = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, NULL, &token);
     UtAssert_True(actual == expected, "OS_ObjectIdAllocate(NULL) (%ld) == OS_SUCCESS", (long)actual);
 
-    OS_global_task_table[0].name_entry = "UT_alloc";
-    expected                           = OS_ERR_NAME_TAKEN;
-    actual                             = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &token);
+    expected = OS_ERR_NAME_TAKEN;
+    actual   = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &token);
     UtAssert_True(actual == expected, "OS_ObjectIdAllocate() (%ld) == OS_ERR_NAME_TAKEN", (long)actual);
 
     /*
@@ -898,23 +1187,68 @@ void Test_OS_ObjectIdTransaction(void)
     OSAPI_TEST_OBJID(record->active_id, ==, token.obj_id);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
-    /* refcount finish (no change to ID) */
+    /* refcount finish (no change to ID), does not need the global lock */
     token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
     record->refcount  = 1;
     record->active_id = UT_OBJID_1;
     OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 3);
+    UtAssert_UINT32_EQ(token.lock_mode, OS_LOCK_MODE_NONE);
+    OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+
+    /* refcount finish with an exclusive lock pending and other refs, no wakeup */
+    token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
+    record->refcount  = 2;
+    record->active_id = OS_OBJECT_ID_RESERVED;
+    OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 3);
+    UtAssert_UINT32_EQ(record->refcount, 1);
+
+    /* refcount finish with an exclusive lock pending and last ref, wakes the waiter */
+    token.lock_mode = OS_LOCK_MODE_REFCOUNT;
+    OS_ObjectIdTransactionFinish(&token, NULL);
     UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 4);
+    OSAPI_TEST_OBJID(record->active_id, ==, OS_OBJECT_ID_RESERVED);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+
+    /* refcount finish with an ID change uses the global lock */
+    objid            = UT_OBJID_1;
+    token.lock_mode  = OS_LOCK_MODE_REFCOUNT;
+    record->refcount = 1;
+    OS_ObjectIdTransactionFinish(&token, &objid);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 5);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 5);
     OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
     /* other finish with refcount already 0 */
     token.lock_mode = OS_LOCK_MODE_GLOBAL;
     OS_ObjectIdTransactionFinish(&token, NULL);
-    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
-    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 5);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 5);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 6);
     OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
     UtAssert_UINT32_EQ(record->refcount, 0);
+    UtAssert_STUB_COUNT(OS_SignalHandoff_Impl, 1);
+
+    /* other finish of the last reference while an exclusive lock is pending should hand off */
+    token.lock_mode   = OS_LOCK_MODE_GLOBAL;
+    record->refcount  = 1;
+    record->active_id = OS_OBJECT_ID_RESERVED;
+    OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 7);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+    UtAssert_STUB_COUNT(OS_SignalHandoff_Impl, 2);
+
+    /* but not if other references remain */
+    token.lock_mode  = OS_LOCK_MODE_GLOBAL;
+    record->refcount = 2;
+    OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_UINT32_EQ(record->refcount, 1);
+    UtAssert_STUB_COUNT(OS_SignalHandoff_Impl, 2);
 
     /* test transferring a refcount token */
     memset(&token2, 0xBB, sizeof(token2));
@@ -1011,6 +1345,165 @@ void Test_OS_ObjectIdFinalize(void)
     UtAssert_UINT32_EQ(token.lock_mode, OS_LOCK_MODE_NONE);
 }
 
+void Test_OS_ObjectIdBatch(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ObjectIdAllocateNewBatch(osal_objtype_t idtype, const char *const *names, uint32 count,
+     *                                   OS_object_token_t *tokens);
+     * int32 OS_ObjectIdFinalizeNewBatch(int32 operation_status, OS_object_token_t *tokens, uint32 count,
+     *                                   osal_id_t *outids);
+     * int32 OS_ObjectIdGetByIdBatch(osal_objtype_t idtype, const osal_id_t *ids, uint32 count,
+     *                               OS_object_token_t *tokens);
+     * int32 OS_ObjectIdFinalizeDeleteBatch(const int32 *operation_status, OS_object_token_t *tokens, uint32 count);
+     */
+    const char *        names[3]     = {"UT_batch1", NULL, "UT_batch2"};
+    const char *        dup_names[2] = {"UT_batch3", "UT_batch3"};
+    const char *        new_names[2] = {"UT_batch4", "UT_batch5"};
+    const char *        no_names[OS_MAX_BIN_SEMAPHORES + 1];
+    OS_object_token_t   tokens[OS_MAX_BIN_SEMAPHORES + 1];
+    OS_object_token_t   other_token;
+    osal_id_t           objids[3];
+    osal_id_t           other_ids[4];
+    int32               status[4];
+    OS_common_record_t *record;
+    uint32              i;
+
+    /* All IDs should be issued under a single lock of the table */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdAllocateNewBatch(OS_OBJECT_TYPE_OS_BINSEM, names, 3, tokens), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 1);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 1);
+    UtAssert_STUB_COUNT(OS_NotifyEvent, 3);
+    for (i = 0; i < 3; ++i)
+    {
+        record = OS_ObjectIdGlobalFromToken(&tokens[i]);
+        UtAssert_UINT32_EQ(tokens[i].lock_mode, OS_LOCK_MODE_EXCLUSIVE);
+        OSAPI_TEST_OBJID(record->active_id, ==, OS_OBJECT_ID_RESERVED);
+        UtAssert_UINT32_EQ(record->refcount, 1);
+    }
+
+    /* The names should be taken as soon as the IDs are issued */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdAllocateNewBatch(OS_OBJECT_TYPE_OS_BINSEM, &names[2], 1, &other_token),
+                           OS_ERR_NAME_TAKEN);
+
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFinalizeNewBatch(OS_SUCCESS, tokens, 3, objids), OS_SUCCESS);
+    for (i = 0; i < 3; ++i)
+    {
+        record = OS_ObjectIdGlobalFromToken(&tokens[i]);
+        UtAssert_UINT32_EQ(tokens[i].lock_mode, OS_LOCK_MODE_NONE);
+        OSAPI_TEST_OBJID(objids[i], ==, tokens[i].obj_id);
+        OSAPI_TEST_OBJID(record->active_id, ==, tokens[i].obj_id);
+        UtAssert_UINT32_EQ(record->refcount, 0);
+    }
+
+    /* A duplicate name within the same batch should also be detected, and nothing allocated */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdAllocateNewBatch(OS_OBJECT_TYPE_OS_BINSEM, dup_names, 2, &tokens[3]),
+                           OS_ERR_NAME_TAKEN);
+    UtAssert_UINT32_EQ(tokens[3].lock_mode, OS_LOCK_MODE_NONE);
+    OSAPI_TEST_OBJID(OS_ObjectIdGlobalFromToken(&tokens[3])->active_id, ==, OS_OBJECT_ID_UNDEFINED);
+
+    /* A late failure should release all IDs issued so far */
+    UT_SetDeferredRetcode(UT_KEY(OS_NotifyEvent), 2, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdAllocateNewBatch(OS_OBJECT_TYPE_OS_BINSEM, new_names, 2, &tokens[3]), OS_ERROR);
+    for (i = 3; i < 5; ++i)
+    {
+        UtAssert_UINT32_EQ(tokens[i].lock_mode, OS_LOCK_MODE_NONE);
+        OSAPI_TEST_OBJID(OS_ObjectIdGlobalFromToken(&tokens[i])->active_id, ==, OS_OBJECT_ID_UNDEFINED);
+    }
+
+    /* Not enough free IDs */
+    memset(no_names, 0, sizeof(no_names));
+    OSAPI_TEST_FUNCTION_RC(
+        OS_ObjectIdAllocateNewBatch(OS_OBJECT_TYPE_OS_BINSEM, no_names, OS_MAX_BIN_SEMAPHORES + 1, tokens),
+        OS_ERR_NO_FREE_IDS);
+    UtAssert_UINT32_EQ(tokens[0].lock_mode, OS_LOCK_MODE_NONE);
+
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdAllocateNewBatch(0xFFFF, names, 3, tokens), OS_ERR_INVALID_ID);
+
+    OS_SharedGlobalVars.GlobalState = OS_SHUTDOWN_MAGIC_NUMBER;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdAllocateNewBatch(OS_OBJECT_TYPE_OS_BINSEM, new_names, 2, tokens),
+                           OS_ERR_INCORRECT_OBJ_STATE);
+    OS_SharedGlobalVars.GlobalState = OS_INIT_MAGIC_NUMBER;
+
+    /* If creation fails, the IDs should be released and set to UNDEFINED */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdAllocateNewBatch(OS_OBJECT_TYPE_OS_BINSEM, new_names, 2, tokens), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFinalizeNewBatch(OS_ERROR, tokens, 2, other_ids), OS_ERROR);
+    for (i = 0; i < 2; ++i)
+    {
+        UtAssert_UINT32_EQ(tokens[i].lock_mode, OS_LOCK_MODE_NONE);
+        OSAPI_TEST_OBJID(other_ids[i], ==, OS_OBJECT_ID_UNDEFINED);
+        OSAPI_TEST_OBJID(OS_ObjectIdGlobalFromToken(&tokens[i])->active_id, ==, OS_OBJECT_ID_UNDEFINED);
+    }
+
+    /*
+     * Lock all three objects for deletion, where the second is transiently
+     * RESERVED by another task and the third is in use, so both must be waited for.
+     */
+    OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_BINSEM, objids[1], &other_token.obj_idx);
+    other_token.obj_type = OS_OBJECT_TYPE_OS_BINSEM;
+    other_token.obj_id   = objids[1];
+    OS_ObjectIdGlobalFromToken(&other_token)->active_id = OS_OBJECT_ID_RESERVED;
+    UT_SetHookFunction(UT_KEY(OS_WaitForStateChange_Impl), UT_Hook_RestoreActiveId, &other_token);
+    tokens[2] = other_token;
+    OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_BINSEM, objids[2], &tokens[2].obj_idx);
+    record           = OS_ObjectIdGlobalFromToken(&tokens[2]);
+    record->refcount = 1;
+    UT_SetHookFunction(UT_KEY(OS_WaitForHandoff_Impl), UT_Hook_ReleaseRefcount, record);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdBatch(OS_OBJECT_TYPE_OS_BINSEM, objids, 3, tokens), OS_SUCCESS);
+    UT_SetHookFunction(UT_KEY(OS_WaitForStateChange_Impl), NULL, NULL);
+    UT_SetHookFunction(UT_KEY(OS_WaitForHandoff_Impl), NULL, NULL);
+    UtAssert_STUB_COUNT(OS_WaitForStateChange_Impl, 1);
+    UtAssert_STUB_COUNT(OS_WaitForHandoff_Impl, 1);
+    for (i = 0; i < 3; ++i)
+    {
+        record = OS_ObjectIdGlobalFromToken(&tokens[i]);
+        UtAssert_UINT32_EQ(tokens[i].lock_mode, OS_LOCK_MODE_EXCLUSIVE);
+        OSAPI_TEST_OBJID(tokens[i].obj_id, ==, objids[i]);
+        OSAPI_TEST_OBJID(record->active_id, ==, OS_OBJECT_ID_RESERVED);
+        UtAssert_UINT32_EQ(record->refcount, 1);
+    }
+
+    /* Only the first delete succeeds, the first error is returned */
+    status[0] = OS_SUCCESS;
+    status[1] = OS_ERROR;
+    status[2] = OS_ERR_INVALID_ID;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFinalizeDeleteBatch(status, tokens, 3), OS_ERROR);
+    for (i = 0; i < 3; ++i)
+    {
+        UtAssert_UINT32_EQ(tokens[i].lock_mode, OS_LOCK_MODE_NONE);
+        UtAssert_UINT32_EQ(OS_ObjectIdGlobalFromToken(&tokens[i])->refcount, 0);
+    }
+    OSAPI_TEST_OBJID(OS_ObjectIdGlobalFromToken(&tokens[0])->active_id, ==, OS_OBJECT_ID_UNDEFINED);
+    OSAPI_TEST_OBJID(OS_ObjectIdGlobalFromToken(&tokens[1])->active_id, ==, objids[1]);
+    OSAPI_TEST_OBJID(OS_ObjectIdGlobalFromToken(&tokens[2])->active_id, ==, objids[2]);
+
+    /* Undefined, duplicate, and deleted IDs are not locked, but the others still are */
+    other_ids[0] = OS_OBJECT_ID_UNDEFINED;
+    other_ids[1] = objids[1];
+    other_ids[2] = objids[1];
+    other_ids[3] = objids[0];
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdBatch(OS_OBJECT_TYPE_OS_BINSEM, other_ids, 4, tokens),
+                           OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(tokens[0].lock_mode, OS_LOCK_MODE_NONE);
+    UtAssert_UINT32_EQ(tokens[1].lock_mode, OS_LOCK_MODE_EXCLUSIVE);
+    UtAssert_UINT32_EQ(tokens[2].lock_mode, OS_LOCK_MODE_NONE);
+    UtAssert_UINT32_EQ(tokens[3].lock_mode, OS_LOCK_MODE_NONE);
+
+    status[1] = OS_SUCCESS;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFinalizeDeleteBatch(status, tokens, 4), OS_SUCCESS);
+    OSAPI_TEST_OBJID(OS_ObjectIdGlobalFromToken(&tokens[1])->active_id, ==, OS_OBJECT_ID_UNDEFINED);
+
+    /* Nothing is locked, so there is nothing to do */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFinalizeDeleteBatch(status, tokens, 4), OS_SUCCESS);
+
+    tokens[0].lock_mode = OS_LOCK_MODE_EXCLUSIVE;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdBatch(0xFFFF, objids, 1, tokens), OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(tokens[0].lock_mode, OS_LOCK_MODE_NONE);
+
+    /* Every lock of the table should have been released */
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_Lock_Global_Impl)), UT_GetStubCount(UT_KEY(OS_Unlock_Global_Impl)));
+}
+
 void Test_OS_ForEachObject(void)
 {
     /*
@@ -1061,6 +1554,103 @@ void Test_OS_ForEachObject(void)
                   (unsigned long)Count.MutexCount);
 }
 
+void Test_OS_ForEachObjectNonBlocking(void)
+{
+    /*
+     * Test Case For:
+     * void OS_ForEachObjectNonBlocking(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void *callback_arg);
+     * void OS_ForEachObjectOfTypeNonBlocking(osal_objtype_t objtype, osal_id_t creator_id,
+     *                                        OS_ArgCallback_t callback_ptr, void *callback_arg);
+     */
+    OS_object_token_t      token;
+    UT_idbuf_t             self_id;
+    Test_OS_ObjTypeCount_t Count;
+
+    self_id.id = OS_TaskGetId();
+
+    memset(&Count, 0, sizeof(Count));
+    memset(&token, 0, sizeof(token));
+
+    while (token.obj_type < OS_OBJECT_TYPE_USER)
+    {
+        if (OS_ObjectIdFindNextFree(&token) == OS_SUCCESS)
+        {
+            OS_ObjectIdGlobalFromToken(&token)->active_id = token.obj_id;
+        }
+        ++token.obj_type;
+    }
+
+    /* a record in the process of being created/deleted is not valid, and should be skipped */
+    token.obj_type = OS_OBJECT_TYPE_OS_MUTEX;
+    OS_ObjectIdFindNextFree(&token);
+    OS_ObjectIdGlobalFromToken(&token)->active_id = OS_OBJECT_ID_RESERVED;
+
+    OS_ForEachObjectNonBlocking(OS_OBJECT_CREATOR_ANY, &ObjTypeCounter, &Count);
+    UtAssert_UINT32_EQ(Count.TaskCount, 1);
+    UtAssert_UINT32_EQ(Count.QueueCount, 1);
+    UtAssert_UINT32_EQ(Count.MutexCount, 1);
+    UtAssert_UINT32_EQ(Count.OtherCount, 11);
+
+    OS_ForEachObjectOfTypeNonBlocking(OS_OBJECT_TYPE_OS_QUEUE, self_id.id, ObjTypeCounter, &Count);
+    UtAssert_UINT32_EQ(Count.QueueCount, 2);
+
+    self_id.val ^= 0x01;
+    OS_ForEachObjectOfTypeNonBlocking(OS_OBJECT_TYPE_OS_QUEUE, self_id.id, ObjTypeCounter, &Count);
+    UtAssert_UINT32_EQ(Count.QueueCount, 2);
+
+    /* Nothing is done if OSAL is not initialized */
+    OS_SharedGlobalVars.GlobalState = 0;
+    OS_ForEachObjectOfTypeNonBlocking(OS_OBJECT_TYPE_OS_QUEUE, OS_OBJECT_CREATOR_ANY, ObjTypeCounter, &Count);
+    UtAssert_UINT32_EQ(Count.QueueCount, 2);
+}
+
+void Test_OS_ObjectIdSnapshot(void)
+{
+    /*
+     * Test Case For:
+     * void OS_ObjectIdSnapshotInit(OS_ObjectMatchFunc_t matchfunc, void *matcharg, osal_objtype_t objtype,
+     *                              OS_object_snapshot_t *snap);
+     * bool OS_ObjectIdSnapshotNext(OS_object_snapshot_t *snap);
+     */
+    OS_object_snapshot_t snap;
+    OS_object_token_t    token;
+    uint32               total;
+    uint32               passes;
+    uint32               i;
+
+    /* Activate more tasks than fit into a single batch */
+    memset(&token, 0, sizeof(token));
+    token.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    for (i = 0; i < OS_OBJECT_SNAPSHOT_SIZE + 1; ++i)
+    {
+        UtAssert_INT32_EQ(OS_ObjectIdFindNextFree(&token), OS_SUCCESS);
+        OS_ObjectIdGlobalFromToken(&token)->active_id = token.obj_id;
+    }
+
+    total  = 0;
+    passes = 0;
+    OS_ObjectIdSnapshotInit(OS_ObjectFilterActive, NULL, OS_OBJECT_TYPE_OS_TASK, &snap);
+    while (OS_ObjectIdSnapshotNext(&snap))
+    {
+        UtAssert_UINT32_EQ(OS_IdentifyObject(snap.ids[0]), OS_OBJECT_TYPE_OS_TASK);
+        total += snap.count;
+        ++passes;
+    }
+    UtAssert_UINT32_EQ(total, OS_OBJECT_SNAPSHOT_SIZE + 1);
+    UtAssert_UINT32_EQ(passes, 2);
+    UtAssert_ZERO(snap.count);
+
+    /* With no match function, every record is collected */
+    OS_ObjectIdSnapshotInit(NULL, NULL, OS_OBJECT_TYPE_OS_TASK, &snap);
+    UtAssert_BOOL_TRUE(OS_ObjectIdSnapshotNext(&snap));
+    UtAssert_UINT32_EQ(snap.count, OS_OBJECT_SNAPSHOT_SIZE);
+
+    /* Nothing is collected if the table cannot be locked */
+    OS_SharedGlobalVars.GlobalState = 0;
+    OS_ObjectIdSnapshotInit(NULL, NULL, OS_OBJECT_TYPE_OS_TASK, &snap);
+    UtAssert_BOOL_FALSE(OS_ObjectIdSnapshotNext(&snap));
+}
+
 void Test_OS_GetResourceName(void)
 {
     /*
@@ -1102,6 +1692,58 @@ void Test_OS_GetResourceName(void)
     OSAPI_TEST_FUNCTION_RC(OS_GetResourceName(token.obj_id, NameBuffer, OSAL_SIZE_C(UINT32_MAX)), OS_ERR_INVALID_SIZE);
 }
 
+void Test_OS_GetObjectTypeLockStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GetObjectTypeLockStats(osal_objtype_t objtype, OS_lock_stats_t *stats)
+     */
+    OS_object_token_t token1;
+    OS_object_token_t token2;
+    OS_lock_stats_t   stats;
+    OS_time_t         clock;
+
+    clock = OS_TIME_ZERO;
+    UT_SetHandlerFunction(UT_KEY(OS_GetMonotonicTime_Impl), UT_Handler_AdvancingClock, &clock);
+
+    memset(&token1, 0, sizeof(token1));
+    token1.obj_type  = OS_OBJECT_TYPE_OS_MUTEX;
+    token1.lock_mode = OS_LOCK_MODE_GLOBAL;
+    token2           = token1;
+
+    /* one uncontended acquisition, with a wait in the middle that is not counted as holding the lock */
+    OS_Lock_Global(&token1);
+    OS_WaitForStateChange(&token1, OS_PEND);
+    OS_WaitForHandoff(&token1, OS_PEND);
+    OS_Unlock_Global(&token1);
+
+    /* the query itself is the second acquisition */
+    OSAPI_TEST_FUNCTION_RC(OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_OS_MUTEX, &stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.acquisitions, 2);
+    UtAssert_UINT32_EQ(stats.contended_acquisitions, 0);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(stats.total_wait_time), 2);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(stats.max_wait_time), 1);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(stats.total_hold_time), 3);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(stats.max_hold_time), 1);
+
+    /* acquisition while the table is already held is contended */
+    OS_Lock_Global(&token1);
+    OS_Lock_Global(&token2);
+    OS_Unlock_Global(&token2);
+    OS_Unlock_Global(&token1);
+    OSAPI_TEST_FUNCTION_RC(OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_OS_MUTEX, &stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.acquisitions, 5);
+    UtAssert_UINT32_EQ(stats.contended_acquisitions, 1);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(stats.max_hold_time), 2);
+
+    /* other types are not affected */
+    OSAPI_TEST_FUNCTION_RC(OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_OS_TASK, &stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.acquisitions, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_OS_MUTEX, NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_GetObjectTypeLockStats(OS_OBJECT_TYPE_UNDEFINED, &stats), OS_ERR_INVALID_ID);
+}
+
 void Test_OS_ObjectIdIterator(void)
 {
     /*
@@ -1110,8 +1752,10 @@ void Test_OS_ObjectIdIterator(void)
      * OS_ObjectIdIteratorGetNext, OS_ObjectIdIteratorDestroy, OS_ObjectIdIteratorProcessEntry
      */
     OS_object_iter_t   iter;
+    OS_object_token_t  token;
     OS_common_record_t rec;
     uint32             testarg;
+    uint32             count;
 
     OSAPI_TEST_FUNCTION_RC(OS_ObjectIdIteratorInit(NULL, NULL, OS_OBJECT_TYPE_UNDEFINED, &iter), OS_ERR_INVALID_ID);
 
@@ -1130,6 +1774,18 @@ void Test_OS_ObjectIdIterator(void)
     rec.active_id = UT_OBJID_1;
     UtAssert_True(OS_ObjectFilterActive(NULL, NULL, &rec), "OS_ObjectFilterActive() non-empty record");
 
+    /* Only the single active record should be returned before reaching the end of the table */
+    memset(&token, 0, sizeof(token));
+    token.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    OS_ObjectIdFindNextFree(&token);
+    count = 0;
+    while (OS_ObjectIdIteratorGetNext(&iter))
+    {
+        UtAssert_True(OS_ObjectIdEqual(iter.token.obj_id, token.obj_id), "OS_ObjectIdIteratorGetNext() active ID");
+        ++count;
+    }
+    UtAssert_UINT32_EQ(count, 1);
+
     /* OS_ObjectIdIteratorProcessEntry unlocks and re-locks */
     testarg  = 4;
     iter.arg = &testarg;
@@ -1181,7 +1837,7 @@ void Test_OS_ObjectIDInteger(void)
         }
     }
 
-    UtAssert_True(recordscount < OS_MAX_TOTAL_RECORDS, "All Id types checked");
+    UtAssert_True(recordscount == OS_MAX_TOTAL_RECORDS, "All Id types checked");
 
     for (i = 0; i < recordscount; i++)
     {
@@ -1225,9 +1881,10 @@ void Test_OS_ObjectIDUndefined(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
+    UT_SetDataBuffer(UT_KEY(OCS_malloc), UT_ObjectHeap, sizeof(UT_ObjectHeap), false);
 
-    /* for sanity also clear out the task table, which is used by several test cases */
-    memset(OS_global_task_table, 0, OS_MAX_TASKS * sizeof(OS_common_record_t));
+    /* for sanity also reset the object tables and free queues, which are used by several test cases */
+    OS_ObjectIdInit();
 
     /*
      * The OS_SharedGlobalVars is also used here, but set the
@@ -1235,6 +1892,10 @@ void Osapi_Test_Setup(void)
      */
     memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
     OS_SharedGlobalVars.GlobalState = OS_INIT_MAGIC_NUMBER;
+
+    /* the monotonic clock must advance, so that waiting for a busy object eventually times out */
+    UT_Setup_Clock = OS_TIME_ZERO;
+    UT_SetHandlerFunction(UT_KEY(OS_GetMonotonicTime_Impl), UT_Handler_AdvancingClock, &UT_Setup_Clock);
 }
 
 /*
@@ -1251,21 +1912,28 @@ void Osapi_Test_Teardown(void) {}
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_ObjectIdInit);
+    ADD_TEST(OS_ObjectIdTableAlloc);
     ADD_TEST(OS_LockUnlockGlobal);
     ADD_TEST(OS_ObjectIdFindNextFree);
     ADD_TEST(OS_ObjectIdToArrayIndex);
     ADD_TEST(OS_ObjectIdFindByName);
+    ADD_TEST(OS_ObjectIdNameIndex);
     ADD_TEST(OS_ObjectIdGetById);
     ADD_TEST(OS_ObjectIdTransaction);
     ADD_TEST(OS_ObjectIdAllocateNew);
     ADD_TEST(OS_ObjectIdFinalize);
+    ADD_TEST(OS_ObjectIdBatch);
     ADD_TEST(OS_ObjectIdConvertToken);
     ADD_TEST(OS_ObjectIdGetBySearch);
     ADD_TEST(OS_ConvertToArrayIndex);
     ADD_TEST(OS_ForEachObject);
+    ADD_TEST(OS_ForEachObjectNonBlocking);
+    ADD_TEST(OS_ObjectIdSnapshot);
     ADD_TEST(OS_GetMaxForObjectType);
+    ADD_TEST(OS_GetHighestMaxForObjectType);
     ADD_TEST(OS_GetBaseForObjectType);
     ADD_TEST(OS_GetResourceName);
+    ADD_TEST(OS_GetObjectTypeLockStats);
     ADD_TEST(OS_ObjectIdIterator);
     ADD_TEST(OS_ObjectIDInteger);
     ADD_TEST(OS_ObjectIDUndefined);
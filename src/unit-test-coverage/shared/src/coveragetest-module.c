@@ -107,7 +107,7 @@ void Test_OS_ModuleUnload(void)
     osal_id_t objid;
 
     /* Clear module table */
-    memset(OS_module_table, 0, sizeof(OS_module_table));
+    memset(OS_module_table, 0, sizeof(*OS_module_table) * OS_MAX_MODULES);
 
     /* Set up one dynamic and one static entry */
     OSAPI_TEST_FUNCTION_RC(OS_ModuleLoad(&objid, "UT", "File", OS_MODULE_FLAG_GLOBAL_SYMBOLS), OS_SUCCESS);
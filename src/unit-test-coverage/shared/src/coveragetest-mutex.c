@@ -24,9 +24,20 @@
  */
 #include "os-shared-coveragetest.h"
 #include "os-shared-mutex.h"
+#include "os-shared-clock.h"
 
 #include "OCS_string.h"
 
+/* OS_GetMonotonicTime_Impl handler which returns the time in UserObj, then advances it by 10 usec */
+static void UT_Handler_StepClock(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *time_struct = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+    OS_time_t *now         = UserObj;
+
+    *time_struct = *now;
+    *now         = OS_TimeAdd(*now, OS_TimeFromTotalMicroseconds(10));
+}
+
 /*
 **********************************************************************************
 **          PUBLIC API FUNCTIONS
@@ -168,6 +179,97 @@ void Test_OS_MutSemGetInfo(void)
     OSAPI_TEST_FUNCTION_RC(OS_MutSemGetInfo(UT_OBJID_1, &prop), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_MutSemStats(void)
+{
+    /*
+     * Test Case For:
+     * Statistics recorded by OS_MutSemTake() and OS_MutSemGive()
+     */
+    OS_mutex_internal_record_t *mutex;
+    OS_time_t                   now;
+
+    mutex = &OS_mutex_table[1];
+    memset(mutex, 0, sizeof(*mutex));
+    now = OS_TimeFromTotalMicroseconds(100);
+    UT_SetHandlerFunction(UT_KEY(OS_GetMonotonicTime_Impl), UT_Handler_StepClock, &now);
+
+    /* an uncontended take does not wait, and the time held is measured up to the give */
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemTake(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_UINT32_EQ(mutex->stats.take_count, 1);
+    UtAssert_ZERO(mutex->stats.contended_count);
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemGive(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_True(OS_TimeGetTotalMicroseconds(mutex->stats.max_hold_time) == 10, "max_hold_time == 10 usec");
+    OSAPI_TEST_OBJID(mutex->stats.max_hold_task, ==, OS_TaskGetId());
+
+    /* a take which finds the mutex held by another task is contended */
+    mutex->last_owner = UT_OBJID_OTHER;
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemTake(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_UINT32_EQ(mutex->stats.take_count, 2);
+    UtAssert_UINT32_EQ(mutex->stats.contended_count, 1);
+    UtAssert_True(OS_TimeGetTotalMicroseconds(mutex->stats.total_wait_time) == 10, "total_wait_time == 10 usec");
+    UtAssert_True(OS_TimeGetTotalMicroseconds(mutex->stats.max_wait_time) == 10, "max_wait_time == 10 usec");
+
+    /* a nested take by the owner is not */
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemTake(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_UINT32_EQ(mutex->stats.take_count, 3);
+    UtAssert_UINT32_EQ(mutex->stats.contended_count, 1);
+
+    /* a give by a task which did not take the mutex does not measure the time held */
+    mutex->last_owner = UT_OBJID_OTHER;
+    mutex->take_time  = OS_TIME_ZERO;
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemGive(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_True(OS_TimeGetTotalMicroseconds(mutex->stats.max_hold_time) == 10, "max_hold_time == 10 usec");
+
+    /* a failed take is not counted */
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemTake_Impl), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemTake(UT_OBJID_1), OS_ERROR);
+    UtAssert_UINT32_EQ(mutex->stats.take_count, 3);
+}
+
+void Test_OS_MutSemGetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MutSemGetStats(osal_id_t sem_id, OS_mut_sem_stats_t *stats)
+     */
+    OS_mut_sem_stats_t stats;
+
+    memset(&OS_mutex_table[1], 0, sizeof(OS_mutex_table[1]));
+    OS_mutex_table[1].stats.take_count      = 5;
+    OS_mutex_table[1].stats.contended_count = 2;
+    OS_mutex_table[1].stats.max_hold_task   = UT_OBJID_OTHER;
+
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemGetStats(UT_OBJID_1, &stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.take_count, 5);
+    UtAssert_UINT32_EQ(stats.contended_count, 2);
+    OSAPI_TEST_OBJID(stats.max_hold_task, ==, UT_OBJID_OTHER);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemGetStats(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemGetStats(UT_OBJID_1, &stats), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_MutSemResetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_MutSemResetStats(osal_id_t sem_id)
+     */
+    memset(&OS_mutex_table[1], 0, sizeof(OS_mutex_table[1]));
+    OS_mutex_table[1].stats.take_count    = 5;
+    OS_mutex_table[1].stats.max_wait_time = OS_TimeFromTotalMicroseconds(20);
+
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemResetStats(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_ZERO(OS_mutex_table[1].stats.take_count);
+    UtAssert_True(OS_TimeGetTotalMicroseconds(OS_mutex_table[1].stats.max_wait_time) == 0, "max_wait_time == 0");
+
+    /* test error cases */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_MutSemResetStats(UT_OBJID_1), OS_ERR_INVALID_ID);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -198,4 +300,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_MutSemTake);
     ADD_TEST(OS_MutSemGetIdByName);
     ADD_TEST(OS_MutSemGetInfo);
+    ADD_TEST(OS_MutSemStats);
+    ADD_TEST(OS_MutSemGetStats);
+    ADD_TEST(OS_MutSemResetStats);
 }
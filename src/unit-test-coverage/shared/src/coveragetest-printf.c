@@ -51,6 +51,11 @@ void Test_OS_ConsoleAPI_Init(void)
     UtAssert_STUB_COUNT(OS_ConsoleCreate_Impl, 1);
     UT_ResetState(UT_KEY(OS_ConsoleCreate_Impl));
 
+    /* Fail to allocate the console table */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdTableAlloc), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_ConsoleAPI_Init(), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_ConsoleCreate_Impl, 0);
+
     /* Fail OS_ObjectIdAllocateNew */
     UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdAllocateNew), OS_ERROR);
     OS_ConsoleAPI_Init();
@@ -132,6 +137,9 @@ void Test_OS_printf(void)
     UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 0);
 }
 
+/* Storage for the table that OS_ObjectIdTableAlloc() provides in normal operation */
+static OS_console_internal_record_t UT_console_records[OS_MAX_CONSOLES];
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -140,7 +148,8 @@ void Test_OS_printf(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
-    memset(OS_console_table, 0, sizeof(OS_console_table));
+    memset(UT_console_records, 0, sizeof(UT_console_records));
+    OS_console_table = UT_console_records;
     memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
     OS_console_table[0].BufBase = TestConsoleBuffer;
     OS_console_table[0].BufSize = sizeof(TestConsoleBuffer);
@@ -24,9 +24,18 @@
  */
 #include "os-shared-coveragetest.h"
 #include "os-shared-queue.h"
+#include "os-shared-clock.h"
 
 #include "OCS_string.h"
 
+/* OS_GetMonotonicTime_Impl handler which returns the time in UserObj */
+static void UT_Handler_FixedClock(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *time_struct = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+
+    *time_struct = *((OS_time_t *)UserObj);
+}
+
 /*
 **********************************************************************************
 **          PUBLIC API FUNCTIONS
@@ -80,9 +89,195 @@ void Test_OS_QueueDelete(void)
      */
 
     OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueDeletePending_Impl, 1);
+
+    /* the reference to the broadcast queue held by a subscriber is released along with the mark */
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 2);
+
+    /* the queue is no longer marked if it could not be deleted */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueDelete_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_QueueDeletePending_Impl, 3);
+
+    /* the implementation may refuse to mark the queue */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueDeletePending_Impl), 1, OS_ERR_OBJECT_IN_USE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_ERR_OBJECT_IN_USE);
+    UtAssert_STUB_COUNT(OS_QueueDelete_Impl, 2);
 
     UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_QueueDelete(UT_OBJID_1), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_QueueDeletePending_Impl, 4);
+}
+
+void Test_OS_QueueCreatePacked(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueCreatePacked(osal_id_t *queue_id, const char *queue_name, size_t byte_budget, size_t max_size,
+     *          uint32 flags)
+     */
+    osal_id_t objid;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreatePacked(&objid, "UT", OSAL_SIZE_C(100), OSAL_SIZE_C(8), 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueCreate_Impl, 1);
+    UtAssert_UINT32_EQ(OS_queue_table[1].max_depth, 12);
+    UtAssert_UINT32_EQ(OS_queue_table[1].max_size, 8);
+    UtAssert_UINT32_EQ(OS_queue_table[1].max_bytes, 100);
+
+    /* the depth for implementations which do not pack messages is limited */
+    OSAPI_TEST_FUNCTION_RC(
+        OS_QueueCreatePacked(&objid, "UT", OSAL_SIZE_C(4 * (1 + OS_QUEUE_MAX_DEPTH)), OSAL_SIZE_C(4), 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_queue_table[2].max_depth, OS_QUEUE_MAX_DEPTH);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreatePacked(NULL, "UT", OSAL_SIZE_C(100), OSAL_SIZE_C(8), 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreatePacked(&objid, NULL, OSAL_SIZE_C(100), OSAL_SIZE_C(8), 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreatePacked(&objid, "UT", OSAL_SIZE_C(100), OSAL_SIZE_C(0), 0),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreatePacked(&objid, "UT", OSAL_SIZE_C(4), OSAL_SIZE_C(8), 0),
+                           OS_QUEUE_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreatePacked(&objid, "UT", OSAL_SIZE_C(100), OSAL_SIZE_C(8), 0), OS_ERR_NAME_TOO_LONG);
+    UT_ClearDefaultReturnValue(UT_KEY(OCS_memchr));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdAllocateNew), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreatePacked(&objid, "UT", OSAL_SIZE_C(100), OSAL_SIZE_C(8), 0), OS_ERROR);
+}
+
+void Test_OS_QueueSubscribe(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueSubscribe(osal_id_t *queue_id, const char *queue_name, osal_id_t broadcast_id, uint32 flags)
+     */
+    osal_id_t objid;
+
+    /* the subscriber takes on the limits of the broadcast queue */
+    OS_queue_table[2].max_depth = 4;
+    OS_queue_table[2].max_size  = 8;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueSubscribe(&objid, "UT", UT_OBJID_2, OS_QUEUE_FLAG_DROP_OLDEST), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueSubscribe_Impl, 1);
+
+    /* the subscriber keeps its reference to the broadcast queue until it is deleted */
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 0);
+    UtAssert_INT32_EQ(OS_queue_table[1].source.lock_mode, OS_LOCK_MODE_REFCOUNT);
+    UtAssert_UINT32_EQ(OS_queue_table[1].max_depth, 4);
+    UtAssert_UINT32_EQ(OS_queue_table[1].max_size, 8);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueSubscribe(NULL, "UT", UT_OBJID_1, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueSubscribe(&objid, NULL, UT_OBJID_1, 0), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueSubscribe(&objid, "UT", UT_OBJID_1, 0), OS_ERR_NAME_TOO_LONG);
+    UT_ClearDefaultReturnValue(UT_KEY(OCS_memchr));
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueSubscribe_Impl), 1, OS_ERR_INCORRECT_OBJ_TYPE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueSubscribe(&objid, "UT", UT_OBJID_1, 0), OS_ERR_INCORRECT_OBJ_TYPE);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+
+    /* the reference to the broadcast queue is released if the allocation fails */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdAllocateNew), OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueSubscribe(&objid, "UT", UT_OBJID_1, 0), OS_ERR_NO_FREE_IDS);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 2);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueSubscribe(&objid, "UT", UT_OBJID_1, 0), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 2);
+}
+
+void Test_OS_QueueCreateBatch(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueCreateBatch(osal_id_t *queue_ids, const char *const *queue_names, uint32 count,
+     *          osal_blockcount_t queue_depth, size_t data_size, uint32 flags)
+     */
+    osal_id_t   objids[OS_OBJECT_BATCH_SIZE + 2];
+    const char *names[OS_OBJECT_BATCH_SIZE + 2];
+    uint32      i;
+
+    for (i = 0; i < OS_OBJECT_BATCH_SIZE + 2; ++i)
+    {
+        names[i] = "UT";
+    }
+
+    /* this requires more than one group */
+    OSAPI_TEST_FUNCTION_RC(
+        OS_QueueCreateBatch(objids, names, OS_OBJECT_BATCH_SIZE + 2, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(4), 0),
+        OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_ObjectIdAllocateNewBatch, 2);
+    UtAssert_STUB_COUNT(OS_QueueCreate_Impl, OS_OBJECT_BATCH_SIZE + 2);
+    UtAssert_UINT32_EQ(OS_queue_table[1].max_depth, 4);
+    UtAssert_UINT32_EQ(OS_queue_table[1].max_size, 4);
+    OSAPI_TEST_OBJID(objids[OS_OBJECT_BATCH_SIZE + 1], !=, OS_OBJECT_ID_UNDEFINED);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreateBatch(NULL, names, 2, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(4), 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreateBatch(objids, NULL, 2, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(4), 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreateBatch(objids, names, 2, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(0), 0),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(
+        OS_QueueCreateBatch(objids, names, 2, OSAL_BLOCKCOUNT_C(1 + OS_QUEUE_MAX_DEPTH), OSAL_SIZE_C(4), 0),
+        OS_QUEUE_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreateBatch(objids, names, 0, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(4), 0),
+                           OS_ERR_INVALID_SIZE);
+    names[1] = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreateBatch(objids, names, 2, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(4), 0),
+                           OS_INVALID_POINTER);
+    names[1] = "UT";
+
+    /* failure in the second group must delete the queues from the first */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdAllocateNewBatch), 2, OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(
+        OS_QueueCreateBatch(objids, names, OS_OBJECT_BATCH_SIZE + 2, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(4), 0),
+        OS_ERR_NO_FREE_IDS);
+    UtAssert_STUB_COUNT(OS_QueueDelete_Impl, OS_OBJECT_BATCH_SIZE);
+    OSAPI_TEST_OBJID(objids[0], ==, OS_OBJECT_ID_UNDEFINED);
+
+    /* failure of an implementation call must delete the others in the same group */
+    UT_ResetState(UT_KEY(OS_QueueDelete_Impl));
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueCreate_Impl), 2, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCreateBatch(objids, names, 2, OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(4), 0), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_QueueDelete_Impl, 1);
+    OSAPI_TEST_OBJID(objids[0], ==, OS_OBJECT_ID_UNDEFINED);
+}
+
+void Test_OS_QueueDeleteBatch(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueDeleteBatch(const osal_id_t *queue_ids, uint32 count)
+     */
+    osal_id_t objids[OS_OBJECT_BATCH_SIZE + 1];
+    uint32    i;
+
+    for (i = 0; i < OS_OBJECT_BATCH_SIZE + 1; ++i)
+    {
+        objids[i] = UT_OBJID_1;
+    }
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDeleteBatch(objids, OS_OBJECT_BATCH_SIZE + 1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueDelete_Impl, OS_OBJECT_BATCH_SIZE + 1);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDeleteBatch(NULL, 1), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDeleteBatch(objids, 0), OS_ERR_INVALID_SIZE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetByIdBatch), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDeleteBatch(objids, 2), OS_ERROR);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueDelete_Impl), 2, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDeleteBatch(objids, 2), OS_ERROR);
+
+    /* a queue which the implementation refuses to mark is skipped */
+    UT_ResetState(UT_KEY(OS_QueueDeletePending_Impl));
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueDeletePending_Impl), 2, OS_ERR_OBJECT_IN_USE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDeleteBatch(objids, 2), OS_ERR_OBJECT_IN_USE);
+    UtAssert_STUB_COUNT(OS_QueueDeletePending_Impl, 2);
 }
 
 void Test_OS_QueueGet(void)
@@ -106,10 +301,53 @@ void Test_OS_QueueGet(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueueGet(UT_OBJID_1, Buf, OSAL_SIZE_C(0), &actual_size, 0), OS_ERR_INVALID_SIZE);
     OSAPI_TEST_FUNCTION_RC(OS_QueueGet(UT_OBJID_1, Buf, OSAL_SIZE_C(UINT32_MAX), &actual_size, 0), OS_ERR_INVALID_SIZE);
 
+    /* the reference is held until the operation is done if the implementation requires it */
+    OS_queue_table[1].max_size   = sizeof(Buf);
+    OS_queue_table[1].referenced = true;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGet(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, 0), OS_SUCCESS);
+    OS_queue_table[1].referenced = false;
+
     UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_QueueGet(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, 0), OS_ERROR);
 }
 
+void Test_OS_QueueGetWithPriority(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetWithPriority(osal_id_t queue_id, void *data, size_t size, size_t *size_copied,
+     *                               uint32 *priority, int32 timeout)
+     */
+    size_t actual_size;
+    uint32 priority;
+    char   Buf[4];
+
+    OS_queue_table[1].max_size = sizeof(Buf);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetWithPriority(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, &priority, 0),
+                           OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueGetWithPriority_Impl, 1);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetWithPriority(UT_OBJID_1, NULL, sizeof(Buf), &actual_size, &priority, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetWithPriority(UT_OBJID_1, Buf, sizeof(Buf), NULL, &priority, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetWithPriority(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, NULL, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetWithPriority(UT_OBJID_1, Buf, OSAL_SIZE_C(0), &actual_size, &priority, 0),
+                           OS_ERR_INVALID_SIZE);
+
+    OS_queue_table[1].max_size = sizeof(Buf) + 10;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetWithPriority(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, &priority, 0),
+                           OS_QUEUE_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetWithPriority(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, &priority, 0),
+                           OS_ERROR);
+    UtAssert_STUB_COUNT(OS_QueueGetWithPriority_Impl, 1);
+}
+
 void Test_OS_QueuePut(void)
 {
     /*
@@ -122,9 +360,13 @@ void Test_OS_QueuePut(void)
     OS_queue_table[1].max_size  = sizeof(Data);
 
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, Data, sizeof(Data), 0), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, Data, sizeof(Data), OS_QUEUE_PRIORITY(OS_QUEUE_PRIORITY_LEVELS - 1)),
+                           OS_SUCCESS);
 
     /* test error cases */
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, NULL, sizeof(Data), 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, Data, sizeof(Data), OS_QUEUE_PRIORITY(OS_QUEUE_PRIORITY_LEVELS)),
+                           OS_ERR_INVALID_ARGUMENT);
 
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, Data, 1 + sizeof(Data), 0), OS_QUEUE_INVALID_SIZE);
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, Data, OSAL_SIZE_C(0), 0), OS_ERR_INVALID_SIZE);
@@ -134,6 +376,225 @@ void Test_OS_QueuePut(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut(UT_OBJID_1, Data, sizeof(Data), 0), OS_ERROR);
 }
 
+void Test_OS_QueuePutTimed(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueuePutTimed(osal_id_t queue_id, const void *data, size_t size, uint32 flags, int32 timeout)
+     */
+    const char Data[4] = "xyz";
+
+    OS_queue_table[1].max_depth = 10;
+    OS_queue_table[1].max_size  = sizeof(Data);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed(UT_OBJID_1, Data, sizeof(Data), 0, 100), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueuePutTimed_Impl, 1);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed(UT_OBJID_1, NULL, sizeof(Data), 0, 100), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(
+        OS_QueuePutTimed(UT_OBJID_1, Data, sizeof(Data), OS_QUEUE_PRIORITY(OS_QUEUE_PRIORITY_LEVELS), 100),
+        OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed(UT_OBJID_1, Data, 1 + sizeof(Data), 0, 100), OS_QUEUE_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed(UT_OBJID_1, Data, OSAL_SIZE_C(0), 0, 100), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed(UT_OBJID_1, Data, sizeof(Data), 0, 100), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_QueuePutTimed_Impl, 1);
+}
+
+void Test_OS_QueuePutAbs(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueuePutAbs(osal_id_t queue_id, const void *data, size_t size, uint32 flags, OS_time_t abs_timeout)
+     */
+    const char Data[4] = "xyz";
+
+    OS_queue_table[1].max_depth = 10;
+    OS_queue_table[1].max_size  = sizeof(Data);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutAbs(UT_OBJID_1, Data, sizeof(Data), 0, OS_TimeFromTotalMilliseconds(100)),
+                           OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TimeToRelativeMilliseconds, 1);
+    UtAssert_STUB_COUNT(OS_QueuePutTimed_Impl, 1);
+}
+
+void Test_OS_QueueGetMultiple(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetMultiple(osal_id_t queue_id, void *data, size_t size, size_t *sizes, uint32 max_count,
+     *                           uint32 *count_copied, int32 timeout)
+     */
+    char   Buf[3][4];
+    size_t sizes[3];
+    uint32 count;
+
+    OS_queue_table[1].max_depth = 10;
+    OS_queue_table[1].max_size  = sizeof(Buf[0]);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple(UT_OBJID_1, Buf, sizeof(Buf[0]), sizes, 3, &count, 0), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueueGetMultiple_Impl, 1);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple(UT_OBJID_1, NULL, sizeof(Buf[0]), sizes, 3, &count, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple(UT_OBJID_1, Buf, sizeof(Buf[0]), NULL, 3, &count, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple(UT_OBJID_1, Buf, sizeof(Buf[0]), sizes, 3, NULL, 0),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple(UT_OBJID_1, Buf, OSAL_SIZE_C(0), sizes, 3, &count, 0),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple(UT_OBJID_1, Buf, sizeof(Buf[0]), sizes, 0, &count, 0),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple(UT_OBJID_1, Buf, sizeof(Buf[0]) - 1, sizes, 3, &count, 0),
+                           OS_QUEUE_INVALID_SIZE);
+    UtAssert_ZERO(count);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple(UT_OBJID_1, Buf, sizeof(Buf[0]), sizes, 3, &count, 0), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_QueueGetMultiple_Impl, 1);
+}
+
+void Test_OS_QueuePutMultiple(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueuePutMultiple(osal_id_t queue_id, const void *data, size_t size, const size_t *sizes,
+     *                           uint32 count, uint32 flags, uint32 *count_put)
+     */
+    const char Data[3][4] = {"abc", "def", "ghi"};
+    size_t     sizes[3]   = {4, 4, 4};
+    uint32     count;
+
+    OS_queue_table[1].max_depth = 10;
+    OS_queue_table[1].max_size  = sizeof(Data[0]);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, sizeof(Data[0]), sizes, 3, 0, &count), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_QueuePutMultiple_Impl, 1);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, NULL, sizeof(Data[0]), sizes, 3, 0, &count),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, sizeof(Data[0]), NULL, 3, 0, &count),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, sizeof(Data[0]), sizes, 3, 0, NULL),
+                           OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, OSAL_SIZE_C(0), sizes, 3, 0, &count),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, sizeof(Data[0]), sizes, 0, 0, &count),
+                           OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, sizeof(Data[0]), sizes, 3,
+                                               OS_QUEUE_PRIORITY(OS_QUEUE_PRIORITY_LEVELS), &count),
+                           OS_ERR_INVALID_ARGUMENT);
+
+    /* Any invalid message stops all of them from being put */
+    sizes[2] = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, sizeof(Data[0]), sizes, 3, 0, &count),
+                           OS_ERR_INVALID_SIZE);
+    sizes[2] = 5;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, 8, sizes, 3, 0, &count), OS_QUEUE_INVALID_SIZE);
+    sizes[2] = 4;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, 2, sizes, 3, 0, &count), OS_QUEUE_INVALID_SIZE);
+    UtAssert_ZERO(count);
+    UtAssert_STUB_COUNT(OS_QueuePutMultiple_Impl, 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple(UT_OBJID_1, Data, sizeof(Data[0]), sizes, 3, 0, &count), OS_ERROR);
+}
+
+void Test_OS_QueueReserve(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueReserve(osal_id_t queue_id, void **data_ptr, size_t size)
+     */
+    void *data_ptr;
+
+    OS_queue_table[1].max_depth = 10;
+    OS_queue_table[1].max_size  = 4;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data_ptr, 4), OS_SUCCESS);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, NULL, 4), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data_ptr, 5), OS_QUEUE_INVALID_SIZE);
+    UtAssert_NULL(data_ptr);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data_ptr, OSAL_SIZE_C(0)), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueReserve_Impl), OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data_ptr, 4), OS_QUEUE_FULL);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueReserve(UT_OBJID_1, &data_ptr, 4), OS_ERROR);
+}
+
+void Test_OS_QueueCommit(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueCommit(osal_id_t queue_id, void *data_ptr, size_t size, uint32 flags)
+     */
+    char Data[4] = "xyz";
+
+    OS_queue_table[1].max_depth = 10;
+    OS_queue_table[1].max_size  = sizeof(Data);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data), 0), OS_SUCCESS);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, NULL, sizeof(Data), 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, 1 + sizeof(Data), 0), OS_QUEUE_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, OSAL_SIZE_C(0), 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data), OS_QUEUE_PRIORITY(1)),
+                           OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueCommit(UT_OBJID_1, Data, sizeof(Data), 0), OS_ERROR);
+}
+
+void Test_OS_QueueGetRef(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetRef(osal_id_t queue_id, const void **data_ptr, size_t *size_copied, int32 timeout)
+     */
+    const void *data_ptr;
+    size_t      actual_size;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetRef(UT_OBJID_1, &data_ptr, &actual_size, 0), OS_SUCCESS);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetRef(UT_OBJID_1, NULL, &actual_size, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetRef(UT_OBJID_1, &data_ptr, NULL, 0), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueueGetRef_Impl), OS_QUEUE_EMPTY);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetRef(UT_OBJID_1, &data_ptr, &actual_size, OS_CHECK), OS_QUEUE_EMPTY);
+    UtAssert_NULL(data_ptr);
+    UtAssert_ZERO(actual_size);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetRef(UT_OBJID_1, &data_ptr, &actual_size, 0), OS_ERROR);
+}
+
+void Test_OS_QueueRelease(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueRelease(osal_id_t queue_id, const void *data_ptr)
+     */
+    const char Data[4] = "xyz";
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, Data), OS_SUCCESS);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueRelease(UT_OBJID_1, Data), OS_ERROR);
+}
+
 void Test_OS_QueueGetIdByName(void)
 {
     /*
@@ -175,6 +636,132 @@ void Test_OS_QueueGetInfo(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueueGetInfo(UT_OBJID_1, &queue_prop), OS_ERROR);
 }
 
+void Test_OS_QueueGetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetStats(osal_id_t queue_id, OS_queue_stats_t *stats)
+     */
+    OS_queue_stats_t stats;
+    char             Buf[4] = "xyz";
+    size_t           actual_size;
+    void *           data_ptr;
+    uint32           priority;
+
+    memset(&OS_queue_table[1], 0, sizeof(OS_queue_table[1]));
+    OS_queue_table[1].max_size = sizeof(Buf);
+
+    /* two puts and a get, so the high-water mark is 2 and the depth is 1 */
+    UtAssert_INT32_EQ(OS_QueuePut(UT_OBJID_1, Buf, sizeof(Buf), 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_QueuePutTimed(UT_OBJID_1, Buf, sizeof(Buf), 0, OS_PEND), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_QueueGet(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, OS_PEND), OS_SUCCESS);
+
+    /* a successful reservation is not counted until the commit */
+    UtAssert_INT32_EQ(OS_QueueReserve(UT_OBJID_1, &data_ptr, sizeof(Buf)), OS_SUCCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut_Impl), 1, OS_QUEUE_FULL);
+    UtAssert_INT32_EQ(OS_QueuePut(UT_OBJID_1, Buf, sizeof(Buf), 0), OS_QUEUE_FULL);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePutTimed_Impl), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(OS_QueuePutTimed(UT_OBJID_1, Buf, sizeof(Buf), 0, 10), OS_QUEUE_TIMEOUT);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(OS_QueueGet(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, 10), OS_QUEUE_TIMEOUT);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 1, OS_QUEUE_EMPTY);
+    UtAssert_INT32_EQ(OS_QueueGet(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, OS_CHECK), OS_QUEUE_EMPTY);
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetStats(UT_OBJID_1, &stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.depth, 1);
+    UtAssert_UINT32_EQ(stats.high_water_mark, 2);
+    UtAssert_UINT32_EQ(stats.put_count, 2);
+    UtAssert_UINT32_EQ(stats.get_count, 1);
+    UtAssert_UINT32_EQ(stats.full_count, 1);
+    UtAssert_UINT32_EQ(stats.timeout_count, 2);
+
+    /* a depth which is transiently negative is reported as zero */
+    UtAssert_INT32_EQ(OS_QueueGetRef(UT_OBJID_1, (const void **)&data_ptr, &actual_size, OS_PEND), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_QueueGetWithPriority(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, &priority, OS_PEND),
+                      OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetStats(UT_OBJID_1, &stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.depth, 0);
+    UtAssert_UINT32_EQ(stats.get_count, 3);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetStats(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetStats(UT_OBJID_1, &stats), OS_ERROR);
+}
+
+void Test_OS_QueueResetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueResetStats(osal_id_t queue_id)
+     */
+    memset(&OS_queue_table[1], 0, sizeof(OS_queue_table[1]));
+    OS_queue_table[1].stats.depth                = 3;
+    OS_queue_table[1].stats.high_water_mark      = 5;
+    OS_queue_table[1].stats.put_count            = 7;
+    OS_queue_table[1].stats.latency_histogram[2] = 1;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueResetStats(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_queue_table[1].stats.depth, 3);
+    UtAssert_UINT32_EQ(OS_queue_table[1].stats.high_water_mark, 3);
+    UtAssert_ZERO(OS_queue_table[1].stats.put_count);
+    UtAssert_ZERO(OS_queue_table[1].stats.latency_histogram[2]);
+
+    /* test error cases */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueResetStats(UT_OBJID_1), OS_ERROR);
+}
+
+void Test_OS_QueueStatsLatency(void)
+{
+    /*
+     * Test Case For:
+     * void OS_QueueStatsLatency(OS_queue_internal_record_t *queue, OS_time_t put_time)
+     */
+    OS_queue_internal_record_t *queue;
+    OS_time_t                   now;
+
+    queue = &OS_queue_table[1];
+    memset(queue, 0, sizeof(*queue));
+    UT_SetHandlerFunction(UT_KEY(OS_GetMonotonicTime_Impl), UT_Handler_FixedClock, &now);
+
+    /* less than 1 usec goes in the first bucket */
+    now = OS_TimeFromTotalMicroseconds(100);
+    OS_QueueStatsLatency(queue, now);
+    UtAssert_UINT32_EQ(queue->stats.latency_histogram[0], 1);
+
+    /* 5 usec is between 2^2 and 2^3 */
+    OS_QueueStatsLatency(queue, OS_TimeFromTotalMicroseconds(95));
+    UtAssert_UINT32_EQ(queue->stats.latency_histogram[3], 1);
+    UtAssert_True(OS_TimeGetTotalMicroseconds(queue->stats.max_latency) == 5, "max_latency == 5 usec");
+
+    /* very long latencies go in the last bucket, and a shorter one does not reduce the maximum */
+    now = OS_TimeFromTotalSeconds(3600);
+    OS_QueueStatsLatency(queue, OS_TIME_ZERO);
+    UtAssert_UINT32_EQ(queue->stats.latency_histogram[OS_QUEUE_LATENCY_BUCKETS - 1], 1);
+    OS_QueueStatsLatency(queue, now);
+    UtAssert_UINT32_EQ(queue->stats.latency_histogram[0], 2);
+    UtAssert_True(OS_TimeGetTotalSeconds(queue->stats.max_latency) == 3600, "max_latency == 3600 sec");
+}
+
+void Test_OS_QueueStatsDrop(void)
+{
+    /*
+     * Test Case For:
+     * void OS_QueueStatsDrop(OS_queue_internal_record_t *queue, uint32 count)
+     */
+    OS_queue_internal_record_t *queue;
+
+    queue = &OS_queue_table[1];
+    memset(queue, 0, sizeof(*queue));
+
+    OS_QueueStatsDrop(queue, 1);
+    OS_QueueStatsDrop(queue, 2);
+    UtAssert_UINT32_EQ(queue->stats.drop_count, 3);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -201,8 +788,25 @@ void UtTest_Setup(void)
     ADD_TEST(OS_QueueAPI_Init);
     ADD_TEST(OS_QueueCreate);
     ADD_TEST(OS_QueueDelete);
+    ADD_TEST(OS_QueueCreatePacked);
+    ADD_TEST(OS_QueueSubscribe);
+    ADD_TEST(OS_QueueCreateBatch);
+    ADD_TEST(OS_QueueDeleteBatch);
     ADD_TEST(OS_QueueGet);
+    ADD_TEST(OS_QueueGetWithPriority);
     ADD_TEST(OS_QueuePut);
+    ADD_TEST(OS_QueuePutTimed);
+    ADD_TEST(OS_QueuePutAbs);
+    ADD_TEST(OS_QueueGetMultiple);
+    ADD_TEST(OS_QueuePutMultiple);
+    ADD_TEST(OS_QueueReserve);
+    ADD_TEST(OS_QueueCommit);
+    ADD_TEST(OS_QueueGetRef);
+    ADD_TEST(OS_QueueRelease);
     ADD_TEST(OS_QueueGetIdByName);
     ADD_TEST(OS_QueueGetInfo);
+    ADD_TEST(OS_QueueGetStats);
+    ADD_TEST(OS_QueueResetStats);
+    ADD_TEST(OS_QueueStatsLatency);
+    ADD_TEST(OS_QueueStatsDrop);
 }
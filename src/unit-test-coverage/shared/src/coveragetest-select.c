@@ -111,6 +111,36 @@ void Test_OS_SelectFdAddClearOps(void)
     UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_2), "OS_SelectFdIsSet(2) == false");
 }
 
+void Test_OS_SelectFdQueueOps(void)
+{
+    /*
+     * Test Cases For queue IDs in:
+     * int32 OS_SelectFdAdd(OS_FdSet *Set, uint32 objid);
+     * int32 OS_SelectFdClear(OS_FdSet *Set, uint32 objid);
+     * bool OS_SelectFdIsSet(OS_FdSet *Set, uint32 objid);
+     */
+    OS_FdSet UtSet;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectFdZero(&UtSet), OS_SUCCESS);
+
+    /* A stream ID and a queue ID with the same index are held separately */
+    OSAPI_TEST_FUNCTION_RC(OS_SelectFdAdd(&UtSet, UT_OBJID_1), OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_QUEUE);
+    UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_1), "OS_SelectFdIsSet(queue 1) == false");
+    OSAPI_TEST_FUNCTION_RC(OS_SelectFdAdd(&UtSet, UT_OBJID_1), OS_SUCCESS);
+    UtAssert_True(OS_SelectFdIsSet(&UtSet, UT_OBJID_1), "OS_SelectFdIsSet(queue 1) == true");
+    UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_2), "OS_SelectFdIsSet(queue 2) == false");
+    UtAssert_UINT32_EQ(UtSet.queue_ids[0], 0x02);
+    UtAssert_UINT32_EQ(UtSet.object_ids[0], 0x02);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectFdClear(&UtSet, UT_OBJID_1), OS_SUCCESS);
+    UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_1), "OS_SelectFdIsSet(queue 1) == false");
+    UtAssert_ZERO(UtSet.queue_ids[0]);
+
+    UT_ClearDefaultReturnValue(UT_KEY(OS_IdentifyObject));
+    UtAssert_True(OS_SelectFdIsSet(&UtSet, UT_OBJID_1), "OS_SelectFdIsSet(1) == true");
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -135,6 +165,7 @@ void Osapi_Test_Teardown(void) {}
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_SelectFdAddClearOps);
+    ADD_TEST(OS_SelectFdQueueOps);
     ADD_TEST(OS_SelectSingle);
     ADD_TEST(OS_SelectMultiple);
 }
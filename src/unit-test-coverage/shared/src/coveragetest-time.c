@@ -150,7 +150,7 @@ void Test_OS_TimerSet(void)
     OS_timecb_table[2].flags                   = TIMECB_FLAG_DEDICATED_TIMEBASE;
 
     OSAPI_TEST_FUNCTION_RC(OS_TimerSet(UT_OBJID_2, 0, 1), OS_SUCCESS);
-    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+    memset(OS_timecb_table, 0, sizeof(*OS_timecb_table) * OS_MAX_TIMERS);
 
     /* Call again without dedicated timebase */
     OSAPI_TEST_FUNCTION_RC(OS_TimerSet(UT_OBJID_2, 0, 1), OS_SUCCESS);
@@ -227,8 +227,8 @@ void Test_OS_TimerDelete(void)
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_TimerDelete(UT_OBJID_1), OS_SUCCESS);
 
-    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
-    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
+    memset(OS_timecb_table, 0, sizeof(*OS_timecb_table) * OS_MAX_TIMERS);
+    memset(OS_timebase_table, 0, sizeof(*OS_timebase_table) * OS_MAX_TIMEBASES);
 
     UT_SetDeferredRetcode(UT_KEY(OS_TaskGetId_Impl), 1, 1 | (OS_OBJECT_TYPE_OS_TIMEBASE << OS_OBJECT_TYPE_SHIFT));
     OSAPI_TEST_FUNCTION_RC(OS_TimerDelete(UT_OBJID_2), OS_ERR_INCORRECT_OBJ_STATE);
@@ -76,6 +76,23 @@ int32 OS_CountSemGetInfo_Impl(const OS_object_token_t *token, OS_count_sem_prop_
     return UT_GenStub_GetReturnValue(OS_CountSemGetInfo_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_CountSemGiveN_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_CountSemGiveN_Impl(const OS_object_token_t *token, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_CountSemGiveN_Impl, int32);
+
+    UT_GenStub_AddParam(OS_CountSemGiveN_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_CountSemGiveN_Impl, uint32, count);
+
+    UT_GenStub_Execute(OS_CountSemGiveN_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_CountSemGiveN_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_CountSemGive_Impl()
@@ -92,6 +109,23 @@ int32 OS_CountSemGive_Impl(const OS_object_token_t *token)
     return UT_GenStub_GetReturnValue(OS_CountSemGive_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_CountSemTakeN_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_CountSemTakeN_Impl(const OS_object_token_t *token, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_CountSemTakeN_Impl, int32);
+
+    UT_GenStub_AddParam(OS_CountSemTakeN_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_CountSemTakeN_Impl, uint32, count);
+
+    UT_GenStub_Execute(OS_CountSemTakeN_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_CountSemTakeN_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_CountSemTake_Impl()
@@ -108,6 +142,24 @@ int32 OS_CountSemTake_Impl(const OS_object_token_t *token)
     return UT_GenStub_GetReturnValue(OS_CountSemTake_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_CountSemTimedWaitN_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_CountSemTimedWaitN_Impl(const OS_object_token_t *token, uint32 count, uint32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_CountSemTimedWaitN_Impl, int32);
+
+    UT_GenStub_AddParam(OS_CountSemTimedWaitN_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_CountSemTimedWaitN_Impl, uint32, count);
+    UT_GenStub_AddParam(OS_CountSemTimedWaitN_Impl, uint32, msecs);
+
+    UT_GenStub_Execute(OS_CountSemTimedWaitN_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_CountSemTimedWaitN_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_CountSemTimedWait_Impl()
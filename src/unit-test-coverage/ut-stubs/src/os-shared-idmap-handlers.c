@@ -34,6 +34,9 @@
  * OSAL itself (not for coverage testing other units).
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "osapi-idmap.h" /* OSAL public API for this subsystem */
 #include "os-shared-idmap.h"
 #include "utstubs.h"
@@ -115,6 +118,44 @@ void UT_DefaultHandler_OS_GetBaseForObjectType(void *UserObj, UT_EntryKey_t Func
     UT_Stub_SetReturnValue(FuncKey, base);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_ObjectIdTableAlloc' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_ObjectIdTableAlloc(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    static void * TableBlock[OS_OBJECT_TYPE_USER];
+    static size_t TableBlockSize[OS_OBJECT_TYPE_USER];
+
+    osal_objtype_t idtype      = UT_Hook_GetArgValueByName(Context, "idtype", osal_objtype_t);
+    size_t         record_size = UT_Hook_GetArgValueByName(Context, "record_size", size_t);
+    void **        table       = UT_Hook_GetArgValueByName(Context, "table", void **);
+    int32          Status;
+    size_t         size;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    /*
+     * Tests may use any index within the compile-time limit of a type, so the
+     * table has enough records for all types.  The block for each type is kept
+     * and zeroed again, rather than reallocated, when the table is reinitialized.
+     */
+    if (Status == OS_SUCCESS && idtype < OS_OBJECT_TYPE_USER)
+    {
+        size = record_size * OS_MAX_TOTAL_RECORDS;
+        if (TableBlockSize[idtype] < size)
+        {
+            free(TableBlock[idtype]);
+            TableBlock[idtype]     = malloc(size);
+            TableBlockSize[idtype] = size;
+        }
+
+        memset(TableBlock[idtype], 0, size);
+        *table = TableBlock[idtype];
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_ObjectIdGlobalFromToken' stub
@@ -343,6 +384,126 @@ void UT_DefaultHandler_OS_ObjectIdAllocateNew(void *UserObj, UT_EntryKey_t FuncK
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_ObjectIdAllocateNewBatch' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_ObjectIdAllocateNewBatch(void *UserObj, UT_EntryKey_t FuncKey,
+                                                   const UT_StubContext_t *Context)
+{
+    osal_objtype_t     idtype = UT_Hook_GetArgValueByName(Context, "idtype", osal_objtype_t);
+    uint32             count  = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    OS_object_token_t *tokens = UT_Hook_GetArgValueByName(Context, "tokens", OS_object_token_t *);
+    int32              Status;
+    uint32             i;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if (Status == OS_SUCCESS)
+    {
+        for (i = 0; i < count; ++i)
+        {
+            UT_TokenCompose(OS_LOCK_MODE_EXCLUSIVE, i, idtype, &tokens[i]);
+        }
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_ObjectIdFinalizeNewBatch' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_ObjectIdFinalizeNewBatch(void *UserObj, UT_EntryKey_t FuncKey,
+                                                   const UT_StubContext_t *Context)
+{
+    int32              operation_status = UT_Hook_GetArgValueByName(Context, "operation_status", int32);
+    OS_object_token_t *tokens           = UT_Hook_GetArgValueByName(Context, "tokens", OS_object_token_t *);
+    uint32             count            = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    osal_id_t *        outids           = UT_Hook_GetArgValueByName(Context, "outids", osal_id_t *);
+    int32              Status;
+    uint32             i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &Status))
+    {
+        /* pass through the argument status unless overridden */
+        Status = operation_status;
+    }
+
+    /* need to actually write something to the output buffer */
+    for (i = 0; i < count; ++i)
+    {
+        if (Status == OS_SUCCESS)
+        {
+            outids[i] = tokens[i].obj_id;
+        }
+        else
+        {
+            outids[i] = OS_OBJECT_ID_UNDEFINED;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_ObjectIdGetByIdBatch' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_ObjectIdGetByIdBatch(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_objtype_t     idtype = UT_Hook_GetArgValueByName(Context, "idtype", osal_objtype_t);
+    const osal_id_t *  ids    = UT_Hook_GetArgValueByName(Context, "ids", const osal_id_t *);
+    uint32             count  = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    OS_object_token_t *tokens = UT_Hook_GetArgValueByName(Context, "tokens", OS_object_token_t *);
+    int32              Status;
+    uint32             i;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    /* if a status code is set, then the first token is not locked, but the rest are */
+    for (i = 0; i < count; ++i)
+    {
+        UT_TokenCompose(OS_LOCK_MODE_EXCLUSIVE, OS_ObjectIdToInteger(ids[i]) & 0xFFFF, idtype, &tokens[i]);
+    }
+
+    if (Status != OS_SUCCESS && count > 0)
+    {
+        tokens[0].lock_mode = OS_LOCK_MODE_NONE;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_ObjectIdFinalizeDeleteBatch' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_ObjectIdFinalizeDeleteBatch(void *UserObj, UT_EntryKey_t FuncKey,
+                                                      const UT_StubContext_t *Context)
+{
+    const int32 *      operation_status = UT_Hook_GetArgValueByName(Context, "operation_status", const int32 *);
+    OS_object_token_t *tokens           = UT_Hook_GetArgValueByName(Context, "tokens", OS_object_token_t *);
+    uint32             count            = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    int32              Status;
+    uint32             i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &Status))
+    {
+        /* pass through the first failed status of a locked token unless overridden */
+        Status = OS_SUCCESS;
+        for (i = 0; i < count && Status == OS_SUCCESS; ++i)
+        {
+            if (tokens[i].lock_mode != OS_LOCK_MODE_NONE)
+            {
+                Status = operation_status[i];
+            }
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_ObjectIdIteratorInit' stub
@@ -37,6 +37,18 @@ void OS_Lock_Global_Impl(osal_objtype_t idtype)
     UT_GenStub_Execute(OS_Lock_Global_Impl, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SignalHandoff_Impl()
+ * ----------------------------------------------------
+ */
+void OS_SignalHandoff_Impl(osal_objtype_t objtype)
+{
+    UT_GenStub_AddParam(OS_SignalHandoff_Impl, osal_objtype_t, objtype);
+
+    UT_GenStub_Execute(OS_SignalHandoff_Impl, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_Unlock_Global_Impl()
@@ -49,15 +61,28 @@ void OS_Unlock_Global_Impl(osal_objtype_t idtype)
     UT_GenStub_Execute(OS_Unlock_Global_Impl, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_WaitForHandoff_Impl()
+ * ----------------------------------------------------
+ */
+void OS_WaitForHandoff_Impl(osal_objtype_t objtype, int32 timeout)
+{
+    UT_GenStub_AddParam(OS_WaitForHandoff_Impl, osal_objtype_t, objtype);
+    UT_GenStub_AddParam(OS_WaitForHandoff_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_WaitForHandoff_Impl, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_WaitForStateChange_Impl()
  * ----------------------------------------------------
  */
-void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+void OS_WaitForStateChange_Impl(osal_objtype_t objtype, int32 timeout)
 {
     UT_GenStub_AddParam(OS_WaitForStateChange_Impl, osal_objtype_t, objtype);
-    UT_GenStub_AddParam(OS_WaitForStateChange_Impl, uint32, attempts);
+    UT_GenStub_AddParam(OS_WaitForStateChange_Impl, int32, timeout);
 
     UT_GenStub_Execute(OS_WaitForStateChange_Impl, Basic, NULL);
 }
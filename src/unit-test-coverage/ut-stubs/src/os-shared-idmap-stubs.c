@@ -28,16 +28,21 @@
 void UT_DefaultHandler_OS_GetBaseForObjectType(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GetMaxForObjectType(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdAllocateNew(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_ObjectIdAllocateNewBatch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdFinalizeDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_ObjectIdFinalizeDeleteBatch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdFinalizeNew(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_ObjectIdFinalizeNewBatch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdFindByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdGetById(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_ObjectIdGetByIdBatch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdGetByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdGetBySearch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdGlobalFromToken(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdIterateActive(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdIteratorGetNext(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdIteratorInit(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_ObjectIdTableAlloc(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdTransactionInit(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdTransferToken(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
@@ -57,6 +62,38 @@ uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
     return UT_GenStub_GetReturnValue(OS_GetBaseForObjectType, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetDefaultMaxForObjectType()
+ * ----------------------------------------------------
+ */
+uint32 OS_GetDefaultMaxForObjectType(osal_objtype_t idtype)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetDefaultMaxForObjectType, uint32);
+
+    UT_GenStub_AddParam(OS_GetDefaultMaxForObjectType, osal_objtype_t, idtype);
+
+    UT_GenStub_Execute(OS_GetDefaultMaxForObjectType, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GetDefaultMaxForObjectType, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetHighestMaxForObjectType()
+ * ----------------------------------------------------
+ */
+uint32 OS_GetHighestMaxForObjectType(osal_objtype_t idtype)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetHighestMaxForObjectType, uint32);
+
+    UT_GenStub_AddParam(OS_GetHighestMaxForObjectType, osal_objtype_t, idtype);
+
+    UT_GenStub_Execute(OS_GetHighestMaxForObjectType, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_GetHighestMaxForObjectType, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GetMaxForObjectType()
@@ -121,6 +158,26 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
     return UT_GenStub_GetReturnValue(OS_ObjectIdAllocateNew, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdAllocateNewBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdAllocateNewBatch(osal_objtype_t idtype, const char *const *names, uint32 count,
+                                  OS_object_token_t *tokens)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdAllocateNewBatch, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdAllocateNewBatch, osal_objtype_t, idtype);
+    UT_GenStub_AddParam(OS_ObjectIdAllocateNewBatch, const char *const *, names);
+    UT_GenStub_AddParam(OS_ObjectIdAllocateNewBatch, uint32, count);
+    UT_GenStub_AddParam(OS_ObjectIdAllocateNewBatch, OS_object_token_t *, tokens);
+
+    UT_GenStub_Execute(OS_ObjectIdAllocateNewBatch, Basic, UT_DefaultHandler_OS_ObjectIdAllocateNewBatch);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdAllocateNewBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdConvertToken()
@@ -137,6 +194,23 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
     return UT_GenStub_GetReturnValue(OS_ObjectIdConvertToken, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdConvertTokenTimed()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdConvertTokenTimed(OS_object_token_t *token, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdConvertTokenTimed, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdConvertTokenTimed, OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_ObjectIdConvertTokenTimed, int32, timeout);
+
+    UT_GenStub_Execute(OS_ObjectIdConvertTokenTimed, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdConvertTokenTimed, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdFinalizeDelete()
@@ -154,6 +228,24 @@ int32 OS_ObjectIdFinalizeDelete(int32 operation_status, OS_object_token_t *token
     return UT_GenStub_GetReturnValue(OS_ObjectIdFinalizeDelete, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdFinalizeDeleteBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdFinalizeDeleteBatch(const int32 *operation_status, OS_object_token_t *tokens, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdFinalizeDeleteBatch, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdFinalizeDeleteBatch, const int32 *, operation_status);
+    UT_GenStub_AddParam(OS_ObjectIdFinalizeDeleteBatch, OS_object_token_t *, tokens);
+    UT_GenStub_AddParam(OS_ObjectIdFinalizeDeleteBatch, uint32, count);
+
+    UT_GenStub_Execute(OS_ObjectIdFinalizeDeleteBatch, Basic, UT_DefaultHandler_OS_ObjectIdFinalizeDeleteBatch);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdFinalizeDeleteBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdFinalizeNew()
@@ -172,6 +264,25 @@ int32 OS_ObjectIdFinalizeNew(int32 operation_status, OS_object_token_t *token, o
     return UT_GenStub_GetReturnValue(OS_ObjectIdFinalizeNew, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdFinalizeNewBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdFinalizeNewBatch(int32 operation_status, OS_object_token_t *tokens, uint32 count, osal_id_t *outids)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdFinalizeNewBatch, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdFinalizeNewBatch, int32, operation_status);
+    UT_GenStub_AddParam(OS_ObjectIdFinalizeNewBatch, OS_object_token_t *, tokens);
+    UT_GenStub_AddParam(OS_ObjectIdFinalizeNewBatch, uint32, count);
+    UT_GenStub_AddParam(OS_ObjectIdFinalizeNewBatch, osal_id_t *, outids);
+
+    UT_GenStub_Execute(OS_ObjectIdFinalizeNewBatch, Basic, UT_DefaultHandler_OS_ObjectIdFinalizeNewBatch);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdFinalizeNewBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdFindByName()
@@ -190,6 +301,23 @@ int32 OS_ObjectIdFindByName(osal_objtype_t idtype, const char *name, osal_id_t *
     return UT_GenStub_GetReturnValue(OS_ObjectIdFindByName, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdFindNameMatch()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdFindNameMatch(const char *name, OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdFindNameMatch, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdFindNameMatch, const char *, name);
+    UT_GenStub_AddParam(OS_ObjectIdFindNameMatch, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdFindNameMatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdFindNameMatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdFindNextFree()
@@ -224,6 +352,18 @@ int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_obj
     return UT_GenStub_GetReturnValue(OS_ObjectIdFindNextMatch, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdFreeQueueAppend()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdFreeQueueAppend(const OS_object_token_t *token)
+{
+    UT_GenStub_AddParam(OS_ObjectIdFreeQueueAppend, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdFreeQueueAppend, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdGetById()
@@ -243,6 +383,25 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
     return UT_GenStub_GetReturnValue(OS_ObjectIdGetById, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdGetByIdBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdGetByIdBatch(osal_objtype_t idtype, const osal_id_t *ids, uint32 count, OS_object_token_t *tokens)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdGetByIdBatch, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdGetByIdBatch, osal_objtype_t, idtype);
+    UT_GenStub_AddParam(OS_ObjectIdGetByIdBatch, const osal_id_t *, ids);
+    UT_GenStub_AddParam(OS_ObjectIdGetByIdBatch, uint32, count);
+    UT_GenStub_AddParam(OS_ObjectIdGetByIdBatch, OS_object_token_t *, tokens);
+
+    UT_GenStub_Execute(OS_ObjectIdGetByIdBatch, Basic, UT_DefaultHandler_OS_ObjectIdGetByIdBatch);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdGetByIdBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdGetByName()
@@ -395,6 +554,65 @@ int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, OS_ObjectIdIterato
     return UT_GenStub_GetReturnValue(OS_ObjectIdIteratorProcessEntry, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexInsert()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name)
+{
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexInsert, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexInsert, const char *, name);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexInsert, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexRemove()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdNameIndexRemove(const OS_object_token_t *token)
+{
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexRemove, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexRemove, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdRefcountRelease()
+ * ----------------------------------------------------
+ */
+bool OS_ObjectIdRefcountRelease(OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdRefcountRelease, bool);
+
+    UT_GenStub_AddParam(OS_ObjectIdRefcountRelease, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdRefcountRelease, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdRefcountRelease, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdRefcountTryAcquire()
+ * ----------------------------------------------------
+ */
+bool OS_ObjectIdRefcountTryAcquire(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdRefcountTryAcquire, bool);
+
+    UT_GenStub_AddParam(OS_ObjectIdRefcountTryAcquire, osal_objtype_t, idtype);
+    UT_GenStub_AddParam(OS_ObjectIdRefcountTryAcquire, osal_id_t, id);
+    UT_GenStub_AddParam(OS_ObjectIdRefcountTryAcquire, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdRefcountTryAcquire, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdRefcountTryAcquire, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdRelease()
@@ -407,6 +625,56 @@ void OS_ObjectIdRelease(OS_object_token_t *token)
     UT_GenStub_Execute(OS_ObjectIdRelease, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdSnapshotInit()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdSnapshotInit(OS_ObjectMatchFunc_t matchfunc, void *matcharg, osal_objtype_t objtype,
+                             OS_object_snapshot_t *snap)
+{
+    UT_GenStub_AddParam(OS_ObjectIdSnapshotInit, OS_ObjectMatchFunc_t, matchfunc);
+    UT_GenStub_AddParam(OS_ObjectIdSnapshotInit, void *, matcharg);
+    UT_GenStub_AddParam(OS_ObjectIdSnapshotInit, osal_objtype_t, objtype);
+    UT_GenStub_AddParam(OS_ObjectIdSnapshotInit, OS_object_snapshot_t *, snap);
+
+    UT_GenStub_Execute(OS_ObjectIdSnapshotInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdSnapshotNext()
+ * ----------------------------------------------------
+ */
+bool OS_ObjectIdSnapshotNext(OS_object_snapshot_t *snap)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdSnapshotNext, bool);
+
+    UT_GenStub_AddParam(OS_ObjectIdSnapshotNext, OS_object_snapshot_t *, snap);
+
+    UT_GenStub_Execute(OS_ObjectIdSnapshotNext, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdSnapshotNext, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdTableAlloc()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdTableAlloc(osal_objtype_t idtype, size_t record_size, void **table)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdTableAlloc, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdTableAlloc, osal_objtype_t, idtype);
+    UT_GenStub_AddParam(OS_ObjectIdTableAlloc, size_t, record_size);
+    UT_GenStub_AddParam(OS_ObjectIdTableAlloc, void **, table);
+
+    UT_GenStub_Execute(OS_ObjectIdTableAlloc, Basic, UT_DefaultHandler_OS_ObjectIdTableAlloc);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdTableAlloc, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdTransactionCancel()
@@ -463,6 +731,22 @@ void OS_ObjectIdTransferToken(OS_object_token_t *token_from, OS_object_token_t *
     UT_GenStub_Execute(OS_ObjectIdTransferToken, Basic, UT_DefaultHandler_OS_ObjectIdTransferToken);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectNameHash()
+ * ----------------------------------------------------
+ */
+uint32 OS_ObjectNameHash(const char *name)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectNameHash, uint32);
+
+    UT_GenStub_AddParam(OS_ObjectNameHash, const char *, name);
+
+    UT_GenStub_Execute(OS_ObjectNameHash, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectNameHash, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectNameMatch()
@@ -493,15 +777,28 @@ void OS_Unlock_Global(OS_object_token_t *token)
     UT_GenStub_Execute(OS_Unlock_Global, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_WaitForHandoff()
+ * ----------------------------------------------------
+ */
+void OS_WaitForHandoff(OS_object_token_t *token, int32 timeout)
+{
+    UT_GenStub_AddParam(OS_WaitForHandoff, OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_WaitForHandoff, int32, timeout);
+
+    UT_GenStub_Execute(OS_WaitForHandoff, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_WaitForStateChange()
  * ----------------------------------------------------
  */
-void OS_WaitForStateChange(OS_object_token_t *token, uint32 attempts)
+void OS_WaitForStateChange(OS_object_token_t *token, int32 timeout)
 {
     UT_GenStub_AddParam(OS_WaitForStateChange, OS_object_token_t *, token);
-    UT_GenStub_AddParam(OS_WaitForStateChange, uint32, attempts);
+    UT_GenStub_AddParam(OS_WaitForStateChange, int32, timeout);
 
     UT_GenStub_Execute(OS_WaitForStateChange, Basic, NULL);
 }
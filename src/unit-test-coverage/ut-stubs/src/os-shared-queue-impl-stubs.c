@@ -25,6 +25,25 @@
 #include "os-shared-queue.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCommit_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCommit_Impl(const OS_object_token_t *token, void *data_ptr, size_t size, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCommit_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, void *, data_ptr);
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, size_t, size);
+    UT_GenStub_AddParam(OS_QueueCommit_Impl, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueueCommit_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCommit_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueCreate_Impl()
@@ -42,6 +61,23 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
     return UT_GenStub_GetReturnValue(OS_QueueCreate_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueDeletePending_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueDeletePending_Impl(const OS_object_token_t *token, bool pending)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueDeletePending_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueDeletePending_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueDeletePending_Impl, bool, pending);
+
+    UT_GenStub_Execute(OS_QueueDeletePending_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueDeletePending_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueDelete_Impl()
@@ -75,6 +111,70 @@ int32 OS_QueueGetInfo_Impl(const OS_object_token_t *token, OS_queue_prop_t *queu
     return UT_GenStub_GetReturnValue(OS_QueueGetInfo_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetMultiple_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetMultiple_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *sizes, uint32 max_count,
+                               uint32 *count_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetMultiple_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetMultiple_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueGetMultiple_Impl, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetMultiple_Impl, size_t, size);
+    UT_GenStub_AddParam(OS_QueueGetMultiple_Impl, size_t *, sizes);
+    UT_GenStub_AddParam(OS_QueueGetMultiple_Impl, uint32, max_count);
+    UT_GenStub_AddParam(OS_QueueGetMultiple_Impl, uint32 *, count_copied);
+    UT_GenStub_AddParam(OS_QueueGetMultiple_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetMultiple_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetMultiple_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetRef_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetRef_Impl(const OS_object_token_t *token, const void **data_ptr, size_t *size_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetRef_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetRef_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueGetRef_Impl, const void **, data_ptr);
+    UT_GenStub_AddParam(OS_QueueGetRef_Impl, size_t *, size_copied);
+    UT_GenStub_AddParam(OS_QueueGetRef_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetRef_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetRef_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetWithPriority_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetWithPriority_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied,
+                                   uint32 *priority, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetWithPriority_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetWithPriority_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority_Impl, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority_Impl, size_t, size);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority_Impl, size_t *, size_copied);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority_Impl, uint32 *, priority);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetWithPriority_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetWithPriority_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueGet_Impl()
@@ -95,6 +195,49 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
     return UT_GenStub_GetReturnValue(OS_QueueGet_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutMultiple_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutMultiple_Impl(const OS_object_token_t *token, const void *data, size_t size, const size_t *sizes,
+                               uint32 count, uint32 flags, uint32 *count_put)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutMultiple_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutMultiple_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueuePutMultiple_Impl, const void *, data);
+    UT_GenStub_AddParam(OS_QueuePutMultiple_Impl, size_t, size);
+    UT_GenStub_AddParam(OS_QueuePutMultiple_Impl, const size_t *, sizes);
+    UT_GenStub_AddParam(OS_QueuePutMultiple_Impl, uint32, count);
+    UT_GenStub_AddParam(OS_QueuePutMultiple_Impl, uint32, flags);
+    UT_GenStub_AddParam(OS_QueuePutMultiple_Impl, uint32 *, count_put);
+
+    UT_GenStub_Execute(OS_QueuePutMultiple_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutMultiple_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutTimed_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutTimed_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutTimed_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutTimed_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueuePutTimed_Impl, const void *, data);
+    UT_GenStub_AddParam(OS_QueuePutTimed_Impl, size_t, size);
+    UT_GenStub_AddParam(OS_QueuePutTimed_Impl, uint32, flags);
+    UT_GenStub_AddParam(OS_QueuePutTimed_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueuePutTimed_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutTimed_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueuePut_Impl()
@@ -113,3 +256,87 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
     return UT_GenStub_GetReturnValue(OS_QueuePut_Impl, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueRelease_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueRelease_Impl(const OS_object_token_t *token, const void *data_ptr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueRelease_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueRelease_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueRelease_Impl, const void *, data_ptr);
+
+    UT_GenStub_Execute(OS_QueueRelease_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueRelease_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueReserve_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueReserve_Impl(const OS_object_token_t *token, void **data_ptr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueReserve_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueReserve_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueReserve_Impl, void **, data_ptr);
+
+    UT_GenStub_Execute(OS_QueueReserve_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueReserve_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueSelectBegin_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueSelectBegin_Impl(const OS_object_token_t *token, uint32 *SelectFlags, int *os_fd, uint32 *fd_flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueSelectBegin_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueSelectBegin_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueSelectBegin_Impl, uint32 *, SelectFlags);
+    UT_GenStub_AddParam(OS_QueueSelectBegin_Impl, int *, os_fd);
+    UT_GenStub_AddParam(OS_QueueSelectBegin_Impl, uint32 *, fd_flags);
+
+    UT_GenStub_Execute(OS_QueueSelectBegin_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueSelectBegin_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueSelectEnd_Impl()
+ * ----------------------------------------------------
+ */
+void OS_QueueSelectEnd_Impl(const OS_object_token_t *token, uint32 *SelectFlags)
+{
+    UT_GenStub_AddParam(OS_QueueSelectEnd_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueSelectEnd_Impl, uint32 *, SelectFlags);
+
+    UT_GenStub_Execute(OS_QueueSelectEnd_Impl, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueSubscribe_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueSubscribe_Impl(const OS_object_token_t *token, const OS_object_token_t *source_token, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueSubscribe_Impl, int32);
+
+    UT_GenStub_AddParam(OS_QueueSubscribe_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_QueueSubscribe_Impl, const OS_object_token_t *, source_token);
+    UT_GenStub_AddParam(OS_QueueSubscribe_Impl, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueueSubscribe_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueSubscribe_Impl, int32);
+}
@@ -38,3 +38,29 @@ int32 OS_QueueAPI_Init(void)
 
     return UT_GenStub_GetReturnValue(OS_QueueAPI_Init, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueStatsLatency()
+ * ----------------------------------------------------
+ */
+void OS_QueueStatsLatency(OS_queue_internal_record_t *queue, OS_time_t put_time)
+{
+    UT_GenStub_AddParam(OS_QueueStatsLatency, OS_queue_internal_record_t *, queue);
+    UT_GenStub_AddParam(OS_QueueStatsLatency, OS_time_t, put_time);
+
+    UT_GenStub_Execute(OS_QueueStatsLatency, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueStatsDrop()
+ * ----------------------------------------------------
+ */
+void OS_QueueStatsDrop(OS_queue_internal_record_t *queue, uint32 count)
+{
+    UT_GenStub_AddParam(OS_QueueStatsDrop, OS_queue_internal_record_t *, queue);
+    UT_GenStub_AddParam(OS_QueueStatsDrop, uint32, count);
+
+    UT_GenStub_Execute(OS_QueueStatsDrop, Basic, NULL);
+}
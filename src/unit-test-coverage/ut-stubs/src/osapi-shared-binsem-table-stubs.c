@@ -28,4 +28,5 @@
 
 #include "os-shared-binsem.h"
 
-OS_bin_sem_internal_record_t OS_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+OS_bin_sem_internal_record_t  OS_stub_bin_sem_records[OS_MAX_BIN_SEMAPHORES];
+OS_bin_sem_internal_record_t *OS_bin_sem_table = OS_stub_bin_sem_records;
@@ -28,4 +28,5 @@
 
 #include "os-shared-printf.h"
 
-OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
+OS_console_internal_record_t  OS_stub_console_records[OS_MAX_CONSOLES];
+OS_console_internal_record_t *OS_console_table = OS_stub_console_records;
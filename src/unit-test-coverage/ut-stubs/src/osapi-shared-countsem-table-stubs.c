@@ -28,4 +28,5 @@
 
 #include "os-shared-countsem.h"
 
-OS_count_sem_internal_record_t OS_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
+OS_count_sem_internal_record_t  OS_stub_count_sem_records[OS_MAX_COUNT_SEMAPHORES];
+OS_count_sem_internal_record_t *OS_count_sem_table = OS_stub_count_sem_records;
@@ -28,4 +28,5 @@
 
 #include "os-shared-dir.h"
 
-OS_dir_internal_record_t OS_dir_table[OS_MAX_NUM_OPEN_DIRS];
+OS_dir_internal_record_t  OS_stub_dir_records[OS_MAX_NUM_OPEN_DIRS];
+OS_dir_internal_record_t *OS_dir_table = OS_stub_dir_records;
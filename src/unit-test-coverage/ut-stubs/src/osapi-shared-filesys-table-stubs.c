@@ -28,4 +28,5 @@
 
 #include "os-shared-filesys.h"
 
-OS_filesys_internal_record_t OS_filesys_table[OS_MAX_FILE_SYSTEMS];
+OS_filesys_internal_record_t  OS_stub_filesys_records[OS_MAX_FILE_SYSTEMS];
+OS_filesys_internal_record_t *OS_filesys_table = OS_stub_filesys_records;
@@ -43,17 +43,17 @@ OS_common_record_t OS_stub_dir_table[OS_MAX_NUM_OPEN_DIRS];
 OS_common_record_t OS_stub_condvar_table[OS_MAX_CONDVARS];
 OS_common_record_t OS_stub_rwlock_table[OS_MAX_RWLOCKS];
 
-OS_common_record_t *const OS_global_task_table      = OS_stub_task_table;
-OS_common_record_t *const OS_global_queue_table     = OS_stub_queue_table;
-OS_common_record_t *const OS_global_bin_sem_table   = OS_stub_bin_sem_table;
-OS_common_record_t *const OS_global_count_sem_table = OS_stub_count_sem_table;
-OS_common_record_t *const OS_global_mutex_table     = OS_stub_mutex_table;
-OS_common_record_t *const OS_global_stream_table    = OS_stub_stream_table;
-OS_common_record_t *const OS_global_dir_table       = OS_stub_dir_table;
-OS_common_record_t *const OS_global_timebase_table  = OS_stub_timebase_table;
-OS_common_record_t *const OS_global_timecb_table    = OS_stub_timecb_table;
-OS_common_record_t *const OS_global_module_table    = OS_stub_module_table;
-OS_common_record_t *const OS_global_filesys_table   = OS_stub_filesys_table;
-OS_common_record_t *const OS_global_console_table   = OS_stub_console_table;
-OS_common_record_t *const OS_global_condvar_table   = OS_stub_condvar_table;
-OS_common_record_t *const OS_global_rwlock_table    = OS_stub_rwlock_table;
+OS_common_record_t *OS_global_task_table      = OS_stub_task_table;
+OS_common_record_t *OS_global_queue_table     = OS_stub_queue_table;
+OS_common_record_t *OS_global_bin_sem_table   = OS_stub_bin_sem_table;
+OS_common_record_t *OS_global_count_sem_table = OS_stub_count_sem_table;
+OS_common_record_t *OS_global_mutex_table     = OS_stub_mutex_table;
+OS_common_record_t *OS_global_stream_table    = OS_stub_stream_table;
+OS_common_record_t *OS_global_dir_table       = OS_stub_dir_table;
+OS_common_record_t *OS_global_timebase_table  = OS_stub_timebase_table;
+OS_common_record_t *OS_global_timecb_table    = OS_stub_timecb_table;
+OS_common_record_t *OS_global_module_table    = OS_stub_module_table;
+OS_common_record_t *OS_global_filesys_table   = OS_stub_filesys_table;
+OS_common_record_t *OS_global_console_table   = OS_stub_console_table;
+OS_common_record_t *OS_global_condvar_table   = OS_stub_condvar_table;
+OS_common_record_t *OS_global_rwlock_table    = OS_stub_rwlock_table;
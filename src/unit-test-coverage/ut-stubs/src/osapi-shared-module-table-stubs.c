@@ -29,4 +29,5 @@
 
 #include "os-shared-module.h"
 
-OS_module_internal_record_t OS_module_table[OS_MAX_MODULES];
+OS_module_internal_record_t  OS_stub_module_records[OS_MAX_MODULES];
+OS_module_internal_record_t *OS_module_table = OS_stub_module_records;
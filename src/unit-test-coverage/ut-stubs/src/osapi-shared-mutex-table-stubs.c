@@ -29,4 +29,5 @@
 
 #include "os-shared-mutex.h"
 
-OS_mutex_internal_record_t OS_mutex_table[OS_MAX_MUTEXES];
+OS_mutex_internal_record_t  OS_stub_mutex_records[OS_MAX_MUTEXES];
+OS_mutex_internal_record_t *OS_mutex_table = OS_stub_mutex_records;
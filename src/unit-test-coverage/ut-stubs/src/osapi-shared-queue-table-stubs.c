@@ -29,4 +29,5 @@
 
 #include "os-shared-queue.h"
 
-OS_queue_internal_record_t OS_queue_table[OS_MAX_QUEUES];
+OS_queue_internal_record_t  OS_stub_queue_records[OS_MAX_QUEUES];
+OS_queue_internal_record_t *OS_queue_table = OS_stub_queue_records;
@@ -29,4 +29,5 @@
 
 #include "os-shared-rwlock.h"
 
-OS_rwlock_internal_record_t OS_rwlock_table[OS_MAX_RWLOCKS];
+OS_rwlock_internal_record_t  OS_stub_rwlock_records[OS_MAX_RWLOCKS];
+OS_rwlock_internal_record_t *OS_rwlock_table = OS_stub_rwlock_records;
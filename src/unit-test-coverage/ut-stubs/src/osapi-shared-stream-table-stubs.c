@@ -29,4 +29,5 @@
 
 #include "os-shared-file.h"
 
-OS_stream_internal_record_t OS_stream_table[OS_MAX_NUM_OPEN_FILES];
+OS_stream_internal_record_t  OS_stub_stream_records[OS_MAX_NUM_OPEN_FILES];
+OS_stream_internal_record_t *OS_stream_table = OS_stub_stream_records;
@@ -29,4 +29,5 @@
 
 #include "os-shared-task.h"
 
-OS_task_internal_record_t OS_task_table[OS_MAX_TASKS];
+OS_task_internal_record_t  OS_stub_task_records[OS_MAX_TASKS];
+OS_task_internal_record_t *OS_task_table = OS_stub_task_records;
@@ -29,4 +29,5 @@
 
 #include "os-shared-timebase.h"
 
-OS_timebase_internal_record_t OS_timebase_table[OS_MAX_TIMEBASES];
+OS_timebase_internal_record_t  OS_stub_timebase_records[OS_MAX_TIMEBASES];
+OS_timebase_internal_record_t *OS_timebase_table = OS_stub_timebase_records;
@@ -29,4 +29,5 @@
 
 #include "os-shared-time.h"
 
-OS_timecb_internal_record_t OS_timecb_table[OS_MAX_TIMERS];
+OS_timecb_internal_record_t  OS_stub_timecb_records[OS_MAX_TIMERS];
+OS_timecb_internal_record_t *OS_timecb_table = OS_stub_timecb_records;
@@ -29,8 +29,10 @@
 #include "common_types.h"
 #include "ut-adaptor-common.h"
 
-extern void *const  UT_Ref_OS_impl_console_table;
-extern size_t const UT_Ref_OS_impl_console_table_SIZE;
+/* Points the implementation table at zeroed adaptor-owned storage */
+void UT_Reset_OS_impl_console_table(void);
+
+int32 UT_Call_OS_VxWorks_ConsoleAPI_Impl_Init(void);
 
 /**
  * Invokes the console helper task entry point
@@ -29,8 +29,10 @@
 #include "common_types.h"
 #include "OCS_xbdBlkDev.h"
 
-extern void *const  UT_Ref_OS_impl_filesys_table;
-extern size_t const UT_Ref_OS_impl_filesys_table_SIZE;
+/* Points the implementation table at zeroed adaptor-owned storage */
+void UT_Reset_OS_impl_filesys_table(void);
+
+int32 UT_Call_OS_VxWorks_FileSysAPI_Impl_Init(void);
 
 void UT_FileSysTest_SetupFileSysEntry(osal_index_t id, OCS_BLK_DEV *blkdev, OCS_device_t xbddev, uint32 MaxParts);
 
@@ -31,8 +31,8 @@
 #include "OCS_taskLib.h"
 #include "OCS_semLib.h"
 
-extern void *const  UT_Ref_OS_impl_module_table;
-extern size_t const UT_Ref_OS_impl_module_table_SIZE;
+/* Points the implementation table at zeroed adaptor-owned storage */
+void UT_Reset_OS_impl_module_table(void);
 
 extern int32 UT_Call_OS_VxWorks_ModuleAPI_Impl_Init(void);
 
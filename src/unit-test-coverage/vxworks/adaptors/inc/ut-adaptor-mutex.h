@@ -30,8 +30,8 @@
 #include "OCS_taskLib.h"
 #include "OCS_semLib.h"
 
-extern void *const  UT_Ref_OS_impl_mutex_table;
-extern size_t const UT_Ref_OS_impl_mutex_table_SIZE;
+/* Points the implementation table at zeroed adaptor-owned storage */
+void UT_Reset_OS_impl_mutex_table(void);
 
 /*****************************************************
  *
@@ -29,8 +29,8 @@
 #include "common_types.h"
 #include "OCS_msgQLib.h"
 
-extern void *const  UT_Ref_OS_impl_queue_table;
-extern size_t const UT_Ref_OS_impl_queue_table_SIZE;
+/* Points the implementation table at zeroed adaptor-owned storage */
+void UT_Reset_OS_impl_queue_table(void);
 
 /*****************************************************
  *
@@ -29,8 +29,8 @@
 #include "common_types.h"
 #include "OCS_taskLib.h"
 
-extern void *const  UT_Ref_OS_impl_task_table;
-extern size_t const UT_Ref_OS_impl_task_table_SIZE;
+/* Points the implementation table at zeroed adaptor-owned storage */
+void UT_Reset_OS_impl_task_table(void);
 
 /*****************************************************
  *
@@ -30,8 +30,8 @@
 #include "OCS_symLib.h"
 #include "OCS_time.h"
 
-extern void *const  UT_Ref_OS_impl_timebase_table;
-extern size_t const UT_Ref_OS_impl_timebase_table_SIZE;
+/* Points the implementation table at zeroed adaptor-owned storage */
+void UT_Reset_OS_impl_timebase_table(void);
 
 int32 UT_Call_OS_VxWorks_TimeBaseAPI_Impl_Init(void);
 
@@ -23,6 +23,8 @@
  *
  */
 
+#include <string.h>
+
 /* pull in the OSAL configuration */
 #include "osconfig.h"
 #include "ut-adaptor-binsem.h"
@@ -30,8 +32,13 @@
 #include "os-vxworks.h"
 #include "os-impl-binsem.h"
 
-void *const  UT_Ref_OS_impl_bin_sem_table      = OS_impl_bin_sem_table;
-size_t const UT_Ref_OS_impl_bin_sem_table_SIZE = sizeof(OS_impl_bin_sem_table);
+static OS_impl_binsem_internal_record_t UT_OS_impl_bin_sem_table_records[OS_MAX_BIN_SEMAPHORES];
+
+void UT_Reset_OS_impl_bin_sem_table(void)
+{
+    memset(UT_OS_impl_bin_sem_table_records, 0, sizeof(UT_OS_impl_bin_sem_table_records));
+    OS_impl_bin_sem_table = UT_OS_impl_bin_sem_table_records;
+}
 
 const UT_EntryKey_t UT_StubKey_GenericSemTake = UT_KEY(OS_VxWorks_GenericSemTake);
 const UT_EntryKey_t UT_StubKey_GenericSemGive = UT_KEY(OS_VxWorks_GenericSemGive);
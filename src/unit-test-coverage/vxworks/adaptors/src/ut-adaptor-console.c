@@ -23,6 +23,8 @@
  *
  */
 
+#include <string.h>
+
 /* pull in the OSAL configuration */
 #include "osconfig.h"
 #include "ut-adaptor-console.h"
@@ -30,8 +32,18 @@
 #include "os-vxworks.h"
 #include "os-impl-console.h"
 
-void *const  UT_Ref_OS_impl_console_table      = OS_impl_console_table;
-size_t const UT_Ref_OS_impl_console_table_SIZE = sizeof(OS_impl_console_table);
+static OS_impl_console_internal_record_t UT_OS_impl_console_table_records[OS_MAX_CONSOLES];
+
+void UT_Reset_OS_impl_console_table(void)
+{
+    memset(UT_OS_impl_console_table_records, 0, sizeof(UT_OS_impl_console_table_records));
+    OS_impl_console_table = UT_OS_impl_console_table_records;
+}
+
+int32 UT_Call_OS_VxWorks_ConsoleAPI_Impl_Init(void)
+{
+    return OS_VxWorks_ConsoleAPI_Impl_Init();
+}
 
 int UT_ConsoleTest_TaskEntry(int arg)
 {
@@ -22,6 +22,8 @@
  * \author   joseph.p.hickey@nasa.gov
  *
  */
+#include <string.h>
+
 /* pull in the OSAL configuration */
 #include "osconfig.h"
 #include "ut-adaptor-countsem.h"
@@ -29,8 +31,13 @@
 #include "os-vxworks.h"
 #include "os-impl-countsem.h"
 
-void *const  UT_Ref_OS_impl_count_sem_table      = OS_impl_count_sem_table;
-size_t const UT_Ref_OS_impl_count_sem_table_SIZE = sizeof(OS_impl_count_sem_table);
+static OS_impl_countsem_internal_record_t UT_OS_impl_count_sem_table_records[OS_MAX_COUNT_SEMAPHORES];
+
+void UT_Reset_OS_impl_count_sem_table(void)
+{
+    memset(UT_OS_impl_count_sem_table_records, 0, sizeof(UT_OS_impl_count_sem_table_records));
+    OS_impl_count_sem_table = UT_OS_impl_count_sem_table_records;
+}
 
 int32 UT_Call_OS_VxWorks_CountSemAPI_Impl_Init(void)
 {
@@ -30,4 +30,6 @@
 #include "os-impl-dirs.h"
 #include "os-shared-dir.h"
 
-OS_impl_dir_internal_record_t OS_impl_dir_table[OS_MAX_NUM_OPEN_DIRS];
+static OS_impl_dir_internal_record_t UT_DirTableTest_OS_impl_dir_records[OS_MAX_NUM_OPEN_DIRS];
+
+OS_impl_dir_internal_record_t *OS_impl_dir_table = UT_DirTableTest_OS_impl_dir_records;
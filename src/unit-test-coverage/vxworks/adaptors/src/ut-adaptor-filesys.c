@@ -22,6 +22,8 @@
  * \author   joseph.p.hickey@nasa.gov
  *
  */
+#include <string.h>
+
 /* pull in the OSAL configuration */
 #include "osconfig.h"
 #include "ut-adaptor-filesys.h"
@@ -29,8 +31,18 @@
 #include "os-vxworks.h"
 #include "os-impl-filesys.h"
 
-void *const  UT_Ref_OS_impl_filesys_table      = OS_impl_filesys_table;
-size_t const UT_Ref_OS_impl_filesys_table_SIZE = sizeof(OS_impl_filesys_table);
+static OS_impl_filesys_internal_record_t UT_OS_impl_filesys_table_records[OS_MAX_FILE_SYSTEMS];
+
+void UT_Reset_OS_impl_filesys_table(void)
+{
+    memset(UT_OS_impl_filesys_table_records, 0, sizeof(UT_OS_impl_filesys_table_records));
+    OS_impl_filesys_table = UT_OS_impl_filesys_table_records;
+}
+
+int32 UT_Call_OS_VxWorks_FileSysAPI_Impl_Init(void)
+{
+    return OS_VxWorks_FileSysAPI_Impl_Init();
+}
 
 void UT_FileSysTest_SetupFileSysEntry(osal_index_t id, OCS_BLK_DEV *blkdev, OCS_device_t xbddev, uint32 MaxParts)
 {
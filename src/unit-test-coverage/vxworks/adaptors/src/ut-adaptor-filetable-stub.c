@@ -29,7 +29,9 @@
 #include "os-vxworks.h"
 #include "os-impl-files.h"
 
-OS_impl_file_internal_record_t OS_impl_filehandle_table[OS_MAX_NUM_OPEN_FILES];
+static OS_impl_file_internal_record_t UT_FileTableTest_OS_impl_filehandle_records[OS_MAX_NUM_OPEN_FILES];
 
-void *const  UT_FileTableTest_OS_impl_filehandle_table      = OS_impl_filehandle_table;
-size_t const UT_FileTableTest_OS_impl_filehandle_table_SIZE = sizeof(OS_impl_filehandle_table);
+OS_impl_file_internal_record_t *OS_impl_filehandle_table = UT_FileTableTest_OS_impl_filehandle_records;
+
+void *const  UT_FileTableTest_OS_impl_filehandle_table      = UT_FileTableTest_OS_impl_filehandle_records;
+size_t const UT_FileTableTest_OS_impl_filehandle_table_SIZE = sizeof(UT_FileTableTest_OS_impl_filehandle_records);
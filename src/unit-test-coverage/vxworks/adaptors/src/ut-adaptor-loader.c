@@ -23,6 +23,8 @@
  *
  */
 
+#include <string.h>
+
 /* pull in the OSAL configuration */
 #include "osconfig.h"
 #include "ut-adaptor-loader.h"
@@ -30,8 +32,13 @@
 #include "os-vxworks.h"
 #include "os-impl-loader.h"
 
-void *const  UT_Ref_OS_impl_module_table      = OS_impl_module_table;
-size_t const UT_Ref_OS_impl_module_table_SIZE = sizeof(OS_impl_module_table);
+static OS_impl_module_internal_record_t UT_OS_impl_module_table_records[OS_MAX_MODULES];
+
+void UT_Reset_OS_impl_module_table(void)
+{
+    memset(UT_OS_impl_module_table_records, 0, sizeof(UT_OS_impl_module_table_records));
+    OS_impl_module_table = UT_OS_impl_module_table_records;
+}
 
 int32 UT_Call_OS_VxWorks_ModuleAPI_Impl_Init(void)
 {
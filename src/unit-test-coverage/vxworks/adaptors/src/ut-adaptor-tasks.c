@@ -23,6 +23,8 @@
  *
  */
 
+#include <string.h>
+
 /* pull in the OSAL configuration */
 #include "osconfig.h"
 #include "ut-adaptor-tasks.h"
@@ -31,8 +33,13 @@
 #include "os-impl-tasks.h"
 #include "osapi-idmap.h"
 
-void *const  UT_Ref_OS_impl_task_table      = OS_impl_task_table;
-size_t const UT_Ref_OS_impl_task_table_SIZE = sizeof(OS_impl_task_table);
+static OS_impl_task_internal_record_t UT_OS_impl_task_table_records[OS_MAX_TASKS];
+
+void UT_Reset_OS_impl_task_table(void)
+{
+    memset(UT_OS_impl_task_table_records, 0, sizeof(UT_OS_impl_task_table_records));
+    OS_impl_task_table = UT_OS_impl_task_table_records;
+}
 
 int32 UT_Call_OS_VxWorks_TaskAPI_Impl_Init(void)
 {
@@ -34,6 +34,15 @@
 #include "OCS_errnoLib.h"
 #include "OCS_stdio.h"
 
+void Test_OS_VxWorks_ConsoleAPI_Impl_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_VxWorks_ConsoleAPI_Impl_Init(void)
+     */
+    OSAPI_TEST_FUNCTION_RC(UT_Call_OS_VxWorks_ConsoleAPI_Impl_Init(), OS_SUCCESS);
+}
+
 void Test_OS_ConsoleWakeup_Impl(void)
 {
     /*
@@ -102,8 +111,8 @@ void Test_OS_VxWorks_ConsoleTask_Entry(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
-    memset(OS_console_table, 0, sizeof(OS_console_table));
-    memset(UT_Ref_OS_impl_console_table, 0, UT_Ref_OS_impl_console_table_SIZE);
+    memset(OS_console_table, 0, sizeof(*OS_console_table) * OS_MAX_CONSOLES);
+    UT_Reset_OS_impl_console_table();
 }
 
 /*
@@ -123,6 +132,7 @@ void Osapi_Test_Teardown(void) {}
  */
 void UtTest_Setup(void)
 {
+    ADD_TEST(OS_VxWorks_ConsoleAPI_Impl_Init);
     ADD_TEST(OS_ConsoleCreate_Impl);
     ADD_TEST(OS_ConsoleWakeup_Impl);
     ADD_TEST(OS_VxWorks_ConsoleTask_Entry);
@@ -26,6 +26,7 @@
 #include "ut-adaptor-files.h"
 
 #include "os-shared-file.h"
+#include "os-shared-idmap.h"
 
 #include "OCS_stdlib.h"
 #include "OCS_taskLib.h"
@@ -40,6 +41,9 @@ void Test_OS_VxWorks_StreamAPI_Impl_Init(void)
      * int32 OS_Works_StreamAPI_Impl_Init(void)
      */
     OSAPI_TEST_FUNCTION_RC(UT_Call_OS_VxWorks_StreamAPI_Impl_Init(), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdTableAlloc), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(UT_Call_OS_VxWorks_StreamAPI_Impl_Init(), OS_ERROR);
 }
 
 /* ------------------- End of test cases --------------------------------------*/
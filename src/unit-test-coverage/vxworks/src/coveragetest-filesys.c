@@ -37,6 +37,15 @@
 #include "OCS_dosFsLib.h"
 #include "OCS_xbdBlkDev.h"
 
+void Test_OS_VxWorks_FileSysAPI_Impl_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_VxWorks_FileSysAPI_Impl_Init(void)
+     */
+    OSAPI_TEST_FUNCTION_RC(UT_Call_OS_VxWorks_FileSysAPI_Impl_Init(), OS_SUCCESS);
+}
+
 void Test_OS_FileSysStartVolume_Impl(void)
 {
     /*
@@ -247,10 +256,10 @@ void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
 
-    memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
+    memset(OS_filesys_table, 0, sizeof(*OS_filesys_table) * OS_MAX_FILE_SYSTEMS);
     memset(OS_global_filesys_table, 0, sizeof(OS_common_record_t) * OS_MAX_FILE_SYSTEMS);
 
-    memset(UT_Ref_OS_impl_filesys_table, 0, UT_Ref_OS_impl_filesys_table_SIZE);
+    UT_Reset_OS_impl_filesys_table();
 }
 
 /*
@@ -268,6 +277,7 @@ void Osapi_Test_Teardown(void) {}
  */
 void UtTest_Setup(void)
 {
+    ADD_TEST(OS_VxWorks_FileSysAPI_Impl_Init);
     ADD_TEST(OS_FileSysStartVolume_Impl);
     ADD_TEST(OS_FileSysStopVolume_Impl);
     ADD_TEST(OS_FileSysFormatVolume_Impl);
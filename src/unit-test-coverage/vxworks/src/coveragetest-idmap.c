@@ -27,9 +27,11 @@
 #include "ut-adaptor-idmap.h"
 
 #include "os-shared-idmap.h"
+#include "os-shared-timebase.h"
 
 #include "OCS_errno.h"
 #include "OCS_objLib.h"
+#include "OCS_taskLib.h"
 
 OCS_SEM TestGlobalSem;
 
@@ -88,16 +90,39 @@ void Test_OS_WaitForStateChange_Impl(void)
 {
     /*
      * Test Case For:
-     * void OS_WaitForStateChange_Impl(osal_objtype_t objtype, uint32 attempts)
+     * void OS_WaitForStateChange_Impl(osal_objtype_t objtype, int32 timeout)
      */
 
     /*
      * This has no return value/error results - just needs to be called for coverage.
-     * Call it once with a low number and once with a high number of attempts -
-     * which should cause it to hit its limit for wait time.
+     * Call it with a short timeout, a long timeout and an indefinite timeout -
+     * the latter two should be limited to the polling interval.
      */
     OS_WaitForStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, 1);
     OS_WaitForStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, 1000);
+    OS_WaitForStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, OS_PEND);
+    UtAssert_STUB_COUNT(OCS_taskDelay, 3);
+
+    /* tick conversion failure should still wait for a tick */
+    UT_SetDefaultReturnValue(UT_KEY(OS_Milli2Ticks), OS_ERROR);
+    OS_WaitForStateChange_Impl(OS_OBJECT_TYPE_OS_TASK, 1);
+    UtAssert_STUB_COUNT(OCS_taskDelay, 4);
+}
+
+void Test_OS_WaitForHandoff_Impl(void)
+{
+    /*
+     * Test Case For:
+     * void OS_WaitForHandoff_Impl(osal_objtype_t objtype, int32 timeout)
+     * void OS_SignalHandoff_Impl(osal_objtype_t objtype)
+     *
+     * These are a wrapper around OS_WaitForStateChange_Impl and a no-op,
+     * respectively, and just need to be called for coverage.
+     */
+    OS_WaitForHandoff_Impl(OS_OBJECT_TYPE_OS_TASK, 1);
+    UtAssert_STUB_COUNT(OCS_taskDelay, 1);
+
+    OS_SignalHandoff_Impl(OS_OBJECT_TYPE_OS_TASK);
 }
 
 /* ------------------- End of test cases --------------------------------------*/
@@ -131,4 +156,5 @@ void UtTest_Setup(void)
     ADD_TEST(OS_Unlock_Global_Impl);
     ADD_TEST(OS_API_Impl_Init);
     ADD_TEST(OS_WaitForStateChange_Impl);
+    ADD_TEST(OS_WaitForHandoff_Impl);
 }
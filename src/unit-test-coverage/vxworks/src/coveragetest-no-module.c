@@ -100,10 +100,10 @@ void Osapi_Test_Setup(void)
     UT_ResetState(0);
 
     memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
-    memset(OS_module_table, 0, sizeof(OS_module_table));
+    memset(OS_module_table, 0, sizeof(*OS_module_table) * OS_MAX_MODULES);
     memset(OS_global_module_table, 0, sizeof(OS_common_record_t) * OS_MAX_MODULES);
 
-    memset(UT_Ref_OS_impl_module_table, 0, UT_Ref_OS_impl_module_table_SIZE);
+    UT_Reset_OS_impl_module_table();
 }
 
 /*
@@ -67,6 +67,18 @@ void Test_OS_QueueDelete_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueueDelete_Impl(&token), OS_ERROR);
 }
 
+void Test_OS_QueueDeletePending_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueDeletePending_Impl(const OS_object_token_t *token, bool pending)
+     */
+    OS_object_token_t token = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDeletePending_Impl(&token, true), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueDeletePending_Impl(&token, false), OS_SUCCESS);
+}
+
 void Test_OS_QueueGet_Impl(void)
 {
     /*
@@ -93,6 +105,23 @@ void Test_OS_QueueGet_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueueGet_Impl(&token, &Data, sizeof(Data), &ActSz, OS_CHECK), OS_ERROR);
 }
 
+void Test_OS_QueueGetWithPriority_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetWithPriority_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied,
+     *                                    uint32 *priority, int32 timeout)
+     */
+    char              Data[16];
+    size_t            ActSz;
+    uint32            Priority = 99;
+    OS_object_token_t token    = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetWithPriority_Impl(&token, &Data, sizeof(Data), &ActSz, &Priority, OS_CHECK),
+                           OS_SUCCESS);
+    UtAssert_ZERO(Priority);
+}
+
 void Test_OS_QueuePut_Impl(void)
 {
     /*
@@ -111,6 +140,91 @@ void Test_OS_QueuePut_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueuePut_Impl(&token, Data, sizeof(Data), 0), OS_ERROR);
 }
 
+void Test_OS_QueuePutTimed_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueuePutTimed_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags,
+     *                             int32 timeout)
+     */
+    char              Data[16] = "Test";
+    OS_object_token_t token    = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed_Impl(&token, Data, sizeof(Data), 0, OS_PEND), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed_Impl(&token, Data, sizeof(Data), 0, OS_CHECK), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed_Impl(&token, Data, sizeof(Data), 0, 100), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed_Impl(&token, Data, sizeof(Data), OS_QUEUE_PRIORITY(1), OS_CHECK),
+                           OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_Milli2Ticks), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed_Impl(&token, Data, sizeof(Data), 0, 100), OS_ERROR);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_msgQSend), OCS_ERROR);
+    OCS_errno = OCS_S_objLib_OBJ_TIMEOUT;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed_Impl(&token, Data, sizeof(Data), 0, OS_PEND), OS_QUEUE_TIMEOUT);
+    OCS_errno = OCS_S_objLib_OBJ_UNAVAILABLE;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed_Impl(&token, Data, sizeof(Data), 0, OS_CHECK), OS_QUEUE_FULL);
+    OCS_errno = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutTimed_Impl(&token, Data, sizeof(Data), 0, OS_PEND), OS_ERROR);
+}
+
+void Test_OS_QueueGetMultiple_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetMultiple_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *sizes,
+     *                                uint32 max_count, uint32 *count_copied, int32 timeout)
+     */
+    char              Data[3][16];
+    size_t            Sizes[3];
+    uint32            Count;
+    OS_object_token_t token = UT_TOKEN_0;
+
+    /* All buffers filled */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple_Impl(&token, Data, sizeof(Data[0]), Sizes, 3, &Count, OS_PEND),
+                           OS_SUCCESS);
+    UtAssert_UINT32_EQ(Count, 3);
+    UtAssert_STUB_COUNT(OCS_msgQReceive, 3);
+
+    /* Running out of messages after the first is not an error */
+    UT_SetDeferredRetcode(UT_KEY(OCS_msgQReceive), 2, OCS_ERROR);
+    OCS_errno = OCS_S_objLib_OBJ_UNAVAILABLE;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple_Impl(&token, Data, sizeof(Data[0]), Sizes, 3, &Count, OS_PEND),
+                           OS_SUCCESS);
+    UtAssert_UINT32_EQ(Count, 1);
+
+    /* No message at all */
+    UT_SetDeferredRetcode(UT_KEY(OCS_msgQReceive), 1, OCS_ERROR);
+    OCS_errno = OCS_S_objLib_OBJ_UNAVAILABLE;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetMultiple_Impl(&token, Data, sizeof(Data[0]), Sizes, 3, &Count, OS_CHECK),
+                           OS_QUEUE_EMPTY);
+    UtAssert_ZERO(Count);
+}
+
+void Test_OS_QueuePutMultiple_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueuePutMultiple_Impl(const OS_object_token_t *token, const void *data, size_t size,
+     *                                const size_t *sizes, uint32 count, uint32 flags, uint32 *count_put)
+     */
+    char              Data[3][16] = {"Test1", "Test2", "Test3"};
+    size_t            Sizes[3]    = {16, 16, 16};
+    uint32            Count;
+    OS_object_token_t token = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple_Impl(&token, Data, sizeof(Data[0]), Sizes, 3, 0, &Count), OS_SUCCESS);
+    UtAssert_UINT32_EQ(Count, 3);
+    UtAssert_STUB_COUNT(OCS_msgQSend, 3);
+
+    /* The queue becoming full stops the remaining messages */
+    UT_SetDeferredRetcode(UT_KEY(OCS_msgQSend), 3, OCS_ERROR);
+    OCS_errno = OCS_S_objLib_OBJ_UNAVAILABLE;
+    OSAPI_TEST_FUNCTION_RC(OS_QueuePutMultiple_Impl(&token, Data, sizeof(Data[0]), Sizes, 3, 0, &Count),
+                           OS_QUEUE_FULL);
+    UtAssert_UINT32_EQ(Count, 2);
+}
+
 void Test_OS_QueueGetInfo_Impl(void)
 {
     /*
@@ -135,10 +249,10 @@ void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
 
-    memset(OS_queue_table, 0, sizeof(OS_queue_table));
+    memset(OS_queue_table, 0, sizeof(*OS_queue_table) * OS_MAX_QUEUES);
     memset(OS_global_queue_table, 0, sizeof(OS_common_record_t) * OS_MAX_QUEUES);
 
-    memset(UT_Ref_OS_impl_queue_table, 0, UT_Ref_OS_impl_queue_table_SIZE);
+    UT_Reset_OS_impl_queue_table();
 }
 
 /*
@@ -159,7 +273,12 @@ void UtTest_Setup(void)
     ADD_TEST(OS_VxWorks_QueueAPI_Impl_Init);
     ADD_TEST(OS_QueueCreate_Impl);
     ADD_TEST(OS_QueueDelete_Impl);
+    ADD_TEST(OS_QueueDeletePending_Impl);
     ADD_TEST(OS_QueueGet_Impl);
+    ADD_TEST(OS_QueueGetWithPriority_Impl);
     ADD_TEST(OS_QueuePut_Impl);
+    ADD_TEST(OS_QueuePutTimed_Impl);
+    ADD_TEST(OS_QueueGetMultiple_Impl);
+    ADD_TEST(OS_QueuePutMultiple_Impl);
     ADD_TEST(OS_QueueGetInfo_Impl);
 }
@@ -284,10 +284,13 @@ void Test_OS_TaskIdMatchSystemData_Impl(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
-    memset(OS_task_table, 0, sizeof(OS_task_table));
+    memset(OS_task_table, 0, sizeof(*OS_task_table) * OS_MAX_TASKS);
     memset(OS_global_task_table, 0, sizeof(OS_common_record_t) * OS_MAX_TASKS);
 
-    memset(UT_Ref_OS_impl_task_table, 0, UT_Ref_OS_impl_task_table_SIZE);
+    UT_Reset_OS_impl_task_table();
+
+    /* keep table scans within the statically-sized test tables */
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetMaxForObjectType), OS_MAX_TASKS);
 }
 
 /*
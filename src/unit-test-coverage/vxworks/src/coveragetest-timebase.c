@@ -286,10 +286,13 @@ void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
 
-    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
+    memset(OS_timebase_table, 0, sizeof(*OS_timebase_table) * OS_MAX_TIMEBASES);
     memset(OS_global_timebase_table, 0, sizeof(OS_common_record_t) * OS_MAX_TIMEBASES);
 
-    memset(UT_Ref_OS_impl_timebase_table, 0, UT_Ref_OS_impl_timebase_table_SIZE);
+    UT_Reset_OS_impl_timebase_table();
+
+    /* keep table scans within the statically-sized test tables */
+    UT_SetDefaultReturnValue(UT_KEY(OS_GetMaxForObjectType), OS_MAX_TIMEBASES);
 }
 
 /*
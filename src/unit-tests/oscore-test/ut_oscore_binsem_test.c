@@ -143,6 +143,96 @@ void UT_os_bin_sem_delete_test(void)
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_BinSemCreateBatch
+** Purpose: Creates several binary semaphores at once
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_INVALID_SIZE if the count is zero
+**          OS_ERR_NAME_TAKEN if any name passed in has already been used
+**          OS_ERR_NO_FREE_IDS if there are not enough free binary semaphore ids
+**          OS_SEM_FAILURE if the OS call failed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_bin_sem_create_batch_test(void)
+{
+    int         i;
+    char        sem_names[OS_MAX_BIN_SEMAPHORES + 1][UT_OS_NAME_BUFF_SIZE];
+    const char *sem_name_ptrs[OS_MAX_BIN_SEMAPHORES + 1];
+    osal_id_t   sem_ids[OS_MAX_BIN_SEMAPHORES + 1];
+
+    for (i = 0; i <= OS_MAX_BIN_SEMAPHORES; i++)
+    {
+        memset(sem_names[i], '\0', sizeof(sem_names[i]));
+        UT_os_sprintf(sem_names[i], "BINSEM%d", i);
+        sem_name_ptrs[i] = sem_names[i];
+    }
+
+    /*-----------------------------------------------------*/
+    UT_RETVAL(OS_BinSemCreateBatch(NULL, sem_name_ptrs, 2, 1, 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_BinSemCreateBatch(sem_ids, NULL, 2, 1, 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_BinSemCreateBatch(sem_ids, sem_name_ptrs, 0, 1, 0), OS_ERR_INVALID_SIZE);
+
+    /*-----------------------------------------------------*/
+    /* None of the semaphores should be created if there are not enough ids for all */
+    UT_RETVAL(OS_BinSemCreateBatch(sem_ids, sem_name_ptrs, OS_MAX_BIN_SEMAPHORES + 1, 1, 0), OS_ERR_NO_FREE_IDS);
+    UtAssert_True(!OS_ObjectIdDefined(sem_ids[0]), "sem_ids[0] undefined after failure");
+    UT_RETVAL(OS_BinSemGetIdByName(&sem_ids[0], sem_names[0]), OS_ERR_NAME_NOT_FOUND);
+
+    /*-----------------------------------------------------*/
+    sem_name_ptrs[1] = sem_names[0];
+    UT_RETVAL(OS_BinSemCreateBatch(sem_ids, sem_name_ptrs, 2, 1, 0), OS_ERR_NAME_TAKEN);
+    sem_name_ptrs[1] = sem_names[1];
+
+    /*-----------------------------------------------------*/
+    if (UT_NOMINAL(OS_BinSemCreateBatch(sem_ids, sem_name_ptrs, OS_MAX_BIN_SEMAPHORES, 1, 0)))
+    {
+        UT_NOMINAL(OS_BinSemTake(sem_ids[OS_MAX_BIN_SEMAPHORES - 1]));
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_BinSemDeleteBatch(sem_ids, OS_MAX_BIN_SEMAPHORES));
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_BinSemDeleteBatch
+** Purpose: Deletes several binary semaphores at once
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_SIZE if the count is zero
+**          OS_ERR_INVALID_ID if any id passed in does not exist
+**          OS_SEM_FAILURE if the OS call failed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_bin_sem_delete_batch_test(void)
+{
+    osal_id_t sem_ids[3];
+
+    /*-----------------------------------------------------*/
+    UT_RETVAL(OS_BinSemDeleteBatch(NULL, 1), OS_INVALID_POINTER);
+    UT_RETVAL(OS_BinSemDeleteBatch(sem_ids, 0), OS_ERR_INVALID_SIZE);
+
+    /*-----------------------------------------------------*/
+    /* The valid semaphores should be deleted even if another id is not valid */
+    if (UT_SETUP(OS_BinSemCreate(&sem_ids[0], "DeleteBatch1", 1, 0)))
+    {
+        if (UT_SETUP(OS_BinSemCreate(&sem_ids[2], "DeleteBatch2", 1, 0)))
+        {
+            sem_ids[1] = UT_OBJID_INCORRECT;
+            UT_RETVAL(OS_BinSemDeleteBatch(sem_ids, 3), OS_ERR_INVALID_ID);
+            UT_RETVAL(OS_BinSemDelete(sem_ids[2]), OS_ERR_INVALID_ID);
+        }
+
+        UT_RETVAL(OS_BinSemDelete(sem_ids[0]), OS_ERR_INVALID_ID);
+    }
+
+    /*-----------------------------------------------------*/
+    if (UT_SETUP(OS_BinSemCreate(&sem_ids[0], "DeleteBatch3", 1, 0)))
+    {
+        UT_NOMINAL(OS_BinSemDeleteBatch(sem_ids, 1));
+    }
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_BinSemFlush
 ** Purpose: Releases all the tasks waiting on the given semaphore
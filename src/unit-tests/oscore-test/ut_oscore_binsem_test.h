@@ -54,6 +54,8 @@
 
 void UT_os_bin_sem_create_test(void);
 void UT_os_bin_sem_delete_test(void);
+void UT_os_bin_sem_create_batch_test(void);
+void UT_os_bin_sem_delete_batch_test(void);
 void UT_os_bin_sem_flush_test(void);
 void UT_os_bin_sem_give_test(void);
 void UT_os_bin_sem_timed_wait_test(void);
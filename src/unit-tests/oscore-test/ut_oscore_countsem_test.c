@@ -281,6 +281,66 @@ void UT_os_count_sem_timed_wait_test(void)
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_CountSemGiveN, OS_CountSemTakeN, OS_CountSemTimedWaitN
+** Purpose: Gives or takes several units of a counting semaphore at once
+** Parameters: To-be-filled-in
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid counting semaphore id
+**          OS_INVALID_SEM_VALUE if the count is zero
+**          OS_SEM_TIMEOUT if the units were not all available in time
+**          OS_ERR_NOT_IMPLEMENTED if not supported by the implementation
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_count_sem_multi_test(void)
+{
+    osal_id_t           count_sem_id = OS_OBJECT_ID_UNDEFINED;
+    OS_count_sem_prop_t prop;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_CountSemGiveN(UT_OBJID_INCORRECT, 2), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_CountSemTakeN(OS_OBJECT_ID_UNDEFINED, 2), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_CountSemTimedWaitN(UT_OBJID_INCORRECT, 2, 1000), OS_ERR_INVALID_ID);
+
+    /* Setup */
+    if (!UT_SETUP(OS_CountSemCreate(&count_sem_id, "MultiTest", 1, 0)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-count-arg */
+
+    UT_RETVAL(OS_CountSemGiveN(count_sem_id, 0), OS_INVALID_SEM_VALUE);
+    UT_RETVAL(OS_CountSemTakeN(count_sem_id, 0), OS_INVALID_SEM_VALUE);
+    UT_RETVAL(OS_CountSemTimedWaitN(count_sem_id, 0, 1000), OS_INVALID_SEM_VALUE);
+
+    /*-----------------------------------------------------*/
+    /* #3 Sem-take-timed-out, which must not take the unit that is available */
+
+    if (UT_IMPL(OS_CountSemTimedWaitN(count_sem_id, 3, 100)))
+    {
+        UT_RETVAL(OS_CountSemTimedWaitN(count_sem_id, 3, 100), OS_SEM_TIMEOUT);
+        UT_NOMINAL(OS_CountSemGetInfo(count_sem_id, &prop));
+        UtAssert_INT32_EQ(prop.value, 1);
+
+        /*-----------------------------------------------------*/
+        /* #4 Nominal */
+
+        UT_NOMINAL(OS_CountSemGiveN(count_sem_id, 2));
+        UT_NOMINAL(OS_CountSemGetInfo(count_sem_id, &prop));
+        UtAssert_INT32_EQ(prop.value, 3);
+
+        UT_NOMINAL(OS_CountSemTakeN(count_sem_id, 2));
+        UT_NOMINAL(OS_CountSemTimedWaitN(count_sem_id, 1, 1000));
+        UT_NOMINAL(OS_CountSemGetInfo(count_sem_id, &prop));
+        UtAssert_INT32_EQ(prop.value, 0);
+    }
+
+    UT_TEARDOWN(OS_CountSemDelete(count_sem_id));
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_CountSemGetIdByName
 ** Purpose: Returns the id of a given counting semaphore name
@@ -57,6 +57,7 @@ void UT_os_count_sem_delete_test(void);
 void UT_os_count_sem_give_test(void);
 void UT_os_count_sem_timed_wait_test(void);
 void UT_os_count_sem_take_test(void);
+void UT_os_count_sem_multi_test(void);
 void UT_os_count_sem_get_id_by_name_test(void);
 void UT_os_count_sem_get_info_test(void);
 
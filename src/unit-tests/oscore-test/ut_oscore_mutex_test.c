@@ -44,6 +44,10 @@
 ** Global variables
 **--------------------------------------------------------------------------------*/
 
+static osal_id_t UT_os_mut_sem_ceiling_id;
+static int32     UT_os_mut_sem_ceiling_take_rc;
+static int32     UT_os_mut_sem_ceiling_give_rc;
+
 /*--------------------------------------------------------------------------------*
 ** Local function prototypes
 **--------------------------------------------------------------------------------*/
@@ -52,6 +56,16 @@
 ** Local function definitions
 **--------------------------------------------------------------------------------*/
 
+/*
+ * Takes and gives the priority ceiling mutex.  This must be done by a task with
+ * a priority no higher than the ceiling, which is not true of the test itself.
+ */
+static void UT_os_mut_sem_ceiling_task(void)
+{
+    UT_os_mut_sem_ceiling_take_rc = OS_MutSemTake(UT_os_mut_sem_ceiling_id);
+    UT_os_mut_sem_ceiling_give_rc = OS_MutSemGive(UT_os_mut_sem_ceiling_id);
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_MutSemCreate
 ** Purpose: Creates a mutex semaphore
@@ -68,6 +82,7 @@ void UT_os_mut_sem_create_test(void)
     int       i;
     osal_id_t mut_sem_id  = OS_OBJECT_ID_UNDEFINED;
     osal_id_t mut_sem_id2 = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t task_id     = OS_OBJECT_ID_UNDEFINED;
     char      sem_name[UT_OS_NAME_BUFF_SIZE];
     char      long_sem_name[UT_OS_NAME_BUFF_SIZE];
 
@@ -128,6 +143,35 @@ void UT_os_mut_sem_create_test(void)
 
     /* Reset test environment */
     UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+
+    /*-----------------------------------------------------*/
+    /* #8 Nominal, adaptive with the default and a given spin time */
+
+    UT_NOMINAL(OS_MutSemCreate(&mut_sem_id, "Adaptive", OS_MUTEX_FLAG_ADAPTIVE));
+    UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+
+    UT_NOMINAL(OS_MutSemCreate(&mut_sem_id, "Adaptive", OS_MUTEX_FLAG_ADAPTIVE | OS_MUTEX_SPIN_USEC(5)));
+    UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+
+    /*-----------------------------------------------------*/
+    /* #9 Nominal, priority ceiling above the priority of the task using it */
+
+    UT_NOMINAL(OS_MutSemCreate(&mut_sem_id, "Ceiling", OS_MUTEX_FLAG_PRIO_CEILING | OS_MUTEX_CEILING(50)));
+
+    UT_os_mut_sem_ceiling_id      = mut_sem_id;
+    UT_os_mut_sem_ceiling_take_rc = OS_ERROR;
+    UT_os_mut_sem_ceiling_give_rc = OS_ERROR;
+    if (UT_SETUP(OS_TaskCreate(&task_id, "Ceiling", UT_os_mut_sem_ceiling_task, OSAL_TASK_STACK_ALLOCATE,
+                               OSAL_SIZE_C(4096), OSAL_PRIORITY_C(100), 0)))
+    {
+        /* allow the task to run and exit */
+        OS_TaskDelay(50);
+
+        UtAssert_INT32_EQ(UT_os_mut_sem_ceiling_take_rc, OS_SUCCESS);
+        UtAssert_INT32_EQ(UT_os_mut_sem_ceiling_give_rc, OS_SUCCESS);
+    }
+
+    UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
 }
 
 /*--------------------------------------------------------------------------------*
@@ -306,6 +350,83 @@ void UT_os_mut_sem_get_info_test(void)
 
         UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
     }
+
+    /*-----------------------------------------------------*/
+    /* #4 Nominal, takes of an adaptive mutex which is not held neither spin nor block */
+
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "GetInfo", OS_MUTEX_FLAG_ADAPTIVE)))
+    {
+        UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+        UT_NOMINAL(OS_MutSemGive(mut_sem_id));
+
+        UT_NOMINAL(OS_MutSemGetInfo(mut_sem_id, &mut_sem_prop));
+        UtAssert_UINT32_EQ(mut_sem_prop.spin_count, 0);
+        UtAssert_UINT32_EQ(mut_sem_prop.block_count, 0);
+
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_MutSemGetStats, OS_MutSemResetStats
+** Purpose: Returns contention and hold time statistics about the given mutex id
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in is not a valid mutex id
+**          OS_ERR_NOT_IMPLEMENTED if mutex statistics are not enabled
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_mut_sem_get_stats_test(void)
+{
+    osal_id_t          mut_sem_id = OS_OBJECT_ID_UNDEFINED;
+    OS_mut_sem_stats_t stats;
+
+    /*-----------------------------------------------------*/
+    /* #1 Not-implemented */
+
+    if (!UT_IMPL(OS_MutSemGetStats(UT_OBJID_INCORRECT, &stats)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-ID-arg */
+
+    UT_RETVAL(OS_MutSemGetStats(UT_OBJID_INCORRECT, &stats), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_MutSemResetStats(UT_OBJID_INCORRECT), OS_ERR_INVALID_ID);
+
+    if (!UT_SETUP(OS_MutSemCreate(&mut_sem_id, "MutStats", 0)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #3 Invalid-pointer-arg */
+
+    UT_RETVAL(OS_MutSemGetStats(mut_sem_id, NULL), OS_INVALID_POINTER);
+
+    /*-----------------------------------------------------*/
+    /* #4 Nominal, the mutex is taken twice by this task and never waited for */
+
+    UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+    UT_NOMINAL(OS_MutSemGive(mut_sem_id));
+    UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+    UT_NOMINAL(OS_MutSemGive(mut_sem_id));
+
+    UT_NOMINAL(OS_MutSemGetStats(mut_sem_id, &stats));
+    UtAssert_UINT32_EQ(stats.take_count, 2);
+    UtAssert_ZERO(stats.contended_count);
+    UtAssert_True(OS_ObjectIdEqual(stats.max_hold_task, OS_TaskGetId()), "max_hold_task is this task");
+
+    /*-----------------------------------------------------*/
+    /* #5 Nominal, reset */
+
+    UT_NOMINAL(OS_MutSemResetStats(mut_sem_id));
+    UT_NOMINAL(OS_MutSemGetStats(mut_sem_id, &stats));
+    UtAssert_ZERO(stats.take_count);
+    UtAssert_True(!OS_ObjectIdDefined(stats.max_hold_task), "max_hold_task is undefined");
+
+    UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
 }
 
 /*================================================================================*
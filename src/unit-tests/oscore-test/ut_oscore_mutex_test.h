@@ -58,6 +58,7 @@ void UT_os_mut_sem_give_test(void);
 void UT_os_mut_sem_take_test(void);
 void UT_os_mut_sem_get_id_by_name_test(void);
 void UT_os_mut_sem_get_info_test(void);
+void UT_os_mut_sem_get_stats_test(void);
 
 /*--------------------------------------------------------------------------------*/
 
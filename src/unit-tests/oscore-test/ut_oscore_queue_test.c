@@ -141,6 +141,15 @@ void UT_os_queue_create_test(void)
 
     /* Reset test environment */
     UT_TEARDOWN(OS_QueueDelete(queue_id));
+
+    /*-----------------------------------------------------*/
+    /* #8 Nominal, held in process memory at the maximum depth */
+
+    UT_NOMINAL(OS_QueueCreate(&queue_id, "Local", OSAL_BLOCKCOUNT_C(OS_QUEUE_MAX_DEPTH), sizeof(uint32),
+                              OS_QUEUE_FLAG_LOCAL));
+
+    /* Reset test environment */
+    UT_TEARDOWN(OS_QueueDelete(queue_id));
 }
 
 /*--------------------------------------------------------------------------------*
@@ -150,10 +159,26 @@ void UT_os_queue_create_test(void)
 ** Returns: OS_ERR_INVALID_ID if the id passed in does not exist
 **          OS_ERROR if the OS call to delete the queue failed
 **          OS_SUCCESS if succeeded
+**
+** A task blocked in a get on the deleted queue returns OS_ERR_INVALID_ID.
 **--------------------------------------------------------------------------------*/
+static osal_id_t UT_os_queue_delete_id;
+static int32     UT_os_queue_delete_status;
+static bool      UT_os_queue_delete_done;
+
+static void UT_os_queue_delete_reader(void)
+{
+    uint32 data;
+    size_t size_copied;
+
+    UT_os_queue_delete_status = OS_QueueGet(UT_os_queue_delete_id, &data, sizeof(data), &size_copied, 1000);
+    UT_os_queue_delete_done = true;
+}
+
 void UT_os_queue_delete_test(void)
 {
     osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t task_id  = OS_OBJECT_ID_UNDEFINED;
 
     /*-----------------------------------------------------*/
     /* #1 Invalid-ID-arg */
@@ -168,6 +193,127 @@ void UT_os_queue_delete_test(void)
     {
         UT_NOMINAL(OS_QueueDelete(queue_id));
     }
+
+    /*-----------------------------------------------------*/
+    /* #4 A task blocked on the queue is woken by the delete */
+
+    if (UT_SETUP(OS_QueueCreate(&queue_id, "DeleteTest", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+    {
+        UT_os_queue_delete_id     = queue_id;
+        UT_os_queue_delete_status = OS_SUCCESS;
+        UT_os_queue_delete_done   = false;
+        if (UT_SETUP(OS_TaskCreate(&task_id, "QueueDeleteReader", UT_os_queue_delete_reader,
+                                   OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096), OSAL_PRIORITY_C(100), 0)))
+        {
+            /* let the reader block on the empty queue */
+            OS_TaskDelay(50);
+            UT_NOMINAL(OS_QueueDelete(queue_id));
+
+            /* allow the reader to exit */
+            OS_TaskDelay(50);
+            if (UT_os_queue_delete_done)
+            {
+                UtAssert_INT32_EQ(UT_os_queue_delete_status, OS_ERR_INVALID_ID);
+            }
+            else
+            {
+                UtAssert_NA("Task blocked on a deleted queue is not woken by this implementation");
+                OS_TaskDelay(1000);
+            }
+        }
+        else
+        {
+            UT_TEARDOWN(OS_QueueDelete(queue_id));
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueCreateBatch
+** Purpose: Creates several queues at once
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_INVALID_SIZE if the count is zero
+**          OS_ERR_NAME_TAKEN if any name passed in has already been used
+**          OS_ERR_NO_FREE_IDS if there are not enough free queue ids
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_create_batch_test(void)
+{
+    int         i;
+    char        queue_names[OS_MAX_QUEUES + 1][UT_OS_NAME_BUFF_SIZE];
+    const char *queue_name_ptrs[OS_MAX_QUEUES + 1];
+    osal_id_t   queue_ids[OS_MAX_QUEUES + 1];
+
+    for (i = 0; i <= OS_MAX_QUEUES; i++)
+    {
+        memset(queue_names[i], '\0', sizeof(queue_names[i]));
+        UT_os_sprintf(queue_names[i], "QUEUE%d", i);
+        queue_name_ptrs[i] = queue_names[i];
+    }
+
+    /*-----------------------------------------------------*/
+    UT_RETVAL(OS_QueueCreateBatch(NULL, queue_name_ptrs, 2, OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueCreateBatch(queue_ids, NULL, 2, OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueCreateBatch(queue_ids, queue_name_ptrs, 0, OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0), OS_ERR_INVALID_SIZE);
+
+    /*-----------------------------------------------------*/
+    /* None of the queues should be created if there are not enough ids for all */
+    UT_RETVAL(OS_QueueCreateBatch(queue_ids, queue_name_ptrs, OS_MAX_QUEUES + 1, OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0), OS_ERR_NO_FREE_IDS);
+    UtAssert_True(!OS_ObjectIdDefined(queue_ids[0]), "queue_ids[0] undefined after failure");
+    UT_RETVAL(OS_QueueGetIdByName(&queue_ids[0], queue_names[0]), OS_ERR_NAME_NOT_FOUND);
+
+    /*-----------------------------------------------------*/
+    queue_name_ptrs[1] = queue_names[0];
+    UT_RETVAL(OS_QueueCreateBatch(queue_ids, queue_name_ptrs, 2, OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0), OS_ERR_NAME_TAKEN);
+    queue_name_ptrs[1] = queue_names[1];
+
+    /*-----------------------------------------------------*/
+    if (UT_NOMINAL(OS_QueueCreateBatch(queue_ids, queue_name_ptrs, OS_MAX_QUEUES, OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+    {
+        /* Reset test environment */
+        UT_TEARDOWN(OS_QueueDeleteBatch(queue_ids, OS_MAX_QUEUES));
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueDeleteBatch
+** Purpose: Deletes several queues at once
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_SIZE if the count is zero
+**          OS_ERR_INVALID_ID if any id passed in does not exist
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_delete_batch_test(void)
+{
+    osal_id_t queue_ids[3];
+
+    /*-----------------------------------------------------*/
+    UT_RETVAL(OS_QueueDeleteBatch(NULL, 1), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueDeleteBatch(queue_ids, 0), OS_ERR_INVALID_SIZE);
+
+    /*-----------------------------------------------------*/
+    /* The valid queues should be deleted even if another id is not valid */
+    if (UT_SETUP(OS_QueueCreate(&queue_ids[0], "DeleteBatch1", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+    {
+        if (UT_SETUP(OS_QueueCreate(&queue_ids[2], "DeleteBatch2", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+        {
+            queue_ids[1] = UT_OBJID_INCORRECT;
+            UT_RETVAL(OS_QueueDeleteBatch(queue_ids, 3), OS_ERR_INVALID_ID);
+            UT_RETVAL(OS_QueueDelete(queue_ids[2]), OS_ERR_INVALID_ID);
+        }
+
+        UT_RETVAL(OS_QueueDelete(queue_ids[0]), OS_ERR_INVALID_ID);
+    }
+
+    /*-----------------------------------------------------*/
+    if (UT_SETUP(OS_QueueCreate(&queue_ids[0], "DeleteBatch3", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+    {
+        UT_NOMINAL(OS_QueueDeleteBatch(queue_ids, 1));
+    }
 }
 
 /*--------------------------------------------------------------------------------*
@@ -353,6 +499,765 @@ void UT_os_queue_put_test(void)
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueuePutMultiple, OS_QueueGetMultiple
+** Purpose: Sends and receives several messages on an existing queue in one call
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in does not exist
+**          OS_QUEUE_INVALID_SIZE if a message or buffer size is not valid for the queue
+**          OS_QUEUE_FULL if the queue could not accept all the messages
+**          OS_QUEUE_EMPTY if the queue has no messages
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_multiple_test(void)
+{
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    uint32    data_out[12];
+    uint32    data_in[12];
+    size_t    sizes[12];
+    uint32    count = 0;
+    uint32    i;
+
+    for (i = 0; i < 12; ++i)
+    {
+        data_out[i] = 0x11223344 + i;
+        sizes[i]    = sizeof(uint32);
+    }
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_QueuePutMultiple(UT_OBJID_INCORRECT, data_out, sizeof(uint32), sizes, 3, 0, &count),
+              OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueGetMultiple(UT_OBJID_INCORRECT, data_in, sizeof(uint32), sizes, 3, &count, OS_CHECK),
+              OS_ERR_INVALID_ID);
+
+    if (!UT_SETUP(OS_QueueCreate(&queue_id, "QueueMultiple", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-pointer-arg and invalid size */
+
+    UT_RETVAL(OS_QueuePutMultiple(queue_id, NULL, sizeof(uint32), sizes, 3, 0, &count), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueGetMultiple(queue_id, NULL, sizeof(uint32), sizes, 3, &count, OS_CHECK), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueuePutMultiple(queue_id, data_out, sizeof(uint32), sizes, 0, 0, &count), OS_ERR_INVALID_SIZE);
+    UT_RETVAL(OS_QueueGetMultiple(queue_id, data_in, sizeof(uint32), sizes, 0, &count, OS_CHECK),
+              OS_ERR_INVALID_SIZE);
+    UT_RETVAL(OS_QueueGetMultiple(queue_id, data_in, sizeof(uint32) - 1, sizes, 3, &count, OS_CHECK),
+              OS_QUEUE_INVALID_SIZE);
+
+    /*-----------------------------------------------------*/
+    /* #3 Queue-empty */
+
+    UT_RETVAL(OS_QueueGetMultiple(queue_id, data_in, sizeof(uint32), sizes, 3, &count, OS_CHECK), OS_QUEUE_EMPTY);
+    UtAssert_ZERO(count);
+
+    /*-----------------------------------------------------*/
+    /* #4 Nominal, fewer messages pending than buffers */
+
+    for (i = 0; i < 3; ++i)
+    {
+        sizes[i] = sizeof(uint32);
+    }
+
+    UT_NOMINAL(OS_QueuePutMultiple(queue_id, data_out, sizeof(uint32), sizes, 3, 0, &count));
+    UtAssert_UINT32_EQ(count, 3);
+
+    memset(data_in, 0, sizeof(data_in));
+    UT_NOMINAL(OS_QueueGetMultiple(queue_id, data_in, sizeof(uint32), sizes, 5, &count, OS_CHECK));
+    UtAssert_UINT32_EQ(count, 3);
+    UtAssert_MemCmp(data_in, data_out, 3 * sizeof(uint32), "Messages received in order");
+
+    /*-----------------------------------------------------*/
+    /* #5 Queue-full, only as many messages as fit are put */
+
+    for (i = 0; i < 12; ++i)
+    {
+        sizes[i] = sizeof(uint32);
+    }
+
+    UT_RETVAL(OS_QueuePutMultiple(queue_id, data_out, sizeof(uint32), sizes, 12, 0, &count), OS_QUEUE_FULL);
+    UtAssert_UINT32_EQ(count, 10);
+
+    memset(data_in, 0, sizeof(data_in));
+    UT_NOMINAL(OS_QueueGetMultiple(queue_id, data_in, sizeof(uint32), sizes, 12, &count, 100));
+    UtAssert_UINT32_EQ(count, 10);
+    UtAssert_MemCmp(data_in, data_out, 10 * sizeof(uint32), "Messages received in order");
+
+    UT_TEARDOWN(OS_QueueDelete(queue_id));
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueuePut, OS_QueueGetWithPriority
+** Purpose: Sends messages of different priorities and receives them in priority order
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in does not exist
+**          OS_ERR_INVALID_ARGUMENT if the priority is not valid
+**          OS_QUEUE_EMPTY if the queue has no messages
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_priority_test(void)
+{
+    static const struct
+    {
+        uint32 data;
+        uint32 priority;
+    } messages[] = {{0x000, 0}, {0x001, 0}, {0x300, 3}, {0x700, OS_QUEUE_PRIORITY_LEVELS - 1}, {0x301, 3}};
+    static const uint32 expected[] = {0x700, 0x300, 0x301, 0x000, 0x001};
+
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    uint32    data_in  = 0;
+    uint32    priority = 0;
+    size_t    size_copied;
+    uint32    i;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_QueueGetWithPriority(UT_OBJID_INCORRECT, &data_in, sizeof(data_in), &size_copied, &priority, OS_CHECK),
+              OS_ERR_INVALID_ID);
+
+    if (!UT_SETUP(OS_QueueCreate(&queue_id, "QueuePriority", OSAL_BLOCKCOUNT_C(5), sizeof(uint32), 0)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-pointer-arg and invalid priority */
+
+    UT_RETVAL(OS_QueueGetWithPriority(queue_id, &data_in, sizeof(data_in), &size_copied, NULL, OS_CHECK),
+              OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueuePut(queue_id, &data_in, sizeof(data_in), OS_QUEUE_PRIORITY(OS_QUEUE_PRIORITY_LEVELS)),
+              OS_ERR_INVALID_ARGUMENT);
+
+    /*-----------------------------------------------------*/
+    /* #3 Queue-empty */
+
+    UT_RETVAL(OS_QueueGetWithPriority(queue_id, &data_in, sizeof(data_in), &size_copied, &priority, OS_CHECK),
+              OS_QUEUE_EMPTY);
+
+    /*-----------------------------------------------------*/
+    /* #4 Nominal, higher priorities first and in order within each priority */
+
+    for (i = 0; i < sizeof(messages) / sizeof(messages[0]); ++i)
+    {
+        UT_NOMINAL(
+            OS_QueuePut(queue_id, &messages[i].data, sizeof(uint32), OS_QUEUE_PRIORITY(messages[i].priority)));
+    }
+
+    /* the depth applies to all priorities together */
+    UT_RETVAL(OS_QueuePut(queue_id, &data_in, sizeof(data_in), OS_QUEUE_PRIORITY(1)), OS_QUEUE_FULL);
+
+    for (i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i)
+    {
+        UT_NOMINAL(OS_QueueGetWithPriority(queue_id, &data_in, sizeof(data_in), &size_copied, &priority, OS_CHECK));
+        UtAssert_UINT32_EQ(data_in, expected[i]);
+        UtAssert_UINT32_EQ(priority, expected[i] >> 8);
+    }
+
+    UT_TEARDOWN(OS_QueueDelete(queue_id));
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueuePutTimed, OS_QueuePutAbs
+** Purpose: Sends data on an existing queue, waiting for space if it is full
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in does not exist
+**          OS_QUEUE_INVALID_SIZE if the message is too large for the queue
+**          OS_QUEUE_FULL if the queue is full and the call does not wait
+**          OS_QUEUE_TIMEOUT if the queue remained full until the timeout
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+static osal_id_t UT_os_queue_put_timed_id;
+
+static void UT_os_queue_put_timed_consumer(void)
+{
+    uint32 data;
+    size_t size_copied;
+
+    /* let the producer block on the full queue, then make space for it */
+    OS_TaskDelay(50);
+    OS_QueueGet(UT_os_queue_put_timed_id, &data, sizeof(data), &size_copied, OS_CHECK);
+}
+
+void UT_os_queue_put_timed_test(void)
+{
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t task_id  = OS_OBJECT_ID_UNDEFINED;
+    uint32    data_out = 0x11223344;
+    uint32    data_in  = 0;
+    size_t    size_copied;
+    OS_time_t now;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_QueuePutTimed(UT_OBJID_INCORRECT, &data_out, sizeof(data_out), 0, OS_CHECK), OS_ERR_INVALID_ID);
+
+    if (!UT_SETUP(OS_QueueCreate(&queue_id, "QueuePutTimed", OSAL_BLOCKCOUNT_C(2), sizeof(uint32), 0)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-pointer-arg and invalid size */
+
+    UT_RETVAL(OS_QueuePutTimed(queue_id, NULL, sizeof(data_out), 0, OS_CHECK), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueuePutTimed(queue_id, &data_out, sizeof(data_out) + 1, 0, OS_CHECK), OS_QUEUE_INVALID_SIZE);
+
+    /*-----------------------------------------------------*/
+    /* #3 Queue-full, with and without waiting */
+
+    UT_NOMINAL(OS_QueuePutTimed(queue_id, &data_out, sizeof(data_out), 0, OS_CHECK));
+    UT_NOMINAL(OS_QueuePutTimed(queue_id, &data_out, sizeof(data_out), 0, 10));
+
+    UT_RETVAL(OS_QueuePutTimed(queue_id, &data_out, sizeof(data_out), 0, OS_CHECK), OS_QUEUE_FULL);
+    UT_RETVAL(OS_QueuePutTimed(queue_id, &data_out, sizeof(data_out), 0, 20), OS_QUEUE_TIMEOUT);
+
+    UT_NOMINAL(OS_GetLocalTime(&now));
+    UT_RETVAL(OS_QueuePutAbs(queue_id, &data_out, sizeof(data_out), 0,
+                             OS_TimeAdd(now, OS_TimeFromTotalMilliseconds(20))),
+              OS_QUEUE_TIMEOUT);
+    UT_RETVAL(OS_QueuePutAbs(queue_id, &data_out, sizeof(data_out), 0, now), OS_QUEUE_FULL);
+
+    /*-----------------------------------------------------*/
+    /* #4 Nominal, a waiting producer continues once a message is received */
+
+    UT_os_queue_put_timed_id = queue_id;
+    if (UT_SETUP(OS_TaskCreate(&task_id, "QueuePutTimed", UT_os_queue_put_timed_consumer, OSAL_TASK_STACK_ALLOCATE,
+                               OSAL_SIZE_C(4096), OSAL_PRIORITY_C(100), 0)))
+    {
+        data_out = 0x55667788;
+        UT_NOMINAL(OS_QueuePutTimed(queue_id, &data_out, sizeof(data_out), 0, 1000));
+
+        /* allow the consumer to exit */
+        OS_TaskDelay(50);
+
+        UT_NOMINAL(OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+        UT_NOMINAL(OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+        UtAssert_UINT32_EQ(data_in, 0x55667788);
+    }
+
+    UT_TEARDOWN(OS_QueueDelete(queue_id));
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueReserve, OS_QueueCommit, OS_QueueGetRef, OS_QueueRelease
+** Purpose: Sends and receives data on an existing queue without copying it
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is null or not an outstanding queue entry
+**          OS_ERR_INVALID_ARGUMENT if a priority is given on commit
+**          OS_ERR_INVALID_ID if the id passed in does not exist
+**          OS_QUEUE_INVALID_SIZE if the message is too large for the queue
+**          OS_QUEUE_FULL if the queue could not accept another message
+**          OS_QUEUE_EMPTY if the queue has no messages
+**          OS_ERR_NOT_IMPLEMENTED if the queue storage is not accessible
+**          OS_ERR_INCORRECT_OBJ_STATE if the queue is deleted with entries handed out
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_zero_copy_test(void)
+{
+    osal_id_t   queue_id = OS_OBJECT_ID_UNDEFINED;
+    void *      put_ptr[3];
+    const void *get_ptr  = NULL;
+    size_t      data_size = 0;
+    uint32      value;
+    int         i;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_QueueReserve(UT_OBJID_INCORRECT, &put_ptr[0], sizeof(uint32)), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueGetRef(UT_OBJID_INCORRECT, &get_ptr, &data_size, OS_CHECK), OS_ERR_INVALID_ID);
+
+    if (!UT_SETUP(OS_QueueCreate(&queue_id, "QueueZeroCopy", OSAL_BLOCKCOUNT_C(2), sizeof(uint32),
+                                 OS_QUEUE_FLAG_LOCAL)))
+    {
+        return;
+    }
+
+    if (UT_IMPL(OS_QueueReserve(queue_id, &put_ptr[0], sizeof(uint32))))
+    {
+        /*-----------------------------------------------------*/
+        /* #2 Invalid-pointer-arg and invalid size */
+
+        UT_RETVAL(OS_QueueReserve(queue_id, NULL, sizeof(uint32)), OS_INVALID_POINTER);
+        UT_RETVAL(OS_QueueReserve(queue_id, &put_ptr[1], sizeof(uint32) + 1), OS_QUEUE_INVALID_SIZE);
+        UT_RETVAL(OS_QueueCommit(queue_id, put_ptr[0], sizeof(uint32) + 1, 0), OS_QUEUE_INVALID_SIZE);
+        UT_RETVAL(OS_QueueCommit(queue_id, &value, sizeof(uint32), 0), OS_INVALID_POINTER);
+        UT_RETVAL(OS_QueueGetRef(queue_id, NULL, &data_size, OS_CHECK), OS_INVALID_POINTER);
+        UT_RETVAL(OS_QueueRelease(queue_id, NULL), OS_INVALID_POINTER);
+
+        /*-----------------------------------------------------*/
+        /* #3 Queue-full and queue-empty, while entries are reserved */
+
+        UT_NOMINAL(OS_QueueReserve(queue_id, &put_ptr[1], sizeof(uint32)));
+        UT_RETVAL(OS_QueueReserve(queue_id, &put_ptr[2], sizeof(uint32)), OS_QUEUE_FULL);
+        UT_RETVAL(OS_QueueGetRef(queue_id, &get_ptr, &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+
+        /*-----------------------------------------------------*/
+        /* #4 Nominal, messages are received in the order reserved */
+
+        for (i = 0; i < 2; ++i)
+        {
+            value = 0x11223344 + i;
+            memcpy(put_ptr[i], &value, sizeof(value));
+            UT_NOMINAL(OS_QueueCommit(queue_id, put_ptr[i], sizeof(uint32), 0));
+        }
+
+        for (i = 0; i < 2; ++i)
+        {
+            if (UT_NOMINAL(OS_QueueGetRef(queue_id, &get_ptr, &data_size, OS_CHECK)))
+            {
+                UtAssert_ADDRESS_EQ(get_ptr, put_ptr[i]);
+                UtAssert_EQ(size_t, data_size, sizeof(uint32));
+                memcpy(&value, get_ptr, sizeof(value));
+                UtAssert_UINT32_EQ(value, 0x11223344 + i);
+                UT_NOMINAL(OS_QueueRelease(queue_id, get_ptr));
+            }
+        }
+
+        /* A copied message can be received in place, and the reverse */
+        value = 0x55667788;
+        UT_NOMINAL(OS_QueuePut(queue_id, &value, sizeof(value), 0));
+        if (UT_NOMINAL(OS_QueueGetRef(queue_id, &get_ptr, &data_size, OS_CHECK)))
+        {
+            UtAssert_UINT32_EQ(*(const uint32 *)get_ptr, 0x55667788);
+            UT_NOMINAL(OS_QueueRelease(queue_id, get_ptr));
+        }
+
+        if (UT_NOMINAL(OS_QueueReserve(queue_id, &put_ptr[0], sizeof(uint32))))
+        {
+            *(uint32 *)put_ptr[0] = 0x99AABBCC;
+            UT_NOMINAL(OS_QueueCommit(queue_id, put_ptr[0], sizeof(uint32), 0));
+            UT_NOMINAL(OS_QueueGet(queue_id, &value, sizeof(value), &data_size, OS_CHECK));
+            UtAssert_UINT32_EQ(value, 0x99AABBCC);
+        }
+
+        /*-----------------------------------------------------*/
+        /* #5 Each entry can only be committed or released once, and only in the right state */
+
+        if (UT_NOMINAL(OS_QueueReserve(queue_id, &put_ptr[0], sizeof(uint32))))
+        {
+            UT_RETVAL(OS_QueueRelease(queue_id, put_ptr[0]), OS_INVALID_POINTER);
+            UT_RETVAL(OS_QueueCommit(queue_id, put_ptr[0], sizeof(uint32), OS_QUEUE_PRIORITY(1)),
+                      OS_ERR_INVALID_ARGUMENT);
+            UT_NOMINAL(OS_QueueCommit(queue_id, put_ptr[0], sizeof(uint32), 0));
+            UT_RETVAL(OS_QueueCommit(queue_id, put_ptr[0], sizeof(uint32), 0), OS_INVALID_POINTER);
+        }
+
+        if (UT_NOMINAL(OS_QueueGetRef(queue_id, &get_ptr, &data_size, OS_CHECK)))
+        {
+            UT_RETVAL(OS_QueueCommit(queue_id, (void *)get_ptr, sizeof(uint32), 0), OS_INVALID_POINTER);
+            UT_NOMINAL(OS_QueueRelease(queue_id, get_ptr));
+            UT_RETVAL(OS_QueueRelease(queue_id, get_ptr), OS_INVALID_POINTER);
+        }
+
+        /* The queue still holds exactly its depth */
+        value = 0;
+        UT_NOMINAL(OS_QueuePut(queue_id, &value, sizeof(value), 0));
+        UT_NOMINAL(OS_QueuePut(queue_id, &value, sizeof(value), 0));
+        UT_RETVAL(OS_QueuePut(queue_id, &value, sizeof(value), 0), OS_QUEUE_FULL);
+        UT_NOMINAL(OS_QueueGet(queue_id, &value, sizeof(value), &data_size, OS_CHECK));
+        UT_NOMINAL(OS_QueueGet(queue_id, &value, sizeof(value), &data_size, OS_CHECK));
+        UT_RETVAL(OS_QueueGet(queue_id, &value, sizeof(value), &data_size, OS_CHECK), OS_QUEUE_EMPTY);
+
+        /*-----------------------------------------------------*/
+        /* #6 The queue cannot be deleted while an entry is reserved or referenced */
+
+        if (UT_NOMINAL(OS_QueueReserve(queue_id, &put_ptr[0], sizeof(uint32))))
+        {
+            UT_RETVAL(OS_QueueDelete(queue_id), OS_ERR_INCORRECT_OBJ_STATE);
+            UT_NOMINAL(OS_QueueCommit(queue_id, put_ptr[0], sizeof(uint32), 0));
+        }
+
+        if (UT_NOMINAL(OS_QueueGetRef(queue_id, &get_ptr, &data_size, OS_CHECK)))
+        {
+            UT_RETVAL(OS_QueueDelete(queue_id), OS_ERR_INCORRECT_OBJ_STATE);
+            UT_NOMINAL(OS_QueueRelease(queue_id, get_ptr));
+        }
+    }
+
+    UT_TEARDOWN(OS_QueueDelete(queue_id));
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueCreate with OS_QUEUE_FLAG_SPSC
+** Purpose: Passes messages through a queue with a single producer and consumer
+** Parameters: To-be-filled-in
+** Returns: OS_QUEUE_FULL if the queue could not accept another message
+**          OS_QUEUE_EMPTY if the queue has no messages
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+#define UT_OS_QUEUE_SPSC_COUNT 1000
+
+static osal_id_t UT_os_queue_spsc_id;
+
+static void UT_os_queue_spsc_producer(void)
+{
+    uint32 data;
+
+    /* the consumer must be woken when it runs out of messages */
+    for (data = 0; data < UT_OS_QUEUE_SPSC_COUNT; ++data)
+    {
+        if (OS_QueuePutTimed(UT_os_queue_spsc_id, &data, sizeof(data), 0, OS_PEND) != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+}
+
+void UT_os_queue_spsc_test(void)
+{
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t task_id  = OS_OBJECT_ID_UNDEFINED;
+    uint32    data_out = 0;
+    uint32    data_in  = 0;
+    uint32    priority = 0;
+    size_t    size_copied;
+    uint32    i;
+
+    if (!UT_SETUP(OS_QueueCreate(&queue_id, "QueueSPSC", OSAL_BLOCKCOUNT_C(3), sizeof(uint32), OS_QUEUE_FLAG_SPSC)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #1 Queue-empty and queue-full */
+
+    UT_RETVAL(OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK), OS_QUEUE_EMPTY);
+
+    for (i = 0; i < 3; ++i)
+    {
+        data_out = i;
+        UT_NOMINAL(OS_QueuePut(queue_id, &data_out, sizeof(data_out), OS_QUEUE_PRIORITY(i)));
+    }
+    UT_RETVAL(OS_QueuePut(queue_id, &data_out, sizeof(data_out), 0), OS_QUEUE_FULL);
+
+    /*-----------------------------------------------------*/
+    /* #2 Nominal, messages are received in order, regardless of priority where that is ignored */
+
+    UT_NOMINAL(OS_QueueGetWithPriority(queue_id, &data_in, sizeof(data_in), &size_copied, &priority, OS_CHECK));
+    if (priority == 0)
+    {
+        UtAssert_UINT32_EQ(data_in, 0);
+        UT_NOMINAL(OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+        UtAssert_UINT32_EQ(data_in, 1);
+        UT_NOMINAL(OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+        UtAssert_UINT32_EQ(data_in, 2);
+    }
+    else
+    {
+        UT_NOMINAL(OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+        UT_NOMINAL(OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+    }
+
+    UT_RETVAL(OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK), OS_QUEUE_EMPTY);
+
+    /*-----------------------------------------------------*/
+    /* #3 Nominal, messages from a concurrent producer task */
+
+    UT_os_queue_spsc_id = queue_id;
+    if (UT_SETUP(OS_TaskCreate(&task_id, "QueueSPSC", UT_os_queue_spsc_producer, OSAL_TASK_STACK_ALLOCATE,
+                               OSAL_SIZE_C(4096), OSAL_PRIORITY_C(100), 0)))
+    {
+        for (i = 0; i < UT_OS_QUEUE_SPSC_COUNT; ++i)
+        {
+            if (OS_QueueGet(queue_id, &data_in, sizeof(data_in), &size_copied, 1000) != OS_SUCCESS ||
+                data_in != i)
+            {
+                break;
+            }
+        }
+
+        UtAssert_UINT32_EQ(i, UT_OS_QUEUE_SPSC_COUNT);
+
+        /* allow the producer to exit */
+        OS_TaskDelay(50);
+    }
+
+    UT_TEARDOWN(OS_QueueDelete(queue_id));
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueCreatePacked
+** Purpose: Passes messages of varying sizes through a queue with a byte budget
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the id pointer passed in is null
+**          OS_ERR_INVALID_SIZE if the maximum message size is zero
+**          OS_QUEUE_INVALID_SIZE if the budget is smaller than the maximum message size
+**          OS_QUEUE_FULL if the queue could not accept another message
+**          OS_QUEUE_EMPTY if the queue has no messages
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+#define UT_OS_QUEUE_PACKED_BUDGET   4096
+#define UT_OS_QUEUE_PACKED_MAX_SIZE 1024
+#define UT_OS_QUEUE_PACKED_COUNT    200
+
+/* Gives a size between 1 and the maximum which varies from one message to the next */
+#define UT_OS_QUEUE_PACKED_SIZE(i) (((i)*397 % UT_OS_QUEUE_PACKED_MAX_SIZE) + 1)
+
+static uint8 UT_os_queue_packed_buf[UT_OS_QUEUE_PACKED_MAX_SIZE];
+
+static bool UT_os_queue_packed_check(osal_id_t queue_id, uint32 i)
+{
+    size_t size_copied = 0;
+    uint32 j;
+
+    memset(UT_os_queue_packed_buf, 0, sizeof(UT_os_queue_packed_buf));
+    if (OS_QueueGet(queue_id, UT_os_queue_packed_buf, sizeof(UT_os_queue_packed_buf), &size_copied, OS_CHECK) !=
+            OS_SUCCESS ||
+        size_copied != UT_OS_QUEUE_PACKED_SIZE(i))
+    {
+        return false;
+    }
+
+    for (j = 0; j < size_copied; ++j)
+    {
+        if (UT_os_queue_packed_buf[j] != (uint8)i)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void UT_os_queue_create_packed_test(void)
+{
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    uint32    data_out = 0;
+    uint32    data_in  = 0;
+    size_t    size_copied;
+    uint32    count;
+    uint32    next_get;
+    uint32    i;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid arguments */
+
+    UT_RETVAL(OS_QueueCreatePacked(NULL, "QueuePacked", UT_OS_QUEUE_PACKED_BUDGET, UT_OS_QUEUE_PACKED_MAX_SIZE, 0),
+              OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueCreatePacked(&queue_id, "QueuePacked", UT_OS_QUEUE_PACKED_BUDGET, 0, 0), OS_ERR_INVALID_SIZE);
+    UT_RETVAL(OS_QueueCreatePacked(&queue_id, "QueuePacked", UT_OS_QUEUE_PACKED_MAX_SIZE - 1,
+                                   UT_OS_QUEUE_PACKED_MAX_SIZE, 0),
+              OS_QUEUE_INVALID_SIZE);
+
+    if (!UT_SETUP(OS_QueueCreatePacked(&queue_id, "QueuePacked", UT_OS_QUEUE_PACKED_BUDGET,
+                                       UT_OS_QUEUE_PACKED_MAX_SIZE, 0)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Small messages, at least as many as fit in fixed size entries */
+
+    UT_RETVAL(OS_QueueGet(queue_id, UT_os_queue_packed_buf, sizeof(UT_os_queue_packed_buf), &size_copied, OS_CHECK),
+              OS_QUEUE_EMPTY);
+
+    count = 0;
+    while (OS_QueuePut(queue_id, &count, sizeof(count), 0) == OS_SUCCESS)
+    {
+        ++count;
+    }
+    UtAssert_True(count >= UT_OS_QUEUE_PACKED_BUDGET / UT_OS_QUEUE_PACKED_MAX_SIZE, "%lu messages fit in the queue",
+                  (unsigned long)count);
+    UT_RETVAL(OS_QueuePut(queue_id, &data_out, sizeof(data_out), 0), OS_QUEUE_FULL);
+
+    /* the buffer must always be large enough for a message of the maximum size */
+    for (i = 0; i < count; ++i)
+    {
+        if (OS_QueueGet(queue_id, UT_os_queue_packed_buf, sizeof(UT_os_queue_packed_buf), &size_copied, OS_CHECK) !=
+                OS_SUCCESS ||
+            size_copied != sizeof(data_in))
+        {
+            break;
+        }
+        memcpy(&data_in, UT_os_queue_packed_buf, sizeof(data_in));
+        if (data_in != i)
+        {
+            break;
+        }
+    }
+    UtAssert_UINT32_EQ(i, count);
+
+    UT_RETVAL(OS_QueueGet(queue_id, UT_os_queue_packed_buf, sizeof(UT_os_queue_packed_buf), &size_copied, OS_CHECK),
+              OS_QUEUE_EMPTY);
+
+    /*-----------------------------------------------------*/
+    /* #3 Messages of varying sizes, removing the oldest whenever the queue is full */
+
+    next_get = 0;
+    for (i = 0; i < UT_OS_QUEUE_PACKED_COUNT; ++i)
+    {
+        memset(UT_os_queue_packed_buf, (uint8)i, UT_OS_QUEUE_PACKED_SIZE(i));
+        while (OS_QueuePut(queue_id, UT_os_queue_packed_buf, UT_OS_QUEUE_PACKED_SIZE(i), 0) == OS_QUEUE_FULL &&
+               next_get < i && UT_os_queue_packed_check(queue_id, next_get))
+        {
+            ++next_get;
+            memset(UT_os_queue_packed_buf, (uint8)i, UT_OS_QUEUE_PACKED_SIZE(i));
+        }
+    }
+
+    while (next_get < UT_OS_QUEUE_PACKED_COUNT && UT_os_queue_packed_check(queue_id, next_get))
+    {
+        ++next_get;
+    }
+    UtAssert_UINT32_EQ(next_get, UT_OS_QUEUE_PACKED_COUNT);
+
+    UT_RETVAL(OS_QueueGet(queue_id, UT_os_queue_packed_buf, sizeof(UT_os_queue_packed_buf), &size_copied, OS_CHECK),
+              OS_QUEUE_EMPTY);
+
+    /*-----------------------------------------------------*/
+    /* #4 A message of the maximum size fits once drained, but not a larger one */
+
+    UT_NOMINAL(OS_QueuePut(queue_id, UT_os_queue_packed_buf, UT_OS_QUEUE_PACKED_MAX_SIZE, 0));
+    UT_RETVAL(OS_QueuePut(queue_id, UT_os_queue_packed_buf, UT_OS_QUEUE_PACKED_MAX_SIZE + 1, 0),
+              OS_QUEUE_INVALID_SIZE);
+
+    UT_TEARDOWN(OS_QueueDelete(queue_id));
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueSubscribe
+** Purpose: Delivers every message put on a broadcast queue to each of its subscribers
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_INCORRECT_OBJ_TYPE if the queue is not a broadcast queue
+**          OS_ERR_OPERATION_NOT_SUPPORTED if the operation does not apply to the queue
+**          OS_ERR_OBJECT_IN_USE if a broadcast queue is deleted while subscribed
+**          OS_ERR_NOT_IMPLEMENTED if broadcast queues are not supported
+**          OS_QUEUE_FULL if a subscriber could not accept another message
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+#define UT_OS_QUEUE_BCAST_DEPTH 4
+
+void UT_os_queue_broadcast_test(void)
+{
+    osal_id_t bcast_id    = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t plain_id    = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t block_id    = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t drop_id     = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t sub_id      = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t task_id     = OS_OBJECT_ID_UNDEFINED;
+    uint32    data_out    = 0;
+    uint32    data_in     = 0;
+    size_t    size_copied = 0;
+    uint32    i;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid arguments */
+
+    UT_RETVAL(OS_QueueSubscribe(NULL, "QueueSub", UT_OBJID_INCORRECT, 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueSubscribe(&sub_id, NULL, UT_OBJID_INCORRECT, 0), OS_INVALID_POINTER);
+    UT_RETVAL(OS_QueueSubscribe(&sub_id, "QueueSub", UT_OBJID_INCORRECT, 0), OS_ERR_INVALID_ID);
+
+    if (!UT_SETUP(OS_QueueCreate(&bcast_id, "QueueBcast", OSAL_BLOCKCOUNT_C(UT_OS_QUEUE_BCAST_DEPTH),
+                                 sizeof(uint32), OS_QUEUE_FLAG_BROADCAST)))
+    {
+        return;
+    }
+
+    if (UT_IMPL(OS_QueueSubscribe(&block_id, "QueueSubBlock", bcast_id, 0)))
+    {
+        UT_NOMINAL(OS_QueueSubscribe(&drop_id, "QueueSubDrop", bcast_id, OS_QUEUE_FLAG_DROP_OLDEST));
+
+        /* Only a broadcast queue can be subscribed to */
+        if (UT_SETUP(OS_QueueCreate(&plain_id, "QueuePlain", OSAL_BLOCKCOUNT_C(UT_OS_QUEUE_BCAST_DEPTH),
+                                    sizeof(uint32), 0)))
+        {
+            UT_RETVAL(OS_QueueSubscribe(&sub_id, "QueueSub", plain_id, 0), OS_ERR_INCORRECT_OBJ_TYPE);
+            UT_TEARDOWN(OS_QueueDelete(plain_id));
+        }
+
+        /*-----------------------------------------------------*/
+        /* #2 Messages flow from the broadcast queue to the subscribers only */
+
+        UT_RETVAL(OS_QueueGet(bcast_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK),
+                  OS_ERR_OPERATION_NOT_SUPPORTED);
+        UT_RETVAL(OS_QueuePut(block_id, &data_out, sizeof(data_out), 0), OS_ERR_OPERATION_NOT_SUPPORTED);
+        UT_RETVAL(OS_QueueDelete(bcast_id), OS_ERR_OBJECT_IN_USE);
+
+        /*-----------------------------------------------------*/
+        /* #3 A blocking subscriber holds back the producer, and every subscriber receives each message */
+
+        for (data_out = 0; data_out < UT_OS_QUEUE_BCAST_DEPTH; ++data_out)
+        {
+            UT_NOMINAL(OS_QueuePut(bcast_id, &data_out, sizeof(data_out), 0));
+        }
+        UT_RETVAL(OS_QueuePut(bcast_id, &data_out, sizeof(data_out), 0), OS_QUEUE_FULL);
+
+        for (i = 0; i < UT_OS_QUEUE_BCAST_DEPTH; ++i)
+        {
+            UT_NOMINAL(OS_QueueGet(block_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+            UtAssert_UINT32_EQ(data_in, i);
+            UT_NOMINAL(OS_QueueGet(drop_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+            UtAssert_UINT32_EQ(data_in, i);
+        }
+        UT_RETVAL(OS_QueueGet(block_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK), OS_QUEUE_EMPTY);
+        UT_RETVAL(OS_QueueGet(drop_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK), OS_QUEUE_EMPTY);
+
+        /*-----------------------------------------------------*/
+        /* #4 A lagging drop-oldest subscriber loses its oldest messages instead */
+
+        UT_TEARDOWN(OS_QueueDelete(block_id));
+
+        for (data_out = 0; data_out < 2 * UT_OS_QUEUE_BCAST_DEPTH; ++data_out)
+        {
+            UT_NOMINAL(OS_QueuePut(bcast_id, &data_out, sizeof(data_out), 0));
+        }
+
+        for (i = UT_OS_QUEUE_BCAST_DEPTH; i < 2 * UT_OS_QUEUE_BCAST_DEPTH; ++i)
+        {
+            UT_NOMINAL(OS_QueueGet(drop_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK));
+            UtAssert_UINT32_EQ(data_in, i);
+        }
+        UT_RETVAL(OS_QueueGet(drop_id, &data_in, sizeof(data_in), &size_copied, OS_CHECK), OS_QUEUE_EMPTY);
+
+        UT_TEARDOWN(OS_QueueDelete(drop_id));
+
+        /*-----------------------------------------------------*/
+        /* #5 A task blocked on a subscriber is woken when the subscriber is deleted */
+
+        if (UT_SETUP(OS_QueueSubscribe(&sub_id, "QueueSub", bcast_id, 0)))
+        {
+            UT_os_queue_delete_id     = sub_id;
+            UT_os_queue_delete_status = OS_SUCCESS;
+            UT_os_queue_delete_done   = false;
+            if (UT_SETUP(OS_TaskCreate(&task_id, "QueueSubReader", UT_os_queue_delete_reader,
+                                       OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096), OSAL_PRIORITY_C(100), 0)))
+            {
+                /* let the reader block on the subscriber */
+                OS_TaskDelay(50);
+
+                /* the broadcast queue is held by the subscriber, and refusing to delete it leaves the reader waiting */
+                UT_RETVAL(OS_QueueDelete(bcast_id), OS_ERR_OBJECT_IN_USE);
+                UT_NOMINAL(OS_QueueSubscribe(&drop_id, "QueueSubDrop", bcast_id, 0));
+                UtAssert_True(!UT_os_queue_delete_done, "Reader not woken by delete of broadcast queue");
+                UT_TEARDOWN(OS_QueueDelete(drop_id));
+
+                UT_NOMINAL(OS_QueueDelete(sub_id));
+
+                /* allow the reader to exit */
+                OS_TaskDelay(50);
+                UtAssert_True(UT_os_queue_delete_done, "Reader woken by delete of subscriber");
+                UtAssert_INT32_EQ(UT_os_queue_delete_status, OS_ERR_INVALID_ID);
+            }
+            else
+            {
+                UT_TEARDOWN(OS_QueueDelete(sub_id));
+            }
+        }
+    }
+
+    UT_TEARDOWN(OS_QueueDelete(bcast_id));
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_QueueGetIdByName
 ** Purpose: Returns the queue id of a given queue name
@@ -439,6 +1344,87 @@ void UT_os_queue_get_info_test(void)
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueGetStats, OS_QueueResetStats
+** Purpose: Returns occupancy and latency statistics about the given queue id
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in does not exist
+**          OS_ERR_NOT_IMPLEMENTED if queue statistics are not enabled
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_get_stats_test(void)
+{
+    osal_id_t        queue_id = OS_OBJECT_ID_UNDEFINED;
+    OS_queue_stats_t stats;
+    uint32           data     = 0;
+    uint32           received = 0;
+    size_t           size_copied;
+    uint32           i;
+
+    /*-----------------------------------------------------*/
+    /* #1 Not-implemented */
+
+    if (!UT_IMPL(OS_QueueGetStats(UT_OBJID_INCORRECT, &stats)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-ID-arg */
+
+    UT_RETVAL(OS_QueueGetStats(UT_OBJID_INCORRECT, &stats), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueResetStats(UT_OBJID_INCORRECT), OS_ERR_INVALID_ID);
+
+    if (!UT_SETUP(OS_QueueCreate(&queue_id, "QueueStats", OSAL_BLOCKCOUNT_C(3), sizeof(uint32), 0)))
+    {
+        return;
+    }
+
+    /*-----------------------------------------------------*/
+    /* #3 Invalid-pointer-arg */
+
+    UT_RETVAL(OS_QueueGetStats(queue_id, NULL), OS_INVALID_POINTER);
+
+    /*-----------------------------------------------------*/
+    /* #4 Nominal, fill the queue then receive one message */
+
+    for (i = 0; i < 3; ++i)
+    {
+        UT_NOMINAL(OS_QueuePut(queue_id, &data, sizeof(data), 0));
+    }
+    UT_RETVAL(OS_QueuePut(queue_id, &data, sizeof(data), 0), OS_QUEUE_FULL);
+    UT_NOMINAL(OS_QueueGet(queue_id, &data, sizeof(data), &size_copied, OS_CHECK));
+
+    UT_NOMINAL(OS_QueueGetStats(queue_id, &stats));
+    UtAssert_UINT32_EQ(stats.put_count, 3);
+    UtAssert_UINT32_EQ(stats.get_count, 1);
+    UtAssert_UINT32_EQ(stats.full_count, 1);
+    UtAssert_UINT32_EQ(stats.depth, 2);
+    UtAssert_UINT32_EQ(stats.high_water_mark, 3);
+
+    /* latency is not measured by all implementations, but is never counted more than once */
+    for (i = 0; i < OS_QUEUE_LATENCY_BUCKETS; ++i)
+    {
+        received += stats.latency_histogram[i];
+    }
+    UtAssert_True(received <= stats.get_count, "latency samples (%u) <= get_count (%u)", (unsigned int)received,
+                  (unsigned int)stats.get_count);
+
+    /*-----------------------------------------------------*/
+    /* #5 Nominal, reset keeps the depth */
+
+    UT_NOMINAL(OS_QueueResetStats(queue_id));
+    UT_NOMINAL(OS_QueueGetStats(queue_id, &stats));
+    UtAssert_ZERO(stats.put_count);
+    UtAssert_ZERO(stats.get_count);
+    UtAssert_ZERO(stats.full_count);
+    UtAssert_UINT32_EQ(stats.depth, 2);
+    UtAssert_UINT32_EQ(stats.high_water_mark, 2);
+
+    UT_TEARDOWN(OS_QueueDelete(queue_id));
+}
+
 /*================================================================================*
 ** End of File: ut_oscore_queue_test.c
 **================================================================================*/
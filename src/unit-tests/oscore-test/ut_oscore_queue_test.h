@@ -54,10 +54,20 @@
 
 void UT_os_queue_create_test(void);
 void UT_os_queue_delete_test(void);
+void UT_os_queue_create_packed_test(void);
+void UT_os_queue_create_batch_test(void);
+void UT_os_queue_delete_batch_test(void);
 void UT_os_queue_put_test(void);
 void UT_os_queue_get_test(void);
+void UT_os_queue_multiple_test(void);
+void UT_os_queue_priority_test(void);
+void UT_os_queue_put_timed_test(void);
+void UT_os_queue_zero_copy_test(void);
+void UT_os_queue_spsc_test(void);
+void UT_os_queue_broadcast_test(void);
 void UT_os_queue_get_id_by_name_test(void);
 void UT_os_queue_get_info_test(void);
+void UT_os_queue_get_stats_test(void);
 
 /*--------------------------------------------------------------------------------*/
 
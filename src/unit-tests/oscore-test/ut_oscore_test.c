@@ -198,6 +198,8 @@ void UtTest_Setup(void)
 
     UtTest_Add(UT_os_bin_sem_create_test, NULL, NULL, "OS_BinSemCreate");
     UtTest_Add(UT_os_bin_sem_delete_test, NULL, NULL, "OS_BinSemDelete");
+    UtTest_Add(UT_os_bin_sem_create_batch_test, NULL, NULL, "OS_BinSemCreateBatch");
+    UtTest_Add(UT_os_bin_sem_delete_batch_test, NULL, NULL, "OS_BinSemDeleteBatch");
     UtTest_Add(UT_os_bin_sem_flush_test, NULL, NULL, "OS_BinSemFlush");
     UtTest_Add(UT_os_bin_sem_give_test, NULL, NULL, "OS_BinSemGive");
     UtTest_Add(UT_os_bin_sem_take_test, NULL, NULL, "OS_BinSemTake");
@@ -209,6 +211,7 @@ void UtTest_Setup(void)
     UtTest_Add(UT_os_count_sem_give_test, NULL, NULL, "OS_CountSemGive");
     UtTest_Add(UT_os_count_sem_take_test, NULL, NULL, "OS_CountSemTake");
     UtTest_Add(UT_os_count_sem_timed_wait_test, NULL, NULL, "OS_CountSemTimedWait");
+    UtTest_Add(UT_os_count_sem_multi_test, NULL, NULL, "OS_CountSemGiveN");
     UtTest_Add(UT_os_count_sem_get_id_by_name_test, NULL, NULL, "OS_CountSemGetIdByName");
 
     UtTest_Add(UT_os_mut_sem_create_test, NULL, NULL, "OS_MutSemCreate");
@@ -217,13 +220,24 @@ void UtTest_Setup(void)
     UtTest_Add(UT_os_mut_sem_take_test, NULL, NULL, "OS_MutSemTake");
     UtTest_Add(UT_os_mut_sem_get_id_by_name_test, NULL, NULL, "OS_MutSemGetIdByName");
     UtTest_Add(UT_os_mut_sem_get_info_test, NULL, NULL, "OS_MutSemGetInfo");
+    UtTest_Add(UT_os_mut_sem_get_stats_test, NULL, NULL, "OS_MutSemGetStats");
 
     UtTest_Add(UT_os_queue_create_test, NULL, NULL, "OS_QueueCreate");
     UtTest_Add(UT_os_queue_delete_test, NULL, NULL, "OS_QueueDelete");
+    UtTest_Add(UT_os_queue_create_packed_test, NULL, NULL, "OS_QueueCreatePacked");
+    UtTest_Add(UT_os_queue_create_batch_test, NULL, NULL, "OS_QueueCreateBatch");
+    UtTest_Add(UT_os_queue_delete_batch_test, NULL, NULL, "OS_QueueDeleteBatch");
     UtTest_Add(UT_os_queue_put_test, NULL, NULL, "OS_QueuePut");
     UtTest_Add(UT_os_queue_get_test, NULL, NULL, "OS_QueueGet");
+    UtTest_Add(UT_os_queue_multiple_test, NULL, NULL, "OS_QueuePutMultiple/OS_QueueGetMultiple");
+    UtTest_Add(UT_os_queue_priority_test, NULL, NULL, "OS_QueueGetWithPriority");
+    UtTest_Add(UT_os_queue_put_timed_test, NULL, NULL, "OS_QueuePutTimed/OS_QueuePutAbs");
+    UtTest_Add(UT_os_queue_zero_copy_test, NULL, NULL, "OS_QueueReserve/OS_QueueGetRef");
+    UtTest_Add(UT_os_queue_spsc_test, NULL, NULL, "OS_QUEUE_FLAG_SPSC");
+    UtTest_Add(UT_os_queue_broadcast_test, NULL, NULL, "OS_QueueSubscribe");
     UtTest_Add(UT_os_queue_get_id_by_name_test, NULL, NULL, "OS_QueueGetIdByName");
     UtTest_Add(UT_os_queue_get_info_test, NULL, NULL, "OS_QueueGetInfo");
+    UtTest_Add(UT_os_queue_get_stats_test, NULL, NULL, "OS_QueueGetStats");
 
     UtTest_Add(UT_os_select_fd_test, UT_os_select_setup_file, UT_os_select_teardown_file, "OS_SelectFd");
     UtTest_Add(UT_os_select_single_test, UT_os_select_setup_file, UT_os_select_teardown_file, "OS_SelectSingle");
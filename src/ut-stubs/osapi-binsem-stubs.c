@@ -49,6 +49,27 @@ int32 OS_BinSemCreate(osal_id_t *sem_id, const char *sem_name, uint32 sem_initia
     return UT_GenStub_GetReturnValue(OS_BinSemCreate, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_BinSemCreateBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_BinSemCreateBatch(osal_id_t *sem_ids, const char *const *sem_names, uint32 count, uint32 sem_initial_value,
+                           uint32 options)
+{
+    UT_GenStub_SetupReturnBuffer(OS_BinSemCreateBatch, int32);
+
+    UT_GenStub_AddParam(OS_BinSemCreateBatch, osal_id_t *, sem_ids);
+    UT_GenStub_AddParam(OS_BinSemCreateBatch, const char *const *, sem_names);
+    UT_GenStub_AddParam(OS_BinSemCreateBatch, uint32, count);
+    UT_GenStub_AddParam(OS_BinSemCreateBatch, uint32, sem_initial_value);
+    UT_GenStub_AddParam(OS_BinSemCreateBatch, uint32, options);
+
+    UT_GenStub_Execute(OS_BinSemCreateBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_BinSemCreateBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_BinSemDelete()
@@ -65,6 +86,23 @@ int32 OS_BinSemDelete(osal_id_t sem_id)
     return UT_GenStub_GetReturnValue(OS_BinSemDelete, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_BinSemDeleteBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_BinSemDeleteBatch(const osal_id_t *sem_ids, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_BinSemDeleteBatch, int32);
+
+    UT_GenStub_AddParam(OS_BinSemDeleteBatch, const osal_id_t *, sem_ids);
+    UT_GenStub_AddParam(OS_BinSemDeleteBatch, uint32, count);
+
+    UT_GenStub_Execute(OS_BinSemDeleteBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_BinSemDeleteBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_BinSemFlush()
@@ -69,6 +69,22 @@ uint32 OS_BSP_GetResourceTypeConfig(uint32 ResourceType)
     return UT_GenStub_GetReturnValue(OS_BSP_GetResourceTypeConfig, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_BSP_GetResourceTypeLimit()
+ * ----------------------------------------------------
+ */
+uint32 OS_BSP_GetResourceTypeLimit(uint32 ResourceType)
+{
+    UT_GenStub_SetupReturnBuffer(OS_BSP_GetResourceTypeLimit, uint32);
+
+    UT_GenStub_AddParam(OS_BSP_GetResourceTypeLimit, uint32, ResourceType);
+
+    UT_GenStub_Execute(OS_BSP_GetResourceTypeLimit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_BSP_GetResourceTypeLimit, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_BSP_SetExitCode()
@@ -93,3 +109,16 @@ void OS_BSP_SetResourceTypeConfig(uint32 ResourceType, uint32 ConfigOptionValue)
 
     UT_GenStub_Execute(OS_BSP_SetResourceTypeConfig, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_BSP_SetResourceTypeLimit()
+ * ----------------------------------------------------
+ */
+void OS_BSP_SetResourceTypeLimit(uint32 ResourceType, uint32 MaxCount)
+{
+    UT_GenStub_AddParam(OS_BSP_SetResourceTypeLimit, uint32, ResourceType);
+    UT_GenStub_AddParam(OS_BSP_SetResourceTypeLimit, uint32, MaxCount);
+
+    UT_GenStub_Execute(OS_BSP_SetResourceTypeLimit, Basic, NULL);
+}
@@ -115,6 +115,23 @@ int32 OS_CountSemGive(osal_id_t sem_id)
     return UT_GenStub_GetReturnValue(OS_CountSemGive, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_CountSemGiveN()
+ * ----------------------------------------------------
+ */
+int32 OS_CountSemGiveN(osal_id_t sem_id, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_CountSemGiveN, int32);
+
+    UT_GenStub_AddParam(OS_CountSemGiveN, osal_id_t, sem_id);
+    UT_GenStub_AddParam(OS_CountSemGiveN, uint32, count);
+
+    UT_GenStub_Execute(OS_CountSemGiveN, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_CountSemGiveN, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_CountSemTake()
@@ -131,6 +148,23 @@ int32 OS_CountSemTake(osal_id_t sem_id)
     return UT_GenStub_GetReturnValue(OS_CountSemTake, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_CountSemTakeN()
+ * ----------------------------------------------------
+ */
+int32 OS_CountSemTakeN(osal_id_t sem_id, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_CountSemTakeN, int32);
+
+    UT_GenStub_AddParam(OS_CountSemTakeN, osal_id_t, sem_id);
+    UT_GenStub_AddParam(OS_CountSemTakeN, uint32, count);
+
+    UT_GenStub_Execute(OS_CountSemTakeN, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_CountSemTakeN, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_CountSemTimedWait()
@@ -147,3 +181,21 @@ int32 OS_CountSemTimedWait(osal_id_t sem_id, uint32 msecs)
 
     return UT_GenStub_GetReturnValue(OS_CountSemTimedWait, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_CountSemTimedWaitN()
+ * ----------------------------------------------------
+ */
+int32 OS_CountSemTimedWaitN(osal_id_t sem_id, uint32 count, uint32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_CountSemTimedWaitN, int32);
+
+    UT_GenStub_AddParam(OS_CountSemTimedWaitN, osal_id_t, sem_id);
+    UT_GenStub_AddParam(OS_CountSemTimedWaitN, uint32, count);
+    UT_GenStub_AddParam(OS_CountSemTimedWaitN, uint32, msecs);
+
+    UT_GenStub_Execute(OS_CountSemTimedWaitN, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_CountSemTimedWaitN, int32);
+}
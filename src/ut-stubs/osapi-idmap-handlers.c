@@ -189,3 +189,22 @@ void UT_DefaultHandler_OS_IdentifyObject(void *UserObj, UT_EntryKey_t FuncKey, c
 
     UT_Stub_SetReturnValue(FuncKey, ObjType);
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_GetObjectTypeLockStats' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_GetObjectTypeLockStats(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_lock_stats_t *stats = UT_Hook_GetArgValueByName(Context, "stats", OS_lock_stats_t *);
+    int32            status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_GetObjectTypeLockStats), stats, sizeof(*stats)) < sizeof(*stats))
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
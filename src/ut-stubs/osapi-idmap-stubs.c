@@ -28,6 +28,7 @@
 void UT_DefaultHandler_OS_ConvertToArrayIndex(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ForEachObject(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ForEachObjectOfType(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_GetObjectTypeLockStats(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GetResourceName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_IdentifyObject(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_ObjectIdToArrayIndex(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -63,6 +64,20 @@ void OS_ForEachObject(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void
     UT_GenStub_Execute(OS_ForEachObject, Basic, UT_DefaultHandler_OS_ForEachObject);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ForEachObjectNonBlocking()
+ * ----------------------------------------------------
+ */
+void OS_ForEachObjectNonBlocking(osal_id_t creator_id, OS_ArgCallback_t callback_ptr, void *callback_arg)
+{
+    UT_GenStub_AddParam(OS_ForEachObjectNonBlocking, osal_id_t, creator_id);
+    UT_GenStub_AddParam(OS_ForEachObjectNonBlocking, OS_ArgCallback_t, callback_ptr);
+    UT_GenStub_AddParam(OS_ForEachObjectNonBlocking, void *, callback_arg);
+
+    UT_GenStub_Execute(OS_ForEachObjectNonBlocking, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ForEachObjectOfType()
@@ -79,6 +94,39 @@ void OS_ForEachObjectOfType(osal_objtype_t objtype, osal_id_t creator_id, OS_Arg
     UT_GenStub_Execute(OS_ForEachObjectOfType, Basic, UT_DefaultHandler_OS_ForEachObjectOfType);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ForEachObjectOfTypeNonBlocking()
+ * ----------------------------------------------------
+ */
+void OS_ForEachObjectOfTypeNonBlocking(osal_objtype_t objtype, osal_id_t creator_id, OS_ArgCallback_t callback_ptr,
+                                       void *callback_arg)
+{
+    UT_GenStub_AddParam(OS_ForEachObjectOfTypeNonBlocking, osal_objtype_t, objtype);
+    UT_GenStub_AddParam(OS_ForEachObjectOfTypeNonBlocking, osal_id_t, creator_id);
+    UT_GenStub_AddParam(OS_ForEachObjectOfTypeNonBlocking, OS_ArgCallback_t, callback_ptr);
+    UT_GenStub_AddParam(OS_ForEachObjectOfTypeNonBlocking, void *, callback_arg);
+
+    UT_GenStub_Execute(OS_ForEachObjectOfTypeNonBlocking, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GetObjectTypeLockStats()
+ * ----------------------------------------------------
+ */
+int32 OS_GetObjectTypeLockStats(osal_objtype_t objtype, OS_lock_stats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GetObjectTypeLockStats, int32);
+
+    UT_GenStub_AddParam(OS_GetObjectTypeLockStats, osal_objtype_t, objtype);
+    UT_GenStub_AddParam(OS_GetObjectTypeLockStats, OS_lock_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_GetObjectTypeLockStats, Basic, UT_DefaultHandler_OS_GetObjectTypeLockStats);
+
+    return UT_GenStub_GetReturnValue(OS_GetObjectTypeLockStats, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GetResourceName()
@@ -98,6 +98,23 @@ int32 OS_MutSemGetInfo(osal_id_t sem_id, OS_mut_sem_prop_t *mut_prop)
     return UT_GenStub_GetReturnValue(OS_MutSemGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MutSemGetStats()
+ * ----------------------------------------------------
+ */
+int32 OS_MutSemGetStats(osal_id_t sem_id, OS_mut_sem_stats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MutSemGetStats, int32);
+
+    UT_GenStub_AddParam(OS_MutSemGetStats, osal_id_t, sem_id);
+    UT_GenStub_AddParam(OS_MutSemGetStats, OS_mut_sem_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_MutSemGetStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_MutSemGetStats, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_MutSemGive()
@@ -114,6 +131,22 @@ int32 OS_MutSemGive(osal_id_t sem_id)
     return UT_GenStub_GetReturnValue(OS_MutSemGive, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_MutSemResetStats()
+ * ----------------------------------------------------
+ */
+int32 OS_MutSemResetStats(osal_id_t sem_id)
+{
+    UT_GenStub_SetupReturnBuffer(OS_MutSemResetStats, int32);
+
+    UT_GenStub_AddParam(OS_MutSemResetStats, osal_id_t, sem_id);
+
+    UT_GenStub_Execute(OS_MutSemResetStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_MutSemResetStats, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_MutSemTake()
@@ -54,6 +54,50 @@ void UT_DefaultHandler_OS_QueueCreate(void *UserObj, UT_EntryKey_t FuncKey, cons
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueCreatePacked' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueCreatePacked(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *queue_id = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *queue_id = UT_AllocStubObjId(OS_OBJECT_TYPE_OS_QUEUE);
+    }
+    else
+    {
+        *queue_id = UT_STUB_FAKE_OBJECT_ID;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueSubscribe' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueSubscribe(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *queue_id = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *queue_id = UT_AllocStubObjId(OS_OBJECT_TYPE_OS_QUEUE);
+    }
+    else
+    {
+        *queue_id = UT_STUB_FAKE_OBJECT_ID;
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_QueueDelete' stub
@@ -97,6 +141,33 @@ void UT_DefaultHandler_OS_QueueGet(void *UserObj, UT_EntryKey_t FuncKey, const U
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueGetWithPriority' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueGetWithPriority(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t queue_id    = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t);
+    void *    data        = UT_Hook_GetArgValueByName(Context, "data", void *);
+    size_t    size        = UT_Hook_GetArgValueByName(Context, "size", size_t);
+    size_t *  size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
+    uint32 *  priority    = UT_Hook_GetArgValueByName(Context, "priority", uint32 *);
+    int32     status;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        *size_copied = UT_Stub_CopyToLocal((UT_EntryKey_t)OS_ObjectIdToInteger(queue_id), data, size);
+        *priority    = 0;
+        if (*size_copied == 0)
+        {
+            status = OS_QUEUE_EMPTY;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_QueuePut' stub
@@ -117,6 +188,129 @@ void UT_DefaultHandler_OS_QueuePut(void *UserObj, UT_EntryKey_t FuncKey, const U
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueGetMultiple' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueGetMultiple(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t queue_id     = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t);
+    void *    data         = UT_Hook_GetArgValueByName(Context, "data", void *);
+    size_t    size         = UT_Hook_GetArgValueByName(Context, "size", size_t);
+    size_t *  sizes        = UT_Hook_GetArgValueByName(Context, "sizes", size_t *);
+    uint32 *  count_copied = UT_Hook_GetArgValueByName(Context, "count_copied", uint32 *);
+    int32     status;
+
+    /* This receives a single message, in the same manner as OS_QueueGet */
+    *count_copied = 0;
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        sizes[0] = UT_Stub_CopyToLocal((UT_EntryKey_t)OS_ObjectIdToInteger(queue_id), data, size);
+        if (sizes[0] == 0)
+        {
+            status = OS_QUEUE_EMPTY;
+        }
+        else
+        {
+            *count_copied = 1;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueuePutMultiple' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueuePutMultiple(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32  count     = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    uint32 *count_put = UT_Hook_GetArgValueByName(Context, "count_put", uint32 *);
+    int32   status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *count_put = count;
+    }
+    else
+    {
+        *count_put = 0;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueReserve' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueReserve(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **data_ptr = UT_Hook_GetArgValueByName(Context, "data_ptr", void **);
+    size_t size     = UT_Hook_GetArgValueByName(Context, "size", size_t);
+    void * buffer;
+    size_t buffer_size;
+    size_t position;
+    int32  status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    /* The test case may supply a buffer to represent the queue entry */
+    UT_GetDataBuffer(FuncKey, &buffer, &buffer_size, &position);
+    if (status == OS_SUCCESS && buffer != NULL && buffer_size >= size)
+    {
+        *data_ptr = buffer;
+    }
+    else
+    {
+        *data_ptr = NULL;
+        if (status == OS_SUCCESS)
+        {
+            status = OS_QUEUE_FULL;
+            UT_Stub_SetReturnValue(FuncKey, status);
+        }
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueGetRef' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueGetRef(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void **data_ptr    = UT_Hook_GetArgValueByName(Context, "data_ptr", const void **);
+    size_t *     size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
+    void *       buffer;
+    size_t       buffer_size;
+    size_t       position;
+    int32        status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    /* The test case may supply a buffer to represent the received message */
+    UT_GetDataBuffer(FuncKey, &buffer, &buffer_size, &position);
+    if (status == OS_SUCCESS && buffer != NULL)
+    {
+        *data_ptr    = buffer;
+        *size_copied = buffer_size;
+    }
+    else
+    {
+        *data_ptr    = NULL;
+        *size_copied = 0;
+        if (status == OS_SUCCESS)
+        {
+            status = OS_QUEUE_EMPTY;
+            UT_Stub_SetReturnValue(FuncKey, status);
+        }
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_QueueGetIdByName' stub
@@ -156,3 +350,22 @@ void UT_DefaultHandler_OS_QueueGetInfo(void *UserObj, UT_EntryKey_t FuncKey, con
         queue_prop->name[sizeof(queue_prop->name) - 1] = '\0';
     }
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueGetStats' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueGetStats(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_queue_stats_t *stats = UT_Hook_GetArgValueByName(Context, "stats", OS_queue_stats_t *);
+    int32             status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_QueueGetStats), stats, sizeof(*stats)) < sizeof(*stats))
+    {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
@@ -26,11 +26,38 @@
 #include "utgenstub.h"
 
 void UT_DefaultHandler_OS_QueueCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueCreatePacked(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueGetMultiple(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueGetRef(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueGetStats(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueGetWithPriority(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueuePut(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueuePutMultiple(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueReserve(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueSubscribe(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCommit()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCommit(osal_id_t queue_id, void *data_ptr, size_t size, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCommit, int32);
+
+    UT_GenStub_AddParam(OS_QueueCommit, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueCommit, void *, data_ptr);
+    UT_GenStub_AddParam(OS_QueueCommit, size_t, size);
+    UT_GenStub_AddParam(OS_QueueCommit, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueueCommit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCommit, int32);
+}
 
 /*
  * ----------------------------------------------------
@@ -53,6 +80,49 @@ int32 OS_QueueCreate(osal_id_t *queue_id, const char *queue_name, osal_blockcoun
     return UT_GenStub_GetReturnValue(OS_QueueCreate, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCreateBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCreateBatch(osal_id_t *queue_ids, const char *const *queue_names, uint32 count,
+                          osal_blockcount_t queue_depth, size_t data_size, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCreateBatch, int32);
+
+    UT_GenStub_AddParam(OS_QueueCreateBatch, osal_id_t *, queue_ids);
+    UT_GenStub_AddParam(OS_QueueCreateBatch, const char *const *, queue_names);
+    UT_GenStub_AddParam(OS_QueueCreateBatch, uint32, count);
+    UT_GenStub_AddParam(OS_QueueCreateBatch, osal_blockcount_t, queue_depth);
+    UT_GenStub_AddParam(OS_QueueCreateBatch, size_t, data_size);
+    UT_GenStub_AddParam(OS_QueueCreateBatch, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueueCreateBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCreateBatch, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueCreatePacked()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueCreatePacked(osal_id_t *queue_id, const char *queue_name, size_t byte_budget, size_t max_size,
+                           uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueCreatePacked, int32);
+
+    UT_GenStub_AddParam(OS_QueueCreatePacked, osal_id_t *, queue_id);
+    UT_GenStub_AddParam(OS_QueueCreatePacked, const char *, queue_name);
+    UT_GenStub_AddParam(OS_QueueCreatePacked, size_t, byte_budget);
+    UT_GenStub_AddParam(OS_QueueCreatePacked, size_t, max_size);
+    UT_GenStub_AddParam(OS_QueueCreatePacked, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueueCreatePacked, Basic, UT_DefaultHandler_OS_QueueCreatePacked);
+
+    return UT_GenStub_GetReturnValue(OS_QueueCreatePacked, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueDelete()
@@ -69,6 +139,23 @@ int32 OS_QueueDelete(osal_id_t queue_id)
     return UT_GenStub_GetReturnValue(OS_QueueDelete, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueDeleteBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueDeleteBatch(const osal_id_t *queue_ids, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueDeleteBatch, int32);
+
+    UT_GenStub_AddParam(OS_QueueDeleteBatch, const osal_id_t *, queue_ids);
+    UT_GenStub_AddParam(OS_QueueDeleteBatch, uint32, count);
+
+    UT_GenStub_Execute(OS_QueueDeleteBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueDeleteBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueGet()
@@ -123,6 +210,87 @@ int32 OS_QueueGetInfo(osal_id_t queue_id, OS_queue_prop_t *queue_prop)
     return UT_GenStub_GetReturnValue(OS_QueueGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetMultiple()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetMultiple(osal_id_t queue_id, void *data, size_t size, size_t *sizes, uint32 max_count,
+                          uint32 *count_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetMultiple, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetMultiple, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueGetMultiple, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetMultiple, size_t, size);
+    UT_GenStub_AddParam(OS_QueueGetMultiple, size_t *, sizes);
+    UT_GenStub_AddParam(OS_QueueGetMultiple, uint32, max_count);
+    UT_GenStub_AddParam(OS_QueueGetMultiple, uint32 *, count_copied);
+    UT_GenStub_AddParam(OS_QueueGetMultiple, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetMultiple, Basic, UT_DefaultHandler_OS_QueueGetMultiple);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetMultiple, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetRef()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetRef(osal_id_t queue_id, const void **data_ptr, size_t *size_copied, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetRef, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetRef, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueGetRef, const void **, data_ptr);
+    UT_GenStub_AddParam(OS_QueueGetRef, size_t *, size_copied);
+    UT_GenStub_AddParam(OS_QueueGetRef, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetRef, Basic, UT_DefaultHandler_OS_QueueGetRef);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetRef, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetStats()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetStats(osal_id_t queue_id, OS_queue_stats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetStats, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetStats, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueGetStats, OS_queue_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_QueueGetStats, Basic, UT_DefaultHandler_OS_QueueGetStats);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetStats, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetWithPriority()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetWithPriority(osal_id_t queue_id, void *data, size_t size, size_t *size_copied, uint32 *priority,
+                              int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetWithPriority, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetWithPriority, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority, size_t, size);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority, size_t *, size_copied);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority, uint32 *, priority);
+    UT_GenStub_AddParam(OS_QueueGetWithPriority, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetWithPriority, Basic, UT_DefaultHandler_OS_QueueGetWithPriority);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetWithPriority, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueuePut()
@@ -141,3 +309,136 @@ int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flag
 
     return UT_GenStub_GetReturnValue(OS_QueuePut, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutAbs()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutAbs(osal_id_t queue_id, const void *data, size_t size, uint32 flags, OS_time_t abs_timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutAbs, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutAbs, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueuePutAbs, const void *, data);
+    UT_GenStub_AddParam(OS_QueuePutAbs, size_t, size);
+    UT_GenStub_AddParam(OS_QueuePutAbs, uint32, flags);
+    UT_GenStub_AddParam(OS_QueuePutAbs, OS_time_t, abs_timeout);
+
+    UT_GenStub_Execute(OS_QueuePutAbs, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutAbs, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutMultiple()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutMultiple(osal_id_t queue_id, const void *data, size_t size, const size_t *sizes, uint32 count,
+                          uint32 flags, uint32 *count_put)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutMultiple, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutMultiple, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueuePutMultiple, const void *, data);
+    UT_GenStub_AddParam(OS_QueuePutMultiple, size_t, size);
+    UT_GenStub_AddParam(OS_QueuePutMultiple, const size_t *, sizes);
+    UT_GenStub_AddParam(OS_QueuePutMultiple, uint32, count);
+    UT_GenStub_AddParam(OS_QueuePutMultiple, uint32, flags);
+    UT_GenStub_AddParam(OS_QueuePutMultiple, uint32 *, count_put);
+
+    UT_GenStub_Execute(OS_QueuePutMultiple, Basic, UT_DefaultHandler_OS_QueuePutMultiple);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutMultiple, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueuePutTimed()
+ * ----------------------------------------------------
+ */
+int32 OS_QueuePutTimed(osal_id_t queue_id, const void *data, size_t size, uint32 flags, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueuePutTimed, int32);
+
+    UT_GenStub_AddParam(OS_QueuePutTimed, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueuePutTimed, const void *, data);
+    UT_GenStub_AddParam(OS_QueuePutTimed, size_t, size);
+    UT_GenStub_AddParam(OS_QueuePutTimed, uint32, flags);
+    UT_GenStub_AddParam(OS_QueuePutTimed, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueuePutTimed, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueuePutTimed, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueRelease()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueRelease(osal_id_t queue_id, const void *data_ptr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueRelease, int32);
+
+    UT_GenStub_AddParam(OS_QueueRelease, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueRelease, const void *, data_ptr);
+
+    UT_GenStub_Execute(OS_QueueRelease, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueRelease, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueReserve()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueReserve(osal_id_t queue_id, void **data_ptr, size_t size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueReserve, int32);
+
+    UT_GenStub_AddParam(OS_QueueReserve, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueReserve, void **, data_ptr);
+    UT_GenStub_AddParam(OS_QueueReserve, size_t, size);
+
+    UT_GenStub_Execute(OS_QueueReserve, Basic, UT_DefaultHandler_OS_QueueReserve);
+
+    return UT_GenStub_GetReturnValue(OS_QueueReserve, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueResetStats()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueResetStats(osal_id_t queue_id)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueResetStats, int32);
+
+    UT_GenStub_AddParam(OS_QueueResetStats, osal_id_t, queue_id);
+
+    UT_GenStub_Execute(OS_QueueResetStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_QueueResetStats, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueSubscribe()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueSubscribe(osal_id_t *queue_id, const char *queue_name, osal_id_t broadcast_id, uint32 flags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueSubscribe, int32);
+
+    UT_GenStub_AddParam(OS_QueueSubscribe, osal_id_t *, queue_id);
+    UT_GenStub_AddParam(OS_QueueSubscribe, const char *, queue_name);
+    UT_GenStub_AddParam(OS_QueueSubscribe, osal_id_t, broadcast_id);
+    UT_GenStub_AddParam(OS_QueueSubscribe, uint32, flags);
+
+    UT_GenStub_Execute(OS_QueueSubscribe, Basic, UT_DefaultHandler_OS_QueueSubscribe);
+
+    return UT_GenStub_GetReturnValue(OS_QueueSubscribe, int32);
+}